@@ -0,0 +1,149 @@
+﻿#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "../MyTinySTL/bit_vector.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Test_bit_vector {
+	// 以 std::vector<bool> 为参照逐位比较
+	void assert_matches(const my::bit_vector<>& bits, const std::vector<bool>& expected) {
+		Assert::AreEqual(expected.size(), bits.size());
+		Assert::IsTrue(std::equal(bits.begin(), bits.end(), expected.begin()));
+	}
+
+	TEST_CLASS(Test_bit_vector_container) {
+	public:
+		TEST_METHOD(TestPushAndResize) {
+			my::bit_vector<> bits;
+			std::vector<bool> expected;
+			for (int i = 0; i < 200; ++i) {
+				bits.push_back(i % 3 == 0);
+				expected.push_back(i % 3 == 0);
+			}
+			assert_matches(bits, expected);
+			Assert::AreEqual(size_t(4), bits.word_count());
+
+			for (int i = 0; i < 70; ++i) {
+				bits.pop_back();
+				expected.pop_back();
+			}
+			assert_matches(bits, expected);
+			Assert::AreEqual(size_t(3), bits.word_count());
+
+			bits.resize(300, true);
+			expected.resize(300, true);
+			assert_matches(bits, expected);
+			bits.resize(67);
+			expected.resize(67);
+			assert_matches(bits, expected);
+			// 超出 size() 的位保持为 0
+			Assert::AreEqual(std::uint64_t(1) << 2, bits.data()[1]);
+
+			Assert::IsTrue(my::bit_vector<>(3, true) == my::bit_vector<>{ true, true, true });
+			Assert::ExpectException<std::out_of_range>([&bits] { bits.at(67); });
+		}
+
+		TEST_METHOD(TestReferences) {
+			my::bit_vector<> bits(130);
+			bits[1] = true;
+			bits[129] = bits[1];
+			bits.back().flip();
+			bits.flip(64);
+			Assert::IsTrue(bits[1] && !bits[129] && bits.test(64));
+			Assert::IsTrue(~bits[0]);
+
+			swap(bits[0], bits[1]);
+			Assert::IsTrue(bits.front() && !bits[1]);
+
+			// 迭代器随机访问
+			my::bit_vector<>::iterator it = bits.begin() + 64;
+			Assert::IsTrue(*it);
+			it -= 63;
+			Assert::IsTrue(it - bits.begin() == 1);
+			my::bit_vector<>::const_iterator last = bits.end();
+			Assert::IsTrue(last - it == 129 && it < last);
+			Assert::AreEqual(2, static_cast<int>(std::count(bits.cbegin(), bits.cend(), true)));
+			Assert::IsTrue(*bits.rbegin() == bits[129]);
+
+			std::reverse(bits.begin(), bits.end());
+			Assert::IsTrue(bits[129] && bits[65] && bits.count() == 2);
+		}
+
+		TEST_METHOD(TestCompare) {
+			my::bit_vector<> a{ false, true }, b{ true }, c{ false, true, false };
+			Assert::IsTrue(a < b && a < c && !(c < a) && a != c);
+			my::bit_vector<> long_a(100), long_b(100);
+			long_b[99] = true;
+			Assert::IsTrue(long_a < long_b);
+			long_a[70] = true;
+			Assert::IsTrue(long_b < long_a);
+
+			my::bit_vector<> moved(my::move(long_a));
+			Assert::IsTrue(long_a.empty() && moved.count() == 1);
+		}
+	};
+
+	TEST_CLASS(Test_bit_vector_operations) {
+	public:
+		TEST_METHOD(TestFillAndCount) {
+			my::bit_vector<> bits(500);
+			bits.fill(3, 5, true);
+			bits.fill(60, 260, true);
+			Assert::AreEqual(size_t(202), bits.count());
+			Assert::AreEqual(size_t(100), bits.count(100, 200));
+			Assert::AreEqual(size_t(4), bits.count(2, 62));
+			bits.fill(64, 128, false);
+			Assert::AreEqual(size_t(138), bits.count());
+			Assert::IsTrue(bits[63] && !bits[64] && !bits[127] && bits[128]);
+
+			bits.set();
+			Assert::IsTrue(bits.all() && bits.count() == 500);
+			bits.flip();
+			Assert::IsTrue(bits.none());
+			bits.set(499);
+			Assert::IsTrue(bits.any());
+			bits.reset();
+			Assert::IsTrue(bits.none());
+		}
+
+		TEST_METHOD(TestFind) {
+			my::bit_vector<> bits(1000);
+			Assert::AreEqual(my::bit_vector<>::npos, bits.find_first());
+			const size_t positions[] = { 0, 63, 64, 500, 999 };
+			for (size_t position : positions) {
+				bits.set(position);
+			}
+			std::vector<size_t> found;
+			for (size_t i = bits.find_first(); i != my::bit_vector<>::npos; i = bits.find_next(i)) {
+				found.push_back(i);
+			}
+			Assert::IsTrue(found == std::vector<size_t>(std::begin(positions), std::end(positions)));
+			Assert::AreEqual(my::bit_vector<>::npos, bits.find_next(999));
+			Assert::AreEqual(size_t(500), bits.find_next(65));
+		}
+
+		TEST_METHOD(TestBitwise) {
+			my::bit_vector<> a(130), b(130);
+			a.fill(0, 100, true);
+			b.fill(50, 130, true);
+			Assert::AreEqual(size_t(50), (a & b).count());
+			Assert::AreEqual(size_t(130), (a | b).count());
+			Assert::AreEqual(size_t(80), (a ^ b).count());
+			Assert::AreEqual(size_t(30), (~a).count());
+
+			my::bit_vector<> c(a);
+			c.and_not(b);
+			Assert::AreEqual(size_t(50), c.count());
+			Assert::AreEqual(size_t(49), c.find_next(48));
+			Assert::AreEqual(my::bit_vector<>::npos, c.find_next(49));
+
+			my::bit_vector<> shorter(64);
+			Assert::ExpectException<std::invalid_argument>([&] { a &= shorter; });
+		}
+	};
+}
@@ -0,0 +1,125 @@
+﻿#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "../MyTinySTL/tuple.hpp"
+
+#include <string>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+#if __HAS_CPP20
+namespace Test_compare {
+	struct less_only {
+		int value;
+
+		bool operator<(const less_only& other) const { return value < other.value; }
+		bool operator==(const less_only& other) const { return value == other.value; }
+	};
+
+	struct counted {
+		int value;
+		int* calls;
+
+		::std::strong_ordering operator<=>(const counted& other) const {
+			++*calls;
+			return value <=> other.value;
+		}
+		bool operator==(const counted& other) const { return value == other.value; }
+	};
+
+	TEST_CLASS(Test_comparison_categories) {
+	public:
+		TEST_METHOD(TestOrderings) {
+			static_assert(my::strong_ordering::less < 0 && 0 > my::strong_ordering::less);
+			static_assert(my::strong_ordering::equal == my::strong_ordering::equivalent);
+			static_assert(my::weak_ordering(my::strong_ordering::greater) == my::weak_ordering::greater);
+			static_assert(my::partial_ordering(my::weak_ordering::less) == my::partial_ordering::less);
+			static_assert((0 <=> my::strong_ordering::less) == my::strong_ordering::greater);
+
+			constexpr my::partial_ordering unordered = my::partial_ordering::unordered;
+			static_assert(!(unordered < 0) && !(unordered <= 0) && !(unordered > 0) && !(unordered >= 0));
+			static_assert(unordered != 0 && !my::is_eq(unordered) && my::is_neq(unordered));
+
+			static_assert(my::is_same<my::common_comparison_category_t<>, my::strong_ordering>::value);
+			static_assert(my::is_same<
+				my::common_comparison_category_t<my::strong_ordering, ::std::weak_ordering>, my::weak_ordering
+			>::value);
+			static_assert(my::is_same<
+				my::common_comparison_category_t<my::weak_ordering, my::partial_ordering>, my::partial_ordering
+			>::value);
+			static_assert(my::is_same<my::common_comparison_category_t<my::strong_ordering, int>, void>::value);
+
+			static_assert(my::is_same<my::compare_three_way_result_t<int>, my::strong_ordering>::value);
+			static_assert(my::is_same<my::compare_three_way_result_t<double>, my::partial_ordering>::value);
+			Assert::IsTrue(my::is_lt(my::compare_three_way()(1, 2)));
+		}
+	};
+
+	TEST_CLASS(Test_three_way_comparison) {
+	public:
+		TEST_METHOD(TestPair) {
+			using ints = my::pair<int, int>;
+			static_assert(my::is_same<decltype(ints() <=> ints()), my::strong_ordering>::value);
+			static_assert((ints(1, 2) <=> ints(1, 3)) == my::strong_ordering::less);
+			static_assert(ints(2, 0) > ints(1, 9) && ints(1, 2) == ints(1, 2));
+
+			using mixed = my::pair<less_only, double>;
+			static_assert(my::is_same<decltype(mixed() <=> mixed()), my::partial_ordering>::value);
+			Assert::IsTrue(mixed(less_only{ 1 }, 2.0) < mixed(less_only{ 1 }, 3.0));
+			Assert::IsTrue(mixed(less_only{ 2 }, 0.0) >= mixed(less_only{ 1 }, 3.0));
+
+			using bytes = my::pair<unsigned char, unsigned char>;
+			Assert::IsTrue(bytes(1, 200) < bytes(2, 0));
+			Assert::IsTrue((bytes(7, 7) <=> bytes(7, 7)) == 0);
+		}
+
+		TEST_METHOD(TestTuple) {
+			using row = my::tuple<int, std::string, less_only>;
+			static_assert(my::is_same<decltype(row() <=> row()), my::weak_ordering>::value);
+			Assert::IsTrue(row(1, "a", less_only{ 3 }) < row(1, "a", less_only{ 4 }));
+			Assert::IsTrue(row(1, "b", less_only{ 0 }) > row(1, "a", less_only{ 9 }));
+			Assert::IsTrue(row(1, "a", less_only{ 3 }) == row(1, "a", less_only{ 3 }));
+
+			// 不同元素类型之间也可以比较
+			Assert::IsTrue(my::tuple<int, long>(1, 2) < my::tuple<long, int>(1, 3));
+			Assert::IsTrue((my::tuple<>() <=> my::tuple<>()) == 0);
+
+			const double nan = __builtin_nan("");
+			Assert::IsTrue((my::tuple<int, double>(1, nan) <=> my::tuple<int, double>(1, 0.0)) == my::partial_ordering::unordered);
+
+			constexpr my::tuple<int, char> small(1, 'a'), large(1, 'b');
+			static_assert(small < large && small != large && (large <=> small) > 0);
+		}
+
+		TEST_METHOD(TestSinglePass) {
+			int calls = 0;
+			my::tuple<counted, counted, counted> lhs(counted{ 1, &calls }, counted{ 2, &calls }, counted{ 3, &calls });
+			my::tuple<counted, counted, counted> rhs(counted{ 1, &calls }, counted{ 5, &calls }, counted{ 0, &calls });
+			Assert::IsTrue(lhs < rhs);
+			// 每个元素只比较一次，在第二个元素处得出结果
+			Assert::AreEqual(2, calls);
+
+			calls = 0;
+			Assert::IsTrue(my::make_pair(counted{ 1, &calls }, 0) <= my::make_pair(counted{ 1, &calls }, 0));
+			Assert::AreEqual(1, calls);
+		}
+
+		TEST_METHOD(TestBytewisePaths) {
+			static_assert(my::inner::__is_bitwise_equality_comparable<my::pair<int, int>, my::pair<int, int>>::value);
+			static_assert(!my::inner::__is_bitwise_equality_comparable<my::pair<double, int>, my::pair<double, int>>::value);
+			static_assert(!my::inner::__is_bitwise_equality_comparable<my::pair<char, int>, my::pair<char, int>>::value);
+			static_assert(my::inner::__is_bitwise_equality_comparable<my::tuple<char, int, char, short>, my::tuple<char, int, char, short>>::value);
+			static_assert(my::inner::__is_byte_comparable<my::tuple<unsigned char, bool>, my::tuple<unsigned char, bool>>::value);
+			static_assert(!my::inner::__is_byte_comparable<my::tuple<signed char>, my::tuple<signed char>>::value);
+
+			my::tuple<char, int, char, short> packed('a', 1, 'b', 2), same('a', 1, 'b', 2), other('a', 1, 'c', 2);
+			Assert::IsTrue(packed == same);
+			Assert::IsTrue(packed != other);
+
+			my::tuple<unsigned char, unsigned char, unsigned char> a(1, 2, 255), b(1, 3, 0);
+			Assert::IsTrue(a < b);
+			Assert::IsTrue((b <=> a) == my::strong_ordering::greater);
+		}
+	};
+}
+#endif // __HAS_CPP20
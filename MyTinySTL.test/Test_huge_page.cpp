@@ -0,0 +1,84 @@
+﻿#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "../MyTinySTL/huge_page.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Test_huge_page {
+	TEST_CLASS(Test_huge_page_allocator) {
+		static bool is_aligned(const void* ptr, size_t alignment) {
+			return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+		}
+
+	public:
+		TEST_METHOD(TestAllocator) {
+			my::huge_page_allocator<double> alloc;
+			const size_t count = (size_t(4) << 20) / sizeof(double);
+			double* big = alloc.allocate(count);
+			Assert::IsTrue(is_aligned(big, size_t(2) << 20));
+			for (size_t i = 0; i < count; i += 512) {
+				big[i] = static_cast<double>(i);
+			}
+			Assert::AreEqual(big[count - 512], static_cast<double>(count - 512));
+			alloc.deallocate(big, count);
+
+			my::huge_page_allocator<char> small_alloc(alloc);
+			char* small = small_alloc.allocate(100);
+			std::memset(small, 1, 100);
+			small_alloc.deallocate(small, 100);
+		}
+
+		TEST_METHOD(TestResource) {
+			my::pmr::huge_page_options options;
+			options.populate = true;
+			my::pmr::huge_page_resource resource(options);
+
+			void* big = resource.allocate(options.huge_page_bytes + 1, 64);
+			Assert::IsTrue(is_aligned(big, options.huge_page_bytes));
+			Assert::AreEqual(resource.bytes_mapped(), 2 * options.huge_page_bytes);
+			static_cast<char*>(big)[options.huge_page_bytes] = 1;
+
+			void* small = resource.allocate(10, 8);
+			Assert::IsTrue(resource.bytes_mapped() % options.huge_page_bytes != 0);
+
+			void* overaligned = resource.allocate(100, 1 << 16);
+			Assert::IsTrue(is_aligned(overaligned, 1 << 16));
+
+			resource.deallocate(small, 10, 8);
+			resource.deallocate(overaligned, 100, 1 << 16);
+			resource.deallocate(big, options.huge_page_bytes + 1, 64);
+			Assert::AreEqual(resource.bytes_mapped(), size_t(0));
+		}
+
+		TEST_METHOD(TestInvalidHugePageBytes) {
+			// 不是 2 的幂的大页大小不能用作对齐，退化为普通页
+			my::pmr::huge_page_options options;
+			options.huge_page_bytes = (size_t(3) << 20) + 1;
+			my::pmr::huge_page_resource resource(options);
+
+			void* big = resource.allocate(options.huge_page_bytes, 64);
+			Assert::IsTrue(is_aligned(big, 64));
+			Assert::IsTrue(resource.bytes_mapped() < 2 * options.huge_page_bytes);
+			static_cast<char*>(big)[options.huge_page_bytes - 1] = 1;
+			resource.deallocate(big, options.huge_page_bytes, 64);
+			Assert::AreEqual(resource.bytes_mapped(), size_t(0));
+		}
+
+		TEST_METHOD(TestArena) {
+			my::pmr::huge_page_resource upstream;
+			{
+				my::pmr::monotonic_buffer_resource arena(size_t(1) << 20, &upstream);
+				for (int i = 0; i < 1000; ++i) {
+					int* p = static_cast<int*>(arena.allocate(4096, alignof(int)));
+					p[1023] = i;
+				}
+				Assert::IsTrue(upstream.bytes_mapped() >= 1000 * 4096);
+			}
+			Assert::AreEqual(upstream.bytes_mapped(), size_t(0));
+		}
+	};
+}
@@ -0,0 +1,171 @@
+﻿#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "../MyTinySTL/inplace_vector.hpp"
+
+#include <list>
+#include <new>
+#include <sstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Test_inplace_vector {
+	// 可平凡复制但不是平凡类型
+	struct point {
+		int x = 0;
+		int y = 0;
+	};
+
+	// 统计存活对象个数，移动构造不可按字节搬移
+	struct tracked {
+		static int alive;
+		int value;
+
+		tracked(int value = 0): value(value) { ++alive; }
+		tracked(const tracked& other): value(other.value) { ++alive; }
+		tracked(tracked&& other) noexcept: value(other.value) { other.value = -1; ++alive; }
+		tracked& operator=(const tracked&) = default;
+		tracked& operator=(tracked&&) = default;
+		~tracked() { --alive; }
+	};
+
+	int tracked::alive = 0;
+
+	static_assert(std::is_trivially_copyable<my::inplace_vector<int, 4>>::value, "");
+	static_assert(std::is_trivially_copyable<my::inplace_vector<point, 4>>::value, "");
+	static_assert(!std::is_trivially_copyable<my::inplace_vector<std::string, 4>>::value, "");
+	static_assert(std::is_trivially_copyable<my::inplace_vector<std::string, 0>>::value, "");
+	static_assert(my::is_trivially_relocatable<my::inplace_vector<my::unique_ptr<int>, 2>>::value, "");
+
+	#if __HAS_CPP20
+	constexpr int constant_evaluated() {
+		my::inplace_vector<int, 8> values{ 3, 1 };
+		values.push_back(4);
+		values.insert(values.begin(), 2, 0);
+		values.emplace(values.begin() + 1, 9);
+		values.erase(values.begin());
+		if (values.try_push_back(5) == nullptr) {
+			return -1;
+		}
+		my::inplace_vector<int, 8> other(values);
+		other.resize(2);
+		values.swap(other);
+		// values = { 9, 0 }，other = { 9, 0, 3, 1, 4, 5 }
+		return (other > values ? 100 : 0) + values[0] * 10 + static_cast<int>(other.size());
+	}
+
+	static_assert(constant_evaluated() == 196, "");
+	#endif // __HAS_CPP20
+
+	TEST_CLASS(Test_inplace_vector_capacity) {
+	public:
+		TEST_METHOD(TestOverflow) {
+			my::inplace_vector<int, 3> values;
+			Assert::AreEqual(size_t(3), values.capacity());
+			for (int i = 0; i < 3; ++i) {
+				Assert::AreEqual(i, *values.try_push_back(i));
+			}
+			// 已满时 try_* 返回空指针且不改变内容
+			Assert::IsNull(values.try_push_back(3));
+			Assert::IsNull(values.try_emplace_back(3));
+			Assert::AreEqual(size_t(3), values.size());
+
+			Assert::ExpectException<std::bad_alloc>([&values] { values.push_back(3); });
+			Assert::ExpectException<std::bad_alloc>([&values] { values.insert(values.begin(), 3); });
+			Assert::ExpectException<std::bad_alloc>([&values] { values.resize(4); });
+			Assert::ExpectException<std::bad_alloc>([] { my::inplace_vector<int, 3>(4, 0); });
+			std::istringstream input("1 2 3 4");
+			Assert::ExpectException<std::bad_alloc>([&input] {
+				my::inplace_vector<int, 3>(std::istream_iterator<int>(input), std::istream_iterator<int>());
+			});
+			Assert::IsTrue(values == my::inplace_vector<int, 3>{ 0, 1, 2 });
+
+			values.pop_back();
+			values.unchecked_push_back(7);
+			Assert::AreEqual(7, values.back());
+
+			my::inplace_vector<int, 0> empty;
+			Assert::IsNull(empty.try_push_back(1));
+			Assert::IsTrue(empty.begin() == empty.end());
+		}
+
+		TEST_METHOD(TestExceptionSafety) {
+			tracked::alive = 0;
+			{
+				my::inplace_vector<tracked, 4> values{ 1, 2, 3 };
+				std::list<tracked> longer{ 4, 5 };
+				// 插入失败时容器保持不变
+				Assert::ExpectException<std::bad_alloc>([&] { values.insert(values.begin(), longer.begin(), longer.end()); });
+				Assert::AreEqual(size_t(3), values.size());
+				Assert::AreEqual(1, values.front().value);
+				Assert::AreEqual(5, tracked::alive);
+			}
+			Assert::AreEqual(0, tracked::alive);
+		}
+	};
+
+	TEST_CLASS(Test_inplace_vector_modifiers) {
+	public:
+		TEST_METHOD(TestMatchesVector) {
+			my::inplace_vector<std::string, 16> words{ "a", "b", "c" };
+			std::vector<std::string> expected{ "a", "b", "c" };
+			words.insert(words.begin() + 1, 2, words[2]);
+			expected.insert(expected.begin() + 1, 2, expected[2]);
+			words.emplace(words.begin(), words.back());
+			expected.emplace(expected.begin(), expected.back());
+			std::list<std::string> tail{ "p", "q" };
+			words.insert(words.begin() + 2, tail.begin(), tail.end());
+			expected.insert(expected.begin() + 2, tail.begin(), tail.end());
+			std::istringstream input("x y");
+			words.insert(words.end(), std::istream_iterator<std::string>(input), std::istream_iterator<std::string>());
+			expected.insert(expected.end(), { "x", "y" });
+			Assert::IsTrue(std::vector<std::string>(words.begin(), words.end()) == expected);
+
+			words.erase(words.begin() + 1, words.begin() + 4);
+			expected.erase(expected.begin() + 1, expected.begin() + 4);
+			words.resize(12, "z");
+			expected.resize(12, "z");
+			Assert::IsTrue(std::vector<std::string>(words.begin(), words.end()) == expected);
+
+			my::inplace_vector<std::string, 16> copied(words);
+			words.assign(3, words[0]);
+			Assert::AreEqual(expected[0], words[2]);
+			words = copied;
+			Assert::IsTrue(words == copied);
+			copied.assign({ "m" });
+			words = my::move(copied);
+			Assert::AreEqual(size_t(1), words.size());
+			Assert::AreEqual(std::string("m"), words[0]);
+			Assert::IsTrue(words > my::inplace_vector<std::string, 16>{ "a", "z" });
+		}
+
+		TEST_METHOD(TestSwap) {
+			tracked::alive = 0;
+			{
+				my::inplace_vector<tracked, 4> a{ 1, 2 }, b{ 3, 4, 5 };
+				a.swap(b);
+				Assert::AreEqual(size_t(3), a.size());
+				Assert::AreEqual(5, a[2].value);
+				Assert::AreEqual(2, b[1].value);
+				my::swap(a, b);
+				Assert::AreEqual(size_t(2), a.size());
+				Assert::AreEqual(5, tracked::alive);
+			}
+			Assert::AreEqual(0, tracked::alive);
+
+			// 可平凡重定位的元素整体搬移
+			my::inplace_vector<my::unique_ptr<int>, 4> owners, others;
+			owners.push_back(my::unique_ptr<int>(new int(1)));
+			owners.push_back(my::unique_ptr<int>(new int(2)));
+			owners.emplace(owners.begin(), new int(0));
+			owners.swap(others);
+			Assert::IsTrue(owners.empty());
+			Assert::AreEqual(0, *others[0]);
+			others.erase(others.begin());
+			Assert::AreEqual(2, *others.back());
+		}
+	};
+}
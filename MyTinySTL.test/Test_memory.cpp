@@ -0,0 +1,1183 @@
+﻿#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "../MyTinySTL/memory.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Test_memory {
+	TEST_CLASS(Test_allocator) {
+		struct alignas(64) Overaligned {
+			char data[64];
+		};
+
+	public:
+		TEST_METHOD(TestSmallObjects) {
+			my::allocator<int> alloc;
+			::std::vector<int*> blocks;
+			for (int i = 0; i < 1000; ++i) {
+				int* p = alloc.allocate(3);
+				p[0] = p[1] = p[2] = i;
+				blocks.push_back(p);
+			}
+			for (int i = 0; i < 1000; ++i) {
+				Assert::AreEqual(blocks[i][2], i);
+			}
+			for (int* p: blocks) {
+				alloc.deallocate(p, 3);
+			}
+
+			// 同尺寸类的块被复用
+			int* p = alloc.allocate(3);
+			int* q = alloc.allocate(4);
+			alloc.deallocate(q, 4);
+			Assert::IsTrue(alloc.allocate(4) == q);
+			alloc.deallocate(q, 4);
+			alloc.deallocate(p, 3);
+		}
+
+		TEST_METHOD(TestLargeObjects) {
+			my::allocator<double> alloc;
+			double* p = alloc.allocate(1000);
+			for (int i = 0; i < 1000; ++i) {
+				p[i] = i;
+			}
+			Assert::AreEqual(p[999], 999.0);
+			alloc.deallocate(p, 1000);
+		}
+
+		TEST_METHOD(TestOveraligned) {
+			my::allocator<Overaligned> alloc;
+			for (::size_t n = 1; n < 8; ++n) {
+				Overaligned* p = alloc.allocate(n);
+				Assert::IsTrue(reinterpret_cast<::std::uintptr_t>(p) % 64 == 0);
+				alloc.deallocate(p, n);
+			}
+		}
+
+		TEST_METHOD(TestRebind) {
+			my::allocator<int> a;
+			my::allocator<double> b(a);
+			static_assert(my::is_same<my::allocator<int>::rebind<char>::other, my::allocator<char>>::value, "");
+			Assert::IsTrue(a == b);
+
+			Assert::ExpectException<::std::bad_array_new_length>([&]() {
+				(void)a.allocate(a.max_size() + 1);
+			});
+		}
+	};
+
+	TEST_CLASS(Test_pool_allocator) {
+	public:
+		TEST_METHOD(TestSingleThread) {
+			my::pool_allocator<long> alloc;
+			::std::vector<long*> blocks;
+			for (int i = 0; i < 1000; ++i) {
+				long* p = alloc.allocate(2);
+				p[0] = p[1] = i;
+				blocks.push_back(p);
+			}
+			for (int i = 0; i < 1000; ++i) {
+				Assert::AreEqual(blocks[i][1], long(i));
+				alloc.deallocate(blocks[i], 2);
+			}
+
+			// 刚释放的块由线程缓存立即复用
+			long* p = alloc.allocate(1);
+			alloc.deallocate(p, 1);
+			Assert::IsTrue(alloc.allocate(1) == p);
+			alloc.deallocate(p, 1);
+
+			double* large = my::pool_allocator<double>(alloc).allocate(1000);
+			my::pool_allocator<double>().deallocate(large, 1000);
+		}
+
+		TEST_METHOD(TestCrossThread) {
+			my::pool_allocator<int> alloc;
+			::std::vector<int*> blocks(4000);
+
+			::std::vector<::std::thread> producers;
+			for (int t = 0; t < 4; ++t) {
+				producers.emplace_back([&, t]() {
+					for (int i = t * 1000; i < (t + 1) * 1000; ++i) {
+						blocks[i] = alloc.allocate(4);
+						blocks[i][3] = i;
+					}
+				});
+			}
+			for (auto& th: producers) {
+				th.join();
+			}
+
+			// 在其他线程上释放
+			::std::vector<::std::thread> consumers;
+			for (int t = 0; t < 4; ++t) {
+				consumers.emplace_back([&, t]() {
+					for (int i = t; i < 4000; i += 4) {
+						Assert::AreEqual(blocks[i][3], i);
+						alloc.deallocate(blocks[i], 4);
+					}
+				});
+			}
+			for (auto& th: consumers) {
+				th.join();
+			}
+			Assert::IsTrue(alloc == my::pool_allocator<char>());
+		}
+	};
+
+	TEST_CLASS(Test_memory_resource) {
+		// 记录从上游取得的字节数
+		class counting_resource: public my::pmr::memory_resource {
+		public:
+			::size_t outstanding = 0;
+			::size_t calls = 0;
+
+		private:
+			void* do_allocate(::size_t bytes, ::size_t alignment) override {
+				outstanding += bytes;
+				++calls;
+				return my::pmr::new_delete_resource()->allocate(bytes, alignment);
+			}
+
+			void do_deallocate(void* ptr, ::size_t bytes, ::size_t alignment) override {
+				outstanding -= bytes;
+				my::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+			}
+
+			bool do_is_equal(const my::pmr::memory_resource& other) const noexcept override {
+				return this == &other;
+			}
+		};
+
+	public:
+		TEST_METHOD(TestDefaultResource) {
+			Assert::IsTrue(my::pmr::get_default_resource() == my::pmr::new_delete_resource());
+			my::pmr::memory_resource* old = my::pmr::set_default_resource(my::pmr::null_memory_resource());
+			Assert::IsTrue(old == my::pmr::new_delete_resource());
+			Assert::ExpectException<::std::bad_alloc>([]() {
+				(void)my::pmr::polymorphic_allocator<int>().allocate(1);
+			});
+			my::pmr::set_default_resource(nullptr);
+			Assert::IsTrue(my::pmr::get_default_resource() == my::pmr::new_delete_resource());
+		}
+
+		TEST_METHOD(TestMonotonicBuffer) {
+			counting_resource upstream;
+			alignas(16) char buffer[256];
+			{
+				my::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), &upstream);
+				my::pmr::polymorphic_allocator<int> alloc(&arena);
+
+				int* a = alloc.allocate(4);
+				int* b = alloc.allocate(4);
+				Assert::IsTrue(b == a + 4);
+				Assert::IsTrue(reinterpret_cast<char*>(a) >= buffer && reinterpret_cast<char*>(b) < buffer + sizeof(buffer));
+				Assert::AreEqual(upstream.calls, ::size_t(0));
+
+				alloc.deallocate(a, 4);
+				for (int i = 0; i < 100; ++i) {
+					(void)alloc.allocate(16);
+				}
+				Assert::IsTrue(upstream.calls > 0);
+				Assert::AreEqual(arena.bytes_allocated(), ::size_t(32 + 100 * 64));
+
+				void* aligned = arena.allocate(10, 64);
+				Assert::IsTrue(reinterpret_cast<::std::uintptr_t>(aligned) % 64 == 0);
+
+				arena.release();
+				Assert::AreEqual(upstream.outstanding, ::size_t(0));
+				Assert::AreEqual(arena.bytes_allocated(), ::size_t(0));
+				Assert::AreEqual(arena.peak_bytes_allocated(), ::size_t(32 + 100 * 64 + 10));
+				Assert::IsTrue(alloc.allocate(1) == reinterpret_cast<int*>(buffer));
+
+				(void)alloc.allocate(1000);
+			}
+			Assert::AreEqual(upstream.outstanding, ::size_t(0));
+		}
+
+		TEST_METHOD(TestUnsynchronizedPool) {
+			counting_resource upstream;
+			{
+				my::pmr::pool_options options;
+				options.largest_required_pool_block = 512;
+				my::pmr::unsynchronized_pool_resource pool(options, &upstream);
+				Assert::AreEqual(pool.options().largest_required_pool_block, ::size_t(512));
+				my::pmr::polymorphic_allocator<double> alloc(&pool);
+
+				::std::vector<double*> blocks;
+				for (int i = 0; i < 1000; ++i) {
+					blocks.push_back(alloc.allocate(3));
+					blocks.back()[2] = i;
+				}
+				Assert::AreEqual(pool.bytes_allocated(), ::size_t(1000 * 24));
+				for (int i = 0; i < 1000; ++i) {
+					Assert::AreEqual(blocks[i][2], double(i));
+					alloc.deallocate(blocks[i], 3);
+				}
+				Assert::AreEqual(pool.bytes_allocated(), ::size_t(0));
+				Assert::AreEqual(pool.peak_bytes_allocated(), ::size_t(1000 * 24));
+
+				// 释放的块被复用
+				double* p = alloc.allocate(3);
+				alloc.deallocate(p, 3);
+				Assert::IsTrue(alloc.allocate(3) == p);
+				alloc.deallocate(p, 3);
+
+				// 大块与超额对齐的请求直接交给上游
+				double* large = alloc.allocate(1000);
+				void* aligned = pool.allocate(8, 128);
+				Assert::IsTrue(reinterpret_cast<::std::uintptr_t>(aligned) % 128 == 0);
+				alloc.deallocate(large, 1000);
+				(void)pool.allocate(5000);
+
+				Assert::IsTrue(my::pmr::polymorphic_allocator<int>(&pool) == alloc);
+				Assert::IsFalse(my::pmr::polymorphic_allocator<int>() == alloc);
+			}
+			Assert::AreEqual(upstream.outstanding, ::size_t(0));
+		}
+
+		TEST_METHOD(TestSynchronizedPool) {
+			my::pmr::synchronized_pool_resource pool;
+			::std::vector<::std::thread> workers;
+			for (int t = 0; t < 4; ++t) {
+				workers.emplace_back([&pool]() {
+					my::pmr::polymorphic_allocator<int> alloc(&pool);
+					for (int i = 0; i < 1000; ++i) {
+						int* p = alloc.allocate(i % 7 + 1);
+						*p = i;
+						alloc.deallocate(p, i % 7 + 1);
+					}
+				});
+			}
+			for (auto& th: workers) {
+				th.join();
+			}
+			Assert::AreEqual(pool.bytes_allocated(), ::size_t(0));
+		}
+	};
+
+	TEST_CLASS(Test_allocator_traits) {
+		// 只提供最少成员的分配器，带有额外的模板形参与 construct 钩子
+		struct tag {};
+
+		template <typename T, typename Tag>
+		struct minimal_allocator {
+			using value_type = T;
+			int* constructed;
+
+			minimal_allocator(int* counter): constructed(counter) {}
+			template <typename U>
+			minimal_allocator(const minimal_allocator<U, Tag>& other): constructed(other.constructed) {}
+
+			T* allocate(::size_t n) { return static_cast<T*>(::operator new(n * sizeof(T))); }
+			void deallocate(T* ptr, ::size_t) { ::operator delete(ptr); }
+
+			template <typename U, typename... Args>
+			void construct(U* ptr, Args&&... args) {
+				::new (static_cast<void*>(ptr)) U(my::forward<Args>(args)...);
+				++*constructed;
+			}
+		};
+
+		struct empty_allocator {
+			using value_type = int;
+			int* allocate(::size_t n) { return static_cast<int*>(::operator new(n * sizeof(int))); }
+			void deallocate(int* ptr, ::size_t) { ::operator delete(ptr); }
+		};
+
+	public:
+		TEST_METHOD(TestMemberTypes) {
+			using traits = my::allocator_traits<my::allocator<int>>;
+			static_assert(traits::is_always_equal::value, "");
+			static_assert(traits::propagate_on_container_move_assignment::value, "");
+			static_assert(!traits::propagate_on_container_copy_assignment::value, "");
+			static_assert(my::is_same<traits::pointer, int*>::value, "");
+			static_assert(my::is_same<traits::rebind_alloc<double>, my::allocator<double>>::value, "");
+			static_assert(my::is_same<traits::rebind_traits<char>::value_type, char>::value, "");
+			static_assert(my::allocator_traits<my::pool_allocator<int>>::is_always_equal::value, "");
+
+			using pmr_traits = my::allocator_traits<my::pmr::polymorphic_allocator<int>>;
+			static_assert(!pmr_traits::is_always_equal::value, "");
+			static_assert(!pmr_traits::propagate_on_container_move_assignment::value, "");
+
+			using minimal_traits = my::allocator_traits<minimal_allocator<int, tag>>;
+			static_assert(!minimal_traits::is_always_equal::value, "");
+			static_assert(my::is_same<minimal_traits::const_pointer, const int*>::value, "");
+			static_assert(my::is_same<minimal_traits::size_type, ::size_t>::value, "");
+			static_assert(my::is_same<minimal_traits::rebind_alloc<long>, minimal_allocator<long, tag>>::value, "");
+
+			static_assert(my::allocator_traits<empty_allocator>::is_always_equal::value, "");
+		}
+
+		TEST_METHOD(TestOperations) {
+			int constructed = 0;
+			minimal_allocator<::std::vector<int>, tag> alloc(&constructed);
+			using traits = my::allocator_traits<decltype(alloc)>;
+
+			::std::vector<int>* p = traits::allocate(alloc, 2, nullptr);
+			traits::construct(alloc, p, 3, 7);
+			traits::construct(alloc, p + 1);
+			Assert::AreEqual(constructed, 2);
+			Assert::AreEqual(p[0].size(), ::size_t(3));
+			Assert::AreEqual(p[0][2], 7);
+			traits::destroy(alloc, p);
+			traits::destroy(alloc, p + 1);
+			traits::deallocate(alloc, p, 2);
+
+			Assert::AreEqual(traits::max_size(alloc), static_cast<::size_t>(-1) / sizeof(::std::vector<int>));
+			Assert::AreEqual(traits::select_on_container_copy_construction(alloc).constructed, &constructed);
+
+			my::allocator<::std::vector<int>> default_alloc;
+			using default_traits = my::allocator_traits<my::allocator<::std::vector<int>>>;
+			p = default_traits::allocate(default_alloc, 1);
+			default_traits::construct(default_alloc, p, 5, 1);
+			Assert::AreEqual(p->size(), ::size_t(5));
+			default_traits::destroy(default_alloc, p);
+			default_traits::deallocate(default_alloc, p, 1);
+		}
+	};
+
+	TEST_CLASS(Test_uninitialized_memory) {
+		// 统计存活对象个数，并在第 throw_at 次构造时抛出异常
+		struct tracked {
+			static int alive;
+			static int throw_at;
+			int value;
+
+			tracked(int v = 0): value(v) { __check(); }
+			tracked(const tracked& other): value(other.value) { __check(); }
+			tracked(tracked&& other) noexcept: value(other.value) { other.value = -1; ++alive; }
+			~tracked() { --alive; }
+
+			void __check() {
+				if (throw_at > 0 && --throw_at == 0) {
+					throw 42;
+				}
+				++alive;
+			}
+		};
+
+		struct pod {
+			int a;
+			double b;
+		};
+
+	public:
+		TEST_METHOD(TestTrivial) {
+			static_assert(my::inner::__is_bitwise_constructible<const pod, pod, my::is_trivially_copy_constructible>::value, "");
+			static_assert(!my::inner::__is_bitwise_constructible<tracked, tracked, my::is_trivially_copy_constructible>::value, "");
+			static_assert(!my::inner::__is_bitwise_constructible<int, long, my::is_trivially_copy_constructible>::value, "");
+
+			pod src[4] = { { 1, 1.5 }, { 2, 2.5 }, { 3, 3.5 }, { 4, 4.5 } };
+			alignas(pod) unsigned char storage[sizeof(src)];
+			pod* dst = reinterpret_cast<pod*>(storage);
+
+			Assert::IsTrue(my::uninitialized_copy(src, src + 4, dst) == dst + 4);
+			Assert::AreEqual(dst[3].a, 4);
+			Assert::IsTrue(my::uninitialized_move(src, src + 2, dst + 2) == dst + 4);
+			Assert::AreEqual(dst[3].b, 2.5);
+			Assert::IsTrue(my::uninitialized_copy_n(static_cast<const pod*>(src), 1, dst + 3) == dst + 4);
+			Assert::AreEqual(dst[3].a, 1);
+			my::destroy(dst, dst + 4);
+
+			char bytes[16];
+			Assert::IsTrue(my::uninitialized_fill_n(bytes, 16, 'x') == bytes + 16);
+			Assert::AreEqual(bytes[15], 'x');
+
+			long longs[8];
+			my::uninitialized_fill(longs, longs + 8, 7);
+			Assert::AreEqual(longs[7], 7L);
+			my::uninitialized_value_construct(longs, longs + 8);
+			Assert::AreEqual(longs[0], 0L);
+
+			double* ptrs[4];
+			Assert::IsTrue(my::uninitialized_value_construct_n(ptrs, 4) == ptrs + 4);
+			Assert::IsTrue(ptrs[3] == nullptr);
+		}
+
+		TEST_METHOD(TestNonTrivial) {
+			tracked::alive = 0;
+			tracked::throw_at = 0;
+			tracked src[5] = { 1, 2, 3, 4, 5 };
+			alignas(tracked) unsigned char storage[sizeof(src)];
+			tracked* dst = reinterpret_cast<tracked*>(storage);
+
+			my::uninitialized_copy(src, src + 5, dst);
+			Assert::AreEqual(tracked::alive, 10);
+			Assert::AreEqual(dst[4].value, 5);
+			my::destroy(dst, dst + 5);
+			Assert::AreEqual(tracked::alive, 5);
+
+			my::uninitialized_move(src, src + 5, dst);
+			Assert::AreEqual(src[0].value, -1);
+			Assert::AreEqual(dst[0].value, 1);
+			Assert::IsTrue(my::destroy_n(dst, 5) == dst + 5);
+
+			my::uninitialized_fill_n(dst, 5, tracked(9));
+			Assert::AreEqual(dst[2].value, 9);
+			my::destroy(dst, dst + 5);
+
+			my::uninitialized_value_construct_n(dst, 5);
+			Assert::AreEqual(dst[2].value, 0);
+			my::destroy(dst, dst + 5);
+			Assert::AreEqual(tracked::alive, 5);
+		}
+
+		TEST_METHOD(TestRollback) {
+			tracked::alive = 0;
+			tracked::throw_at = 0;
+			tracked src[5] = { 1, 2, 3, 4, 5 };
+			alignas(tracked) unsigned char storage[sizeof(src)];
+			tracked* dst = reinterpret_cast<tracked*>(storage);
+
+			tracked::throw_at = 3;
+			Assert::ExpectException<int>([&]() { my::uninitialized_copy(src, src + 5, dst); });
+			Assert::AreEqual(tracked::alive, 5);
+
+			tracked::throw_at = 4;
+			Assert::ExpectException<int>([&]() { my::uninitialized_fill(dst, dst + 5, src[0]); });
+			Assert::AreEqual(tracked::alive, 5);
+
+			tracked::throw_at = 2;
+			Assert::ExpectException<int>([&]() { my::uninitialized_default_construct_n(dst, 5); });
+			Assert::AreEqual(tracked::alive, 5);
+		}
+
+		TEST_METHOD(TestRelocate) {
+			static_assert(!my::is_trivially_relocatable<tracked>::value, "");
+			static_assert(my::is_trivially_relocatable<my::unique_ptr<tracked>>::value, "");
+			static_assert(my::is_trivially_relocatable<my::shared_ptr<tracked>>::value, "");
+			static_assert(my::is_trivially_relocatable<my::pair<my::unique_ptr<int>, int>>::value, "");
+			static_assert(!my::is_trivially_relocatable<my::pair<tracked, int>>::value, "");
+
+			tracked::alive = 0;
+			tracked::throw_at = 0;
+			alignas(tracked) unsigned char storage[sizeof(tracked) * 6];
+			tracked* buffer = reinterpret_cast<tracked*>(storage);
+			for (int i = 0; i != 4; ++i) {
+				my::construct_at(buffer + i, i + 1);
+			}
+
+			// 重叠且目标在后：从后往前搬
+			Assert::IsTrue(my::relocate(buffer, buffer + 4, buffer + 2) == buffer + 6);
+			Assert::AreEqual(tracked::alive, 4);
+			Assert::AreEqual(buffer[2].value, 1);
+			Assert::AreEqual(buffer[5].value, 4);
+
+			// 重叠且目标在前：从前往后搬
+			Assert::IsTrue(my::relocate(buffer + 2, buffer + 6, buffer + 1) == buffer + 5);
+			Assert::AreEqual(buffer[1].value, 1);
+			Assert::AreEqual(buffer[4].value, 4);
+
+			Assert::IsTrue(my::relocate_at(buffer + 1, buffer) == buffer);
+			Assert::IsTrue(my::uninitialized_relocate(buffer + 2, buffer + 5, buffer + 1) == buffer + 4);
+			Assert::AreEqual(tracked::alive, 4);
+			for (int i = 0; i != 4; ++i) {
+				Assert::AreEqual(buffer[i].value, i + 1);
+			}
+			my::destroy(buffer, buffer + 4);
+			Assert::AreEqual(tracked::alive, 0);
+
+			// 可平凡重定位的类型按字节搬移，原位置不再析构
+			using handle = my::unique_ptr<tracked>;
+			alignas(handle) unsigned char handle_storage[sizeof(handle) * 4];
+			handle* handles = reinterpret_cast<handle*>(handle_storage);
+			for (int i = 0; i != 2; ++i) {
+				my::construct_at(handles + i, new tracked(i));
+			}
+			Assert::IsTrue(my::uninitialized_relocate_n(handles, 2, handles + 2) == handles + 4);
+			Assert::IsTrue(my::relocate(handles + 2, handles + 4, handles + 1) == handles + 3);
+			Assert::AreEqual(handles[1]->value, 0);
+			Assert::AreEqual(handles[2]->value, 1);
+			Assert::AreEqual(tracked::alive, 2);
+			my::destroy(handles + 1, handles + 3);
+			Assert::AreEqual(tracked::alive, 0);
+		}
+
+		TEST_METHOD(TestConstructDestroyAt) {
+			tracked::alive = 0;
+			tracked::throw_at = 0;
+			alignas(tracked) unsigned char storage[sizeof(tracked) * 2];
+			tracked* p = my::construct_at(reinterpret_cast<tracked*>(storage), 3);
+			Assert::AreEqual(p->value, 3);
+			Assert::AreEqual(tracked::alive, 1);
+			my::destroy_at(p);
+			Assert::AreEqual(tracked::alive, 0);
+
+			using pair_t = tracked[2];
+			pair_t* arr = reinterpret_cast<pair_t*>(storage);
+			my::uninitialized_default_construct_n(*arr, 2);
+			Assert::AreEqual(tracked::alive, 2);
+			my::destroy_at(arr);
+			Assert::AreEqual(tracked::alive, 0);
+		}
+	};
+
+	int Test_uninitialized_memory::tracked::alive = 0;
+	int Test_uninitialized_memory::tracked::throw_at = 0;
+
+	TEST_CLASS(Test_unique_ptr) {
+		struct counting_deleter {
+			int* count;
+			void operator()(int* p) const {
+				++*count;
+				delete p;
+			}
+		};
+
+		struct empty_deleter {
+			void operator()(int* p) const { delete p; }
+		};
+
+		struct final_deleter final {
+			void operator()(int* p) const { delete p; }
+		};
+
+		struct base { virtual ~base() = default; };
+		struct derived: base { int value = 7; };
+
+	public:
+		TEST_METHOD(TestEmptyDeleterSize) {
+			static_assert(sizeof(my::unique_ptr<int>) == sizeof(int*), "default_delete should take no space");
+			static_assert(sizeof(my::unique_ptr<int[]>) == sizeof(int*), "default_delete should take no space");
+			static_assert(sizeof(my::unique_ptr<int, empty_deleter>) == sizeof(int*), "empty deleter should take no space");
+			static_assert(sizeof(my::unique_ptr<int, counting_deleter>) == 2 * sizeof(int*), "stateful deleter is stored");
+			static_assert(sizeof(my::unique_ptr<int, final_deleter>) > sizeof(int*), "final deleter can't be a base");
+			final_deleter d;
+			my::unique_ptr<int, final_deleter> p(new int(1), d);
+			Assert::AreEqual(*p, 1);
+		}
+
+		TEST_METHOD(TestOwnership) {
+			int count = 0;
+			{
+				my::unique_ptr<int, counting_deleter> p(new int(5), counting_deleter{ &count });
+				Assert::AreEqual(*p, 5);
+				my::unique_ptr<int, counting_deleter> q(my::move(p));
+				Assert::IsFalse(static_cast<bool>(p));
+				Assert::IsTrue(q != nullptr);
+				q.reset(new int(6));
+				Assert::AreEqual(count, 1);
+				int* raw = q.release();
+				Assert::IsTrue(q == nullptr);
+				delete raw;
+				q.reset(new int(7));
+			}
+			Assert::AreEqual(count, 2);
+
+			my::unique_ptr<base> b = my::make_unique<derived>();
+			Assert::AreEqual(static_cast<derived*>(b.get())->value, 7);
+
+			my::unique_ptr<int> x = my::make_unique<int>(1), y = my::make_unique<int>(2);
+			my::swap(x, y);
+			Assert::AreEqual(*x, 2);
+			Assert::AreEqual(*y, 1);
+		}
+
+		TEST_METHOD(TestArray) {
+			my::unique_ptr<int[]> arr = my::make_unique<int[]>(8);
+			for (int i = 0; i < 8; ++i) {
+				Assert::AreEqual(arr[i], 0);
+				arr[i] = i;
+			}
+			Assert::AreEqual(arr[7], 7);
+			arr.reset();
+			Assert::IsFalse(static_cast<bool>(arr));
+		}
+
+		TEST_METHOD(TestSwapStdTypes) {
+			// 指针与删除器的类型与 std 相关时，swap 不能与 std::swap 产生歧义
+			my::unique_ptr<std::string> a = my::make_unique<std::string>("a"), b;
+			a.swap(b);
+			Assert::IsTrue(a == nullptr);
+			Assert::AreEqual(std::string("a"), *b);
+			my::swap(a, b);
+			Assert::AreEqual(std::string("a"), *a);
+
+			my::unique_ptr<std::string[]> c = my::make_unique<std::string[]>(2), d;
+			c[1] = "c";
+			c.swap(d);
+			Assert::IsFalse(static_cast<bool>(c));
+			Assert::AreEqual(std::string("c"), d[1]);
+			my::swap(c, d);
+			Assert::AreEqual(std::string("c"), c[1]);
+		}
+
+		TEST_METHOD(TestMakeUniqueForOverwrite) {
+			my::unique_ptr<double> p = my::make_unique_for_overwrite<double>();
+			*p = 1.5;
+			Assert::AreEqual(*p, 1.5);
+
+			my::unique_ptr<unsigned char[]> buf = my::make_unique_for_overwrite<unsigned char[]>(4096);
+			for (int i = 0; i < 4096; ++i) {
+				buf[i] = static_cast<unsigned char>(i);
+			}
+			Assert::AreEqual(static_cast<int>(buf[4095]), 255);
+		}
+	};
+
+	TEST_CLASS(Test_shared_ptr) {
+		struct counted {
+			static int alive;
+			int value;
+			counted(int v): value(v) { ++alive; }
+			~counted() { --alive; }
+		};
+
+		struct base { virtual ~base() = default; int tag = 1; };
+		struct derived: base { int value = 2; };
+
+		struct counting_resource: my::pmr::memory_resource {
+			int allocations = 0;
+			int live = 0;
+
+		private:
+			void* do_allocate(size_t bytes, size_t alignment) override {
+				++allocations;
+				++live;
+				return my::pmr::new_delete_resource()->allocate(bytes, alignment);
+			}
+
+			void do_deallocate(void* ptr, size_t bytes, size_t alignment) override {
+				--live;
+				my::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+			}
+
+			bool do_is_equal(const my::pmr::memory_resource& other) const noexcept override {
+				return this == &other;
+			}
+		};
+
+	public:
+		TEST_METHOD(TestOwnership) {
+			counted::alive = 0;
+			{
+				my::shared_ptr<counted> p(new counted(3));
+				Assert::AreEqual(p.use_count(), 1L);
+				{
+					my::shared_ptr<counted> q = p;
+					Assert::AreEqual(p.use_count(), 2L);
+					Assert::AreEqual(q->value, 3);
+				}
+				Assert::AreEqual(p.use_count(), 1L);
+				my::shared_ptr<counted> r(my::move(p));
+				Assert::IsTrue(p == nullptr);
+				Assert::AreEqual(counted::alive, 1);
+				r.reset();
+				Assert::AreEqual(counted::alive, 0);
+			}
+
+			int deleted = 0;
+			{
+				my::shared_ptr<int> p(new int(1), [&](int* ptr) { ++deleted; delete ptr; });
+				my::shared_ptr<int> q(p);
+			}
+			Assert::AreEqual(deleted, 1);
+
+			my::shared_ptr<base> b = my::make_shared<derived>();
+			my::shared_ptr<derived> d = my::dynamic_pointer_cast<derived>(b);
+			Assert::IsTrue(d != nullptr);
+			Assert::AreEqual(d->value, 2);
+			Assert::AreEqual(b.use_count(), 2L);
+
+			my::shared_ptr<int> alias(d, &d->value);
+			Assert::AreEqual(*alias, 2);
+			Assert::AreEqual(b.use_count(), 3L);
+
+			my::shared_ptr<int> from_unique(my::make_unique<int>(9));
+			Assert::AreEqual(*from_unique, 9);
+
+			my::shared_ptr<int[]> arr(new int[4]{ 1, 2, 3, 4 });
+			Assert::AreEqual(arr[3], 4);
+		}
+
+		TEST_METHOD(TestWeakPtr) {
+			counted::alive = 0;
+			my::weak_ptr<counted> w;
+			Assert::IsTrue(w.expired());
+			{
+				my::shared_ptr<counted> p = my::make_shared<counted>(5);
+				w = p;
+				Assert::IsFalse(w.expired());
+				Assert::AreEqual(w.lock()->value, 5);
+				Assert::AreEqual(p.use_count(), 1L);
+			}
+			Assert::AreEqual(counted::alive, 0);
+			Assert::IsTrue(w.expired());
+			Assert::IsTrue(w.lock() == nullptr);
+			Assert::ExpectException<my::bad_weak_ptr>([&]() { my::shared_ptr<counted> p(w); });
+		}
+
+		TEST_METHOD(TestSingleAllocation) {
+			counting_resource resource;
+			{
+				my::pmr::polymorphic_allocator<counted> alloc(&resource);
+				my::shared_ptr<counted> p = my::allocate_shared<counted>(alloc, 7);
+				Assert::AreEqual(p->value, 7);
+				Assert::AreEqual(resource.allocations, 1);
+
+				// 对象已销毁，但弱引用仍持有控制块所在的内存
+				my::weak_ptr<counted> w = p;
+				p.reset();
+				Assert::AreEqual(counted::alive, 0);
+				Assert::AreEqual(resource.live, 1);
+			}
+			Assert::AreEqual(resource.live, 0);
+
+			{
+				my::pmr::polymorphic_allocator<int> alloc(&resource);
+				my::shared_ptr<int> p(new int(1), my::default_delete<int>(), alloc);
+				Assert::AreEqual(resource.allocations, 2);
+			}
+			Assert::AreEqual(resource.live, 0);
+		}
+
+		TEST_METHOD(TestLocalSharedPtr) {
+			counted::alive = 0;
+			{
+				my::local_shared_ptr<counted> p = my::make_local_shared<counted>(4);
+				my::local_shared_ptr<counted> q = p;
+				my::local_weak_ptr<counted> w = q;
+				Assert::AreEqual(p.use_count(), 2L);
+				Assert::AreEqual(w.lock()->value, 4);
+				static_assert(std::is_same<decltype(p.use_count()), long>::value, "");
+			}
+			Assert::AreEqual(counted::alive, 0);
+		}
+
+		TEST_METHOD(TestConcurrentCopies) {
+			my::shared_ptr<int> p = my::make_shared<int>(0);
+			std::vector<std::thread> threads;
+			for (int t = 0; t < 4; ++t) {
+				threads.emplace_back([p]() {
+					for (int i = 0; i < 10000; ++i) {
+						my::shared_ptr<int> copy = p;
+						my::weak_ptr<int> weak = copy;
+						Assert::IsTrue(weak.lock() != nullptr);
+					}
+				});
+			}
+			for (auto& thread : threads) {
+				thread.join();
+			}
+			Assert::AreEqual(p.use_count(), 1L);
+		}
+	};
+
+	int Test_shared_ptr::counted::alive = 0;
+
+	namespace intrusive_hooks {
+		// 通过 ADL 提供钩子，而非派生自 intrusive_ref_counter
+		struct handle {
+			int refs = 0;
+			bool* destroyed;
+		};
+
+		inline void intrusive_ptr_add_ref(handle* p) {
+			++p->refs;
+		}
+
+		inline void intrusive_ptr_release(handle* p) {
+			if (--p->refs == 0) {
+				*p->destroyed = true;
+				delete p;
+			}
+		}
+	}
+
+	TEST_CLASS(Test_intrusive_ptr) {
+		struct message: my::intrusive_ref_counter<message> {
+			static int alive;
+			int id;
+			explicit message(int i): id(i) { ++alive; }
+			virtual ~message() { --alive; }
+		};
+
+		struct urgent_message: message {
+			explicit urgent_message(int i): message(i) {}
+		};
+
+		struct local_message: my::intrusive_ref_counter<local_message, my::local_ref_count_policy> {
+			int id = 0;
+		};
+
+	public:
+		TEST_METHOD(TestRefCount) {
+			static_assert(sizeof(my::intrusive_ptr<message>) == sizeof(message*), "intrusive_ptr is a single pointer");
+			message::alive = 0;
+			{
+				my::intrusive_ptr<message> p(new message(1));
+				Assert::AreEqual(p->use_count(), 1L);
+				my::intrusive_ptr<message> q = p;
+				Assert::AreEqual(p->use_count(), 2L);
+				my::intrusive_ptr<message> r(my::move(q));
+				Assert::IsTrue(q == nullptr);
+				Assert::AreEqual(p->use_count(), 2L);
+
+				// 从裸指针重新接管时，计数不会与已有的引用割裂
+				my::intrusive_ptr<message> s(r.get());
+				Assert::AreEqual(p->use_count(), 3L);
+
+				message* raw = s.detach();
+				Assert::AreEqual(p->use_count(), 3L);
+				s.reset(raw, false);
+				Assert::AreEqual(p->use_count(), 3L);
+			}
+			Assert::AreEqual(message::alive, 0);
+		}
+
+		TEST_METHOD(TestConversions) {
+			message::alive = 0;
+			{
+				my::intrusive_ptr<urgent_message> u(new urgent_message(2));
+				my::intrusive_ptr<message> m = u;
+				Assert::AreEqual(m->use_count(), 2L);
+				my::intrusive_ptr<urgent_message> back = my::dynamic_pointer_cast<urgent_message>(m);
+				Assert::IsTrue(back == u);
+				Assert::AreEqual(back->id, 2);
+			}
+			Assert::AreEqual(message::alive, 0);
+
+			my::intrusive_ptr<local_message> local(new local_message);
+			my::intrusive_ptr<local_message> copy = local;
+			Assert::AreEqual(local->use_count(), 2L);
+		}
+
+		TEST_METHOD(TestCustomHooks) {
+			bool destroyed = false;
+			{
+				my::intrusive_ptr<intrusive_hooks::handle> p(new intrusive_hooks::handle{ 0, &destroyed });
+				my::intrusive_ptr<intrusive_hooks::handle> q = p;
+				Assert::AreEqual(p->refs, 2);
+			}
+			Assert::IsTrue(destroyed);
+		}
+
+		TEST_METHOD(TestConcurrentCopies) {
+			message::alive = 0;
+			{
+				my::intrusive_ptr<message> p(new message(3));
+				std::vector<std::thread> threads;
+				for (int t = 0; t < 4; ++t) {
+					threads.emplace_back([p]() {
+						for (int i = 0; i < 10000; ++i) {
+							my::intrusive_ptr<message> copy = p;
+							Assert::AreEqual(copy->id, 3);
+						}
+					});
+				}
+				for (auto& thread : threads) {
+					thread.join();
+				}
+				Assert::AreEqual(p->use_count(), 1L);
+			}
+			Assert::AreEqual(message::alive, 0);
+		}
+	};
+
+	int Test_intrusive_ptr::message::alive = 0;
+
+	TEST_CLASS(Test_slab_allocator) {
+		struct node {
+			node* next;
+			node* prev;
+			int value;
+		};
+
+		struct alignas(64) wide_node {
+			char data[80];
+		};
+
+	public:
+		TEST_METHOD(TestDensePacking) {
+			// 专用的 BlockCount，不与其他测试共享 slab
+			using alloc_t = my::slab_allocator<node, 13>;
+			alloc_t alloc;
+			Assert::IsTrue(alloc_t::slab_capacity() >= 13);
+
+			std::vector<node*> nodes;
+			for (size_t i = 0; i < alloc_t::slab_capacity(); ++i) {
+				nodes.push_back(alloc.allocate(1));
+			}
+			// 新 slab 中的槽依次相邻
+			for (size_t i = 1; i < nodes.size(); ++i) {
+				Assert::IsTrue(reinterpret_cast<char*>(nodes[i]) - reinterpret_cast<char*>(nodes[i - 1]) == sizeof(node));
+			}
+
+			// 已满后从新的 slab 分配
+			node* extra = alloc.allocate(1);
+			alloc.deallocate(extra, 1);
+
+			// 释放的槽被优先复用
+			node* freed = nodes[5];
+			alloc.deallocate(freed, 1);
+			Assert::IsTrue(alloc.allocate(1) == freed);
+
+			for (node* p : nodes) {
+				alloc.deallocate(p, 1);
+			}
+
+			// 空 slab 被保留并在下次分配时复用
+			node* again = alloc.allocate(1);
+			Assert::IsTrue(again == nodes[0] || again == extra);
+			alloc.deallocate(again, 1);
+		}
+
+		TEST_METHOD(TestRebind) {
+			using traits = my::allocator_traits<my::slab_allocator<int>>;
+			using node_alloc_t = traits::rebind_alloc<wide_node>;
+			static_assert(std::is_same<node_alloc_t, my::slab_allocator<wide_node>>::value, "rebind keeps the slab parameters");
+
+			my::slab_allocator<int> int_alloc;
+			node_alloc_t node_alloc(int_alloc);
+			Assert::IsTrue(node_alloc == int_alloc);
+
+			std::vector<wide_node*> nodes;
+			for (int i = 0; i < 200; ++i) {
+				wide_node* p = my::allocator_traits<node_alloc_t>::allocate(node_alloc, 1);
+				Assert::IsTrue(reinterpret_cast<std::uintptr_t>(p) % 64 == 0);
+				p->data[79] = static_cast<char>(i);
+				nodes.push_back(p);
+			}
+			for (int i = 0; i < 200; ++i) {
+				Assert::IsTrue(nodes[i]->data[79] == static_cast<char>(i));
+				node_alloc.deallocate(nodes[i], 1);
+			}
+
+			// 一次分配多个对象时不经过 slab
+			int* arr = int_alloc.allocate(100);
+			arr[99] = 1;
+			int_alloc.deallocate(arr, 100);
+		}
+
+		TEST_METHOD(TestNoEmptySlabsKept) {
+			my::slab_allocator<node, 17, 0> alloc;
+			for (int round = 0; round < 3; ++round) {
+				node* a = alloc.allocate(1);
+				node* b = alloc.allocate(1);
+				alloc.deallocate(a, 1);
+				alloc.deallocate(b, 1);
+			}
+		}
+
+		TEST_METHOD(TestCrossThread) {
+			my::slab_allocator<node, 11> alloc;
+			std::vector<node*> nodes(1000);
+			std::thread producer([&]() {
+				for (node*& p : nodes) {
+					p = alloc.allocate(1);
+				}
+			});
+			producer.join();
+			std::vector<std::thread> consumers;
+			for (int t = 0; t < 4; ++t) {
+				consumers.emplace_back([&, t]() {
+					for (size_t i = t; i < nodes.size(); i += 4) {
+						alloc.deallocate(nodes[i], 1);
+					}
+				});
+			}
+			for (auto& thread : consumers) {
+				thread.join();
+			}
+		}
+	};
+
+	TEST_CLASS(Test_tracking_allocator) {
+		struct cache_tag {};
+		struct worker_tag {};
+		struct reset_tag {};
+
+		struct node {
+			node* next;
+			long payload[3];
+		};
+
+	public:
+		TEST_METHOD(TestCounters) {
+			using alloc_t = my::tracking_allocator<my::allocator<int>, cache_tag>;
+			alloc_t alloc;
+			int* a = alloc.allocate(1);
+			int* b = alloc.allocate(100);
+			int* c = alloc.allocate(1000);
+
+			my::tracking_stats stats = my::get_tracking_stats<cache_tag>();
+			Assert::AreEqual(stats.allocations, size_t(3));
+			Assert::AreEqual(stats.bytes_allocated, sizeof(int) * 1101);
+			Assert::AreEqual(stats.bytes_in_use, sizeof(int) * 1101);
+			Assert::AreEqual(stats.size_histogram[2], size_t(1));		// 4 字节
+			Assert::AreEqual(stats.size_histogram[8], size_t(1));		// 400 字节
+			Assert::AreEqual(stats.size_histogram[11], size_t(1));		// 4000 字节
+
+			alloc.deallocate(c, 1000);
+			alloc.deallocate(b, 100);
+			stats = my::get_tracking_stats<cache_tag>();
+			Assert::AreEqual(stats.deallocations, size_t(2));
+			Assert::AreEqual(stats.bytes_in_use, sizeof(int));
+			Assert::AreEqual(stats.peak_bytes_in_use, sizeof(int) * 1101);
+			alloc.deallocate(a, 1);
+
+			// 其他标签不受影响
+			Assert::AreEqual(my::get_tracking_stats<worker_tag>().allocations, size_t(0));
+		}
+
+		TEST_METHOD(TestRebind) {
+			using alloc_t = my::tracking_allocator<my::pool_allocator<int>, cache_tag>;
+			using node_alloc_t = my::allocator_traits<alloc_t>::rebind_alloc<node>;
+			static_assert(std::is_same<node_alloc_t, my::tracking_allocator<my::pool_allocator<node>, cache_tag>>::value, "");
+			static_assert(my::allocator_traits<node_alloc_t>::is_always_equal::value, "");
+
+			my::reset_tracking_stats<cache_tag>();
+			alloc_t alloc;
+			node_alloc_t node_alloc(alloc);
+			Assert::IsTrue(node_alloc == alloc);
+			node* n = node_alloc.allocate(1);
+			node_alloc.deallocate(n, 1);
+
+			my::tracking_stats stats = my::get_tracking_stats<cache_tag>();
+			Assert::AreEqual(stats.allocations, size_t(1));
+			Assert::AreEqual(stats.bytes_allocated, sizeof(node));
+		}
+
+		TEST_METHOD(TestReset) {
+			my::tracking_allocator<my::allocator<char>, reset_tag> alloc;
+			char* kept = alloc.allocate(10);
+			char* freed = alloc.allocate(20);
+			alloc.deallocate(freed, 20);
+
+			my::reset_tracking_stats<reset_tag>();
+			my::tracking_stats stats = my::get_tracking_stats<reset_tag>();
+			Assert::AreEqual(stats.allocations, size_t(0));
+			Assert::AreEqual(stats.bytes_in_use, size_t(10));
+			Assert::AreEqual(stats.peak_bytes_in_use, size_t(10));
+
+			alloc.deallocate(kept, 10);
+			stats = my::get_tracking_stats<reset_tag>();
+			Assert::AreEqual(stats.deallocations, size_t(1));
+			Assert::AreEqual(stats.bytes_in_use, size_t(0));
+		}
+
+		TEST_METHOD(TestThreads) {
+			my::tracking_allocator<my::allocator<long>, worker_tag> alloc;
+			std::vector<std::thread> threads;
+			for (int t = 0; t < 4; ++t) {
+				threads.emplace_back([alloc]() mutable {
+					for (int i = 0; i < 1000; ++i) {
+						long* p = alloc.allocate(4);
+						alloc.deallocate(p, 4);
+					}
+				});
+			}
+			for (auto& thread : threads) {
+				thread.join();
+			}
+
+			// 已退出线程的计数被保留
+			my::tracking_stats stats = my::get_tracking_stats<worker_tag>();
+			Assert::AreEqual(stats.allocations, size_t(4000));
+			Assert::AreEqual(stats.deallocations, size_t(4000));
+			Assert::AreEqual(stats.bytes_in_use, size_t(0));
+			Assert::AreEqual(stats.size_histogram[my::inner::__floor_log2(4 * sizeof(long))], size_t(4000));
+		}
+	};
+
+	TEST_CLASS(Test_inline_allocator) {
+		struct node {
+			node* next;
+			int value;
+		};
+
+	public:
+		TEST_METHOD(TestArena) {
+			my::inline_arena<256, 16> arena;
+			void* a = arena.allocate(10);
+			void* b = arena.allocate(20);
+			Assert::IsTrue(arena.owns(a) && arena.owns(b));
+			Assert::AreEqual(arena.used(), size_t(48));
+			Assert::IsTrue(reinterpret_cast<std::uintptr_t>(b) % 16 == 0);
+
+			// 只有最近一次分配被回收
+			arena.deallocate(a, 10);
+			Assert::AreEqual(arena.used(), size_t(48));
+			arena.deallocate(b, 20);
+			Assert::AreEqual(arena.used(), size_t(16));
+
+			Assert::IsTrue(arena.allocate(1000) == nullptr);
+			arena.reset();
+			Assert::AreEqual(arena.used(), size_t(0));
+		}
+
+		TEST_METHOD(TestOverflow) {
+			my::inline_arena<128> arena;
+			my::inline_allocator<int, 128> alloc(arena);
+
+			int* small = alloc.allocate(8);
+			Assert::IsTrue(arena.owns(small));
+			int* big = alloc.allocate(100);
+			Assert::IsFalse(arena.owns(big));
+			big[99] = 1;
+			alloc.deallocate(big, 100);
+			alloc.deallocate(small, 8);
+			Assert::AreEqual(arena.used(), size_t(0));
+		}
+
+		TEST_METHOD(TestExpand) {
+			my::inline_arena<256, 16> arena;
+			my::inline_allocator<int, 256, 16> alloc(arena);
+			using traits = my::allocator_traits<decltype(alloc)>;
+
+			int* first = alloc.allocate(4);
+			Assert::IsTrue(traits::expand(alloc, first, 4, 16));
+			Assert::AreEqual(size_t(64), arena.used());
+
+			// 不是最近一次分配的内存无法扩展
+			int* second = alloc.allocate(4);
+			Assert::IsFalse(traits::expand(alloc, first, 16, 32));
+			Assert::IsFalse(traits::expand(alloc, second, 4, 100));
+			alloc.deallocate(second, 4);
+			alloc.deallocate(first, 16);
+			Assert::AreEqual(size_t(0), arena.used());
+
+			// 默认分配器在同一尺寸类内扩展，不提供 expand 的分配器总是失败
+			my::allocator<char> chars;
+			char* block = chars.allocate(3);
+			Assert::IsTrue(my::allocator_traits<my::allocator<char>>::expand(chars, block, 3, 5));
+			chars.deallocate(block, 5);
+			std::allocator<int> std_alloc;
+			int* plain = std_alloc.allocate(1);
+			Assert::IsFalse(my::allocator_traits<std::allocator<int>>::expand(std_alloc, plain, 1, 2));
+			std_alloc.deallocate(plain, 1);
+		}
+
+		TEST_METHOD(TestRebind) {
+			my::inline_arena<512> arena;
+			my::inline_allocator<int, 512> int_alloc(arena);
+			using node_alloc_t = my::allocator_traits<decltype(int_alloc)>::rebind_alloc<node>;
+			static_assert(!my::allocator_traits<node_alloc_t>::is_always_equal::value, "");
+
+			node_alloc_t node_alloc(int_alloc);
+			Assert::IsTrue(&node_alloc.arena() == &arena);
+			Assert::IsTrue(node_alloc == int_alloc);
+
+			node* head = nullptr;
+			for (int i = 0; i < 10; ++i) {
+				node* n = my::allocator_traits<node_alloc_t>::allocate(node_alloc, 1);
+				n->next = head;
+				n->value = i;
+				head = n;
+			}
+			Assert::IsTrue(arena.owns(head));
+			Assert::AreEqual(head->value, 9);
+
+			my::inline_arena<512> other_arena;
+			Assert::IsFalse(node_alloc == my::inline_allocator<node, 512>(other_arena));
+		}
+	};
+}
@@ -0,0 +1,213 @@
+﻿#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "../MyTinySTL/small_vector.hpp"
+
+#include <list>
+#include <sstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Test_small_vector {
+	// 统计分配次数的分配器
+	template <typename T>
+	struct counting_allocator {
+		using value_type = T;
+
+		static int allocations;
+
+		counting_allocator() = default;
+		template <typename U>
+		counting_allocator(const counting_allocator<U>&) noexcept {}
+
+		T* allocate(size_t n) {
+			++allocations;
+			return my::allocator<T>().allocate(n);
+		}
+		void deallocate(T* ptr, size_t n) noexcept { my::allocator<T>().deallocate(ptr, n); }
+
+		bool operator==(const counting_allocator&) const noexcept { return true; }
+		bool operator!=(const counting_allocator&) const noexcept { return false; }
+	};
+
+	template <typename T>
+	int counting_allocator<T>::allocations = 0;
+
+	template <typename T, size_t N>
+	using counted_vector = my::small_vector<T, N, counting_allocator<T>>;
+
+	// 统计存活对象个数，移动构造不可按字节搬移
+	struct tracked {
+		static int alive;
+		int value;
+
+		tracked(int value = 0): value(value) { ++alive; }
+		tracked(const tracked& other): value(other.value) { ++alive; }
+		tracked(tracked&& other) noexcept: value(other.value) { other.value = -1; ++alive; }
+		tracked& operator=(const tracked&) = default;
+		tracked& operator=(tracked&&) = default;
+		~tracked() { --alive; }
+	};
+
+	int tracked::alive = 0;
+
+	TEST_CLASS(Test_small_vector_storage) {
+	public:
+		TEST_METHOD(TestInlineStorage) {
+			counting_allocator<int>::allocations = 0;
+			counted_vector<int, 4> values;
+			Assert::IsTrue(values.is_inline());
+			Assert::AreEqual(size_t(4), values.capacity());
+			for (int i = 0; i < 3; ++i) {
+				values.push_back(i);
+			}
+			values.insert(values.begin(), values.back());
+			values.erase(values.begin());
+			values.push_back(3);
+			// 不超过内联容量时不分配
+			Assert::AreEqual(0, counting_allocator<int>::allocations);
+			Assert::IsTrue(values.is_inline());
+
+			values.push_back(4);
+			Assert::AreEqual(1, counting_allocator<int>::allocations);
+			Assert::IsFalse(values.is_inline());
+			Assert::AreEqual(size_t(8), values.capacity());
+
+			values.pop_back();
+			values.shrink_to_fit();
+			Assert::IsTrue(values.is_inline());
+			Assert::AreEqual(3, values.back());
+
+			counted_vector<int, 4> filled(4, 7);
+			counted_vector<int, 4> listed{ 1, 2, 3 };
+			filled = listed;
+			Assert::AreEqual(1, counting_allocator<int>::allocations);
+			Assert::IsTrue(filled == listed);
+		}
+
+		TEST_METHOD(TestMoveBetweenCapacities) {
+			tracked::alive = 0;
+			{
+				my::small_vector<tracked, 2> heap{ 1, 2, 3, 4, 5 };
+				Assert::IsFalse(heap.is_inline());
+				const tracked* data = heap.data();
+				// 源对象的堆存储大于目标的内联容量时直接接管
+				my::small_vector<tracked, 4> stolen(my::move(heap));
+				Assert::IsTrue(stolen.data() == data);
+				Assert::IsTrue(heap.empty() && heap.is_inline());
+
+				// 否则搬入内联存储并释放源对象的堆存储，不留下容量不超过 N 的堆存储
+				my::small_vector<tracked, 8> fits(my::move(stolen));
+				Assert::IsTrue(fits.is_inline() && stolen.empty() && stolen.is_inline());
+				Assert::AreEqual(5, fits.back().value);
+
+				my::small_vector<tracked, 8> local{ 6, 7, 8 };
+				// 元素个数超过目标的内联容量时分配堆存储
+				my::small_vector<tracked, 2> spilled(my::move(local));
+				Assert::IsFalse(spilled.is_inline());
+				Assert::IsTrue(local.empty());
+				Assert::AreEqual(8, spilled.back().value);
+
+				stolen = my::move(spilled);
+				Assert::IsTrue(stolen.is_inline() && spilled.empty());
+				Assert::AreEqual(6, stolen.front().value);
+				Assert::AreEqual(8, tracked::alive);
+			}
+			Assert::AreEqual(0, tracked::alive);
+
+			// 可平凡重定位的元素在内联存储之间整体搬移
+			my::small_vector<my::unique_ptr<int>, 4> owners;
+			owners.push_back(my::unique_ptr<int>(new int(1)));
+			owners.push_back(my::unique_ptr<int>(new int(2)));
+			my::small_vector<my::unique_ptr<int>, 3> moved(my::move(owners));
+			Assert::IsTrue(moved.is_inline() && owners.empty());
+			Assert::AreEqual(2, *moved[1]);
+		}
+
+		TEST_METHOD(TestSwap) {
+			tracked::alive = 0;
+			{
+				my::small_vector<tracked, 3> a{ 1, 2 }, b{ 3 };
+				a.swap(b);
+				Assert::AreEqual(size_t(1), a.size());
+				Assert::AreEqual(3, a[0].value);
+				Assert::AreEqual(2, b[1].value);
+
+				my::small_vector<tracked, 3> heap{ 4, 5, 6, 7 };
+				const tracked* data = heap.data();
+				my::swap(a, heap);
+				Assert::IsTrue(a.data() == data && heap.is_inline());
+				Assert::AreEqual(3, heap[0].value);
+				a.swap(heap);
+				Assert::IsTrue(heap.data() == data && a.is_inline());
+
+				my::small_vector<tracked, 3> other_heap{ 8, 9, 10, 11, 12 };
+				heap.swap(other_heap);
+				Assert::IsTrue(other_heap.data() == data);
+				Assert::AreEqual(size_t(5), heap.size());
+				Assert::AreEqual(1 + 2 + 4 + 5, tracked::alive);
+			}
+			Assert::AreEqual(0, tracked::alive);
+		}
+
+		TEST_METHOD(TestZeroCapacity) {
+			static_assert(sizeof(my::small_vector<int, 0>) == sizeof(my::vector<int>), "");
+			static_assert(my::is_trivially_relocatable<my::small_vector<int, 0>>::value, "");
+			static_assert(!my::is_trivially_relocatable<my::small_vector<int, 1>>::value, "");
+
+			my::small_vector<int, 0> values;
+			Assert::IsTrue(values.is_inline() && values.data() == nullptr);
+			values.push_back(1);
+			Assert::IsFalse(values.is_inline());
+			my::small_vector<int, 4> wider(my::move(values));
+			Assert::AreEqual(1, wider[0]);
+			values = my::move(wider);
+			Assert::AreEqual(size_t(1), values.size());
+		}
+	};
+
+	TEST_CLASS(Test_small_vector_modifiers) {
+	public:
+		TEST_METHOD(TestMatchesVector) {
+			my::small_vector<std::string, 4> words{ "a", "b", "c" };
+			std::vector<std::string> expected{ "a", "b", "c" };
+			words.insert(words.begin() + 1, 2, words[2]);
+			expected.insert(expected.begin() + 1, 2, expected[2]);
+			words.emplace(words.begin(), words.back());
+			expected.emplace(expected.begin(), expected.back());
+			std::list<std::string> tail{ "p", "q" };
+			words.insert(words.begin() + 2, tail.begin(), tail.end());
+			expected.insert(expected.begin() + 2, tail.begin(), tail.end());
+			std::istringstream input("x y");
+			words.insert(words.end(), std::istream_iterator<std::string>(input), std::istream_iterator<std::string>());
+			expected.insert(expected.end(), { "x", "y" });
+			Assert::IsTrue(std::vector<std::string>(words.begin(), words.end()) == expected);
+
+			words.erase(words.begin() + 1, words.begin() + 4);
+			expected.erase(expected.begin() + 1, expected.begin() + 4);
+			words.resize(12, "z");
+			expected.resize(12, "z");
+			Assert::IsTrue(std::vector<std::string>(words.begin(), words.end()) == expected);
+
+			words.resize(2);
+			words.shrink_to_fit();
+			Assert::IsTrue(words.is_inline());
+			Assert::AreEqual(expected[1], words[1]);
+			words.assign(6, words[0]);
+			Assert::AreEqual(expected[0], words[5]);
+			words.assign({ "m" });
+			Assert::AreEqual(size_t(1), words.size());
+		}
+
+		TEST_METHOD(TestCompare) {
+			my::small_vector<int, 2> a{ 1, 2, 3 };
+			my::small_vector<int, 8> b{ 1, 2, 4 }, c{ 1, 2, 3 };
+			Assert::IsTrue(a < b && a == c && a != b && !(b <= a));
+			my::small_vector<int, 8> copied(a);
+			Assert::IsTrue(copied == a && copied.is_inline());
+		}
+	};
+}
@@ -0,0 +1,139 @@
+﻿#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "../MyTinySTL/soa_vector.hpp"
+
+#include <cstdint>
+#include <string>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Test_soa_vector {
+	// 第 throw_at 次复制构造时抛出异常
+	struct throwing_copy {
+		static int copies;
+		static int throw_at;
+		static int alive;
+
+		int value;
+
+		explicit throwing_copy(int value): value(value) { ++alive; }
+		throwing_copy(const throwing_copy& other): value(other.value) {
+			if (++copies == throw_at) {
+				throw 1;
+			}
+			++alive;
+		}
+		~throwing_copy() { --alive; }
+	};
+
+	int throwing_copy::copies = 0;
+	int throwing_copy::throw_at = -1;
+	int throwing_copy::alive = 0;
+
+	TEST_CLASS(Test_soa_vector) {
+	public:
+		TEST_METHOD(TestColumns) {
+			my::soa_vector<int, double, std::string> records;
+			for (int i = 0; i < 100; ++i) {
+				records.emplace_back(i, i * 0.5, std::to_string(i));
+			}
+			Assert::AreEqual(static_cast<std::size_t>(100), records.size());
+
+			double sum = 0;
+			for (double value: records.column<1>()) {
+				sum += value;
+			}
+			Assert::AreEqual(2475.0, sum);
+			Assert::IsTrue(records.column<0>().data() == records.data<0>());
+			Assert::AreEqual(std::string("42"), records.column<2>()[42]);
+
+			// 各列的起始地址按元素类型对齐
+			my::soa_vector<char, long double, std::int16_t> aligned(3);
+			Assert::AreEqual(static_cast<std::uintptr_t>(0), reinterpret_cast<std::uintptr_t>(aligned.data<1>()) % alignof(long double));
+			Assert::AreEqual(static_cast<std::uintptr_t>(0), reinterpret_cast<std::uintptr_t>(aligned.data<2>()) % alignof(std::int16_t));
+			Assert::AreEqual(0, static_cast<int>(aligned.column<2>()[2]));
+		}
+
+		TEST_METHOD(TestRows) {
+			my::soa_vector<int, std::string> records;
+			records.push_back(1, std::string("one"));
+			records.push_back(my::make_tuple(2, std::string("two")));
+			records.push_back(records[0]);
+
+			my::get<0>(records[2]) = 3;
+			Assert::AreEqual(3, records.data<0>()[2]);
+			Assert::AreEqual(std::string("one"), my::get<1>(records.back()));
+
+			int total = 0;
+			for (auto row: records) {
+				total += my::get<0>(row);
+			}
+			Assert::AreEqual(6, total);
+
+			const auto& view = records;
+			auto it = view.begin() + 1;
+			Assert::AreEqual(std::string("two"), my::get<1>(*it));
+			Assert::AreEqual(static_cast<std::ptrdiff_t>(3), view.end() - view.begin());
+
+			records.pop_back();
+			Assert::AreEqual(static_cast<std::size_t>(2), records.size());
+			Assert::ExpectException<std::out_of_range>([&] { (void)records.at(2); });
+		}
+
+		TEST_METHOD(TestCopyMoveResize) {
+			my::soa_vector<int, std::string> records;
+			for (int i = 0; i < 20; ++i) {
+				records.emplace_back(i, std::string(40, static_cast<char>('a' + i)));
+			}
+
+			my::soa_vector<int, std::string> copy = records;
+			Assert::AreEqual(records.size(), copy.size());
+			Assert::AreEqual(my::get<1>(records[19]), my::get<1>(copy[19]));
+
+			my::soa_vector<int, std::string> moved = my::move(copy);
+			Assert::IsTrue(copy.empty());
+			Assert::AreEqual(19, my::get<0>(moved.back()));
+
+			moved.resize(5);
+			moved.shrink_to_fit();
+			Assert::AreEqual(static_cast<std::size_t>(5), moved.capacity());
+			moved.resize(8);
+			Assert::AreEqual(std::string(), my::get<1>(moved[7]));
+
+			copy = moved;
+			copy.swap(records);
+			Assert::AreEqual(static_cast<std::size_t>(8), records.size());
+			records.clear();
+			Assert::IsTrue(records.empty());
+		}
+
+		TEST_METHOD(TestExceptionSafety) {
+			throwing_copy::copies = 0;
+			throwing_copy::throw_at = -1;
+			{
+				my::soa_vector<std::string, throwing_copy> records;
+				records.reserve(4);
+				for (int i = 0; i < 4; ++i) {
+					records.emplace_back(std::to_string(i), throwing_copy(i));
+				}
+
+				// 扩容时第二列复制失败，容器保持原状
+				throwing_copy::throw_at = throwing_copy::copies + 3;
+				bool thrown = false;
+				try {
+					records.emplace_back(std::string("4"), throwing_copy(4));
+				}
+				catch (int) {
+					thrown = true;
+				}
+				Assert::IsTrue(thrown);
+				Assert::AreEqual(static_cast<std::size_t>(4), records.size());
+				Assert::AreEqual(static_cast<std::size_t>(4), records.capacity());
+				Assert::AreEqual(std::string("3"), my::get<0>(records[3]));
+				Assert::AreEqual(4, throwing_copy::alive);
+			}
+			Assert::AreEqual(0, throwing_copy::alive);
+		}
+	};
+}
@@ -0,0 +1,184 @@
+﻿#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "../MyTinySTL/tuple.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Test_tuple {
+	struct empty_tag {};
+	struct other_empty_tag {};
+
+	struct explicit_from_int {
+		explicit explicit_from_int(int value): value(value) {}
+		int value;
+	};
+
+	template <std::size_t... Is>
+	my::tuple<decltype(Is)...> make_wide_tuple(my::index_sequence<Is...>) {
+		return my::tuple<decltype(Is)...>(Is...);
+	}
+
+	struct point {
+		point(int x, int y): x(x), y(y) {}
+		int x, y;
+	};
+
+	TEST_CLASS(Test_tuple_layout) {
+	public:
+		TEST_METHOD(TestPadding) {
+			using mixed = my::tuple<char, double, char, int>;
+			static_assert(sizeof(mixed) == 16, "elements should be reordered by alignment");
+			static_assert(sizeof(my::tuple<char, std::int64_t, char, std::int16_t, char>) == 16, "");
+			static_assert(sizeof(my::tuple<int*, empty_tag>) == sizeof(int*), "empty elements should take no space");
+			static_assert(sizeof(my::tuple<empty_tag, int, other_empty_tag>) == sizeof(int), "");
+
+			mixed value('a', 1.5, 'b', 7);
+			Assert::AreEqual('a', my::get<0>(value));
+			Assert::AreEqual(1.5, my::get<1>(value));
+			Assert::AreEqual('b', my::get<2>(value));
+			Assert::AreEqual(7, my::get<3>(value));
+			static_assert(my::is_same<my::tuple_element_t<2, mixed>, char>::value, "declared order should be kept");
+			static_assert(my::tuple_size<mixed>::value == 4, "");
+		}
+
+		TEST_METHOD(TestTriviality) {
+			using mixed = my::tuple<char, double, char, int>;
+			static_assert(my::is_trivially_copyable<mixed>::value, "tuple of trivial types should be trivially copyable");
+			static_assert(my::is_trivially_destructible<mixed>::value, "");
+			static_assert(my::is_trivially_default_constructible<mixed>::value, "");
+			static_assert(!my::is_trivially_copyable<my::tuple<int, std::string>>::value, "");
+
+			mixed source('x', 2.5, 'y', 9);
+			mixed target{};
+			Assert::AreEqual(0, my::get<3>(target));
+			std::memcpy(&target, &source, sizeof(mixed));
+			Assert::IsTrue(target == source);
+		}
+	};
+
+	TEST_CLASS(Test_tuple_operations) {
+	public:
+		TEST_METHOD(TestConstruction) {
+			static_assert(my::is_convertible<my::tuple<int, int>, my::tuple<long, double>>::value, "implicit conversion expected");
+			static_assert(!my::is_convertible<my::tuple<int>, my::tuple<explicit_from_int>>::value, "conversion should be explicit");
+
+			my::tuple<long, double> converted = my::tuple<int, int>(3, 4);
+			Assert::AreEqual(3L, my::get<0>(converted));
+
+			my::tuple<explicit_from_int, std::string> wrapped(5, "five");
+			Assert::AreEqual(5, my::get<0>(wrapped).value);
+			Assert::AreEqual(std::string("five"), my::get<std::string>(wrapped));
+
+			my::tuple<int, double> from_pair = my::make_pair(1, 2.0);
+			Assert::AreEqual(2.0, my::get<double>(from_pair));
+
+			my::tuple<int> inner(3);
+			my::tuple<my::tuple<int>> nested(inner);
+			Assert::AreEqual(3, my::get<0>(my::get<0>(nested)));
+
+			my::tuple<std::string, int> moved_from("text", 1);
+			my::tuple<std::string, int> moved(my::move(moved_from));
+			Assert::AreEqual(std::string("text"), my::get<0>(moved));
+			std::string taken = my::get<0>(my::move(moved));
+			Assert::AreEqual(std::string("text"), taken);
+
+			auto made = my::make_tuple("c-string", 7);
+			static_assert(my::is_same<decltype(made), my::tuple<const char*, int>>::value, "make_tuple should decay");
+
+			#if __HAS_CPP14
+			constexpr my::tuple<int, char> compile_time(1, 'c');
+			static_assert(my::get<1>(compile_time) == 'c', "");
+			#endif // __HAS_CPP14
+		}
+
+		TEST_METHOD(TestReferencesAndAssignment) {
+			int number = 0;
+			std::string text;
+			my::tie(number, text) = my::make_tuple(5, std::string("tied"));
+			Assert::AreEqual(5, number);
+			Assert::AreEqual(std::string("tied"), text);
+
+			my::tie(number, my::ignore) = my::make_pair(9, 1.0);
+			Assert::AreEqual(9, number);
+
+			auto refs = my::forward_as_tuple(number, text);
+			my::get<0>(refs) = 11;
+			Assert::AreEqual(11, number);
+
+			my::tuple<long, std::string> assigned;
+			assigned = my::make_tuple(4, "four");
+			Assert::AreEqual(4L, my::get<0>(assigned));
+			assigned = my::make_pair(6, std::string("six"));
+			Assert::AreEqual(std::string("six"), my::get<1>(assigned));
+		}
+
+		TEST_METHOD(TestSwapAndCompare) {
+			my::tuple<int, std::string> lhs(1, "b");
+			my::tuple<int, std::string> rhs(1, "c");
+			Assert::IsTrue(lhs < rhs);
+			Assert::IsTrue(lhs <= rhs);
+			Assert::IsTrue(rhs > lhs);
+			Assert::IsTrue(lhs != rhs);
+			Assert::IsFalse(lhs == rhs);
+
+			my::swap(lhs, rhs);
+			Assert::AreEqual(std::string("c"), my::get<1>(lhs));
+			Assert::IsTrue(lhs >= rhs);
+			Assert::IsTrue(my::tuple<>() == my::tuple<>());
+		}
+	};
+
+	TEST_CLASS(Test_tuple_algorithms) {
+	public:
+		TEST_METHOD(TestTupleCat) {
+			my::tuple<int, std::string> head(1, "one");
+			auto joined = my::tuple_cat(head, my::make_pair(2.5, 'c'), my::tuple<>(), my::make_tuple(std::string("tail")));
+			static_assert(my::is_same<decltype(joined), my::tuple<int, std::string, double, char, std::string>>::value, "");
+			Assert::AreEqual(1, my::get<0>(joined));
+			Assert::AreEqual(std::string("one"), my::get<1>(joined));
+			Assert::AreEqual('c', my::get<3>(joined));
+			Assert::AreEqual(std::string("tail"), my::get<4>(joined));
+
+			my::tuple<std::string> source("moved");
+			auto moved = my::tuple_cat(my::move(source));
+			Assert::AreEqual(std::string("moved"), my::get<0>(moved));
+
+			static_assert(my::is_same<decltype(my::tuple_cat()), my::tuple<>>::value, "");
+		}
+
+		TEST_METHOD(TestWideTuple) {
+			auto wide = make_wide_tuple(my::make_index_sequence<50>());
+			static_assert(my::tuple_size<decltype(wide)>::value == 50, "");
+			Assert::AreEqual(static_cast<std::size_t>(49), my::get<49>(wide));
+
+			auto wider = my::tuple_cat(wide, wide);
+			static_assert(my::tuple_size<decltype(wider)>::value == 100, "");
+			Assert::AreEqual(static_cast<std::size_t>(0), my::get<50>(wider));
+			Assert::AreEqual(static_cast<std::size_t>(49), my::get<99>(wider));
+		}
+
+		TEST_METHOD(TestApplyAndMakeFromTuple) {
+			my::tuple<int, std::string> args(2, "abc");
+			int result = my::apply([](int count, const std::string& text) { return count * static_cast<int>(text.size()); }, args);
+			Assert::AreEqual(6, result);
+
+			point made = my::make_from_tuple<point>(my::make_pair(3, 4));
+			Assert::AreEqual(4, made.y);
+		}
+
+		TEST_METHOD(TestPiecewiseConstruction) {
+			my::pair<std::string, point> built(my::piecewise_construct, my::forward_as_tuple(3, 'z'), my::make_tuple(5, 6));
+			Assert::AreEqual(std::string("zzz"), built.first);
+			Assert::AreEqual(6, built.second.y);
+
+			my::compressed_pair<std::string, int> compressed(my::piecewise_construct, my::make_tuple(2, 'q'), my::tuple<>());
+			Assert::AreEqual(std::string("qq"), compressed.first());
+			Assert::AreEqual(0, compressed.second());
+		}
+	};
+}
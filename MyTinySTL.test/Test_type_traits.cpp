@@ -912,4 +912,37 @@ namespace Test_type_traits {
 		static_assert(!my::is_nothrow_destructible<A>::value, "");
 		static_assert(!my::is_destructible<B>::value, "");
 	};
+
+	TEST_CLASS(Test_is_trivially_relocatable) {
+	private:
+		struct Pod {
+			int a;
+			double b;
+		};
+		struct Handle {
+			using is_trivially_relocatable = my::true_type;
+			int* ptr;
+			Handle(Handle&& other) noexcept: ptr(other.ptr) { other.ptr = nullptr; }
+			~Handle() {}
+		};
+		struct SelfReferencing {
+			using is_trivially_relocatable = my::false_type;
+			SelfReferencing* self = this;
+		};
+		struct NonTrivial {
+			~NonTrivial() {}
+		};
+	public:
+		static_assert(my::is_trivially_relocatable<int>::value, "");
+		static_assert(my::is_trivially_relocatable<int*>::value, "");
+		static_assert(my::is_trivially_relocatable<Pod>::value, "");
+		static_assert(my::is_trivially_relocatable<Pod[3]>::value, "");
+		static_assert(!my::is_trivially_relocatable<void>::value, "");
+		static_assert(!my::is_trivially_relocatable<NonTrivial>::value, "");
+		static_assert(!my::is_trivially_relocatable<NonTrivial[2]>::value, "");
+
+		static_assert(my::is_trivially_relocatable<Handle>::value, "");
+		static_assert(my::is_trivially_relocatable<Handle[2]>::value, "");
+		static_assert(!my::is_trivially_relocatable<SelfReferencing>::value, "");
+	};
 }
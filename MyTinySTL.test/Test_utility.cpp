@@ -0,0 +1,280 @@
+﻿#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "../MyTinySTL/utility.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Test_utility {
+	struct explicit_from_int {
+		explicit explicit_from_int(int value): value(value) {}
+		int value;
+	};
+
+	#if __HAS_CPP20
+	constexpr int swap_in_constant_evaluation() {
+		int left[3] = { 1, 2, 3 };
+		int right[3] = { 4, 5, 6 };
+		my::swap(left, right);
+		return left[0] * 100 + right[2];
+	}
+	#endif // __HAS_CPP20
+
+	struct empty_policy {
+		int operator()(int value) const { return value * 2; }
+	};
+
+	struct other_empty_policy {};
+
+	struct final_policy final {};
+
+	struct counting_policy {
+		explicit counting_policy(int count): count(count) {}
+		int count;
+	};
+
+	// 可平凡复制但不可赋值，只能通过自定义的 swap 交换
+	struct unassignable {
+		static int swaps;
+		int value;
+
+		unassignable& operator=(const unassignable&) = delete;
+
+		friend void swap(unassignable& left, unassignable& right) noexcept {
+			const int temp = left.value;
+			left.value = right.value;
+			right.value = temp;
+			++swaps;
+		}
+	};
+
+	int unassignable::swaps = 0;
+
+	TEST_CLASS(Test_pair) {
+	public:
+		TEST_METHOD(TestTriviality) {
+			using int_pair = my::pair<int, int>;
+			using mixed_pair = my::pair<std::uint64_t, double>;
+			using string_pair = my::pair<std::string, int>;
+
+			static_assert(my::is_trivially_copyable<int_pair>::value, "pair<int, int> should be trivially copyable");
+			static_assert(my::is_trivially_copyable<mixed_pair>::value, "pair<uint64_t, double> should be trivially copyable");
+			static_assert(my::is_trivially_default_constructible<int_pair>::value, "pair<int, int> should be trivially default constructible");
+			static_assert(my::is_trivially_destructible<mixed_pair>::value, "pair<uint64_t, double> should be trivially destructible");
+			static_assert(my::is_trivial<int_pair>::value, "pair<int, int> should be trivial");
+			static_assert(!my::is_trivially_copyable<string_pair>::value, "pair<string, int> should not be trivially copyable");
+			static_assert(!my::is_trivially_destructible<string_pair>::value, "pair<string, int> should not be trivially destructible");
+			static_assert(sizeof(int_pair) == 2 * sizeof(int), "pair should add no storage");
+
+			int_pair source(1, 2);
+			int_pair target{};
+			Assert::AreEqual(0, target.first);
+			Assert::AreEqual(0, target.second);
+			std::memcpy(&target, &source, sizeof(int_pair));
+			Assert::IsTrue(target == source);
+		}
+
+		TEST_METHOD(TestConstruction) {
+			static_assert(my::is_convertible<int, my::pair<long, double>>::value == false, "");
+			static_assert(my::is_convertible<my::pair<int, int>, my::pair<long, double>>::value, "implicit conversion expected");
+			static_assert(!my::is_convertible<my::pair<int, int>, my::pair<explicit_from_int, int>>::value, "conversion should be explicit");
+			static_assert(my::is_constructible<my::pair<explicit_from_int, int>, my::pair<int, int>>::value, "explicit conversion expected");
+
+			my::pair<long, double> converted = my::pair<int, int>(3, 4);
+			Assert::AreEqual(3L, converted.first);
+			Assert::AreEqual(4.0, converted.second);
+
+			my::pair<explicit_from_int, int> wrapped(my::pair<int, int>(5, 6));
+			Assert::AreEqual(5, wrapped.first.value);
+
+			my::pair<std::string, int> moved_from("text", 1);
+			my::pair<std::string, int> moved(my::move(moved_from));
+			Assert::AreEqual(std::string("text"), moved.first);
+
+			auto made = my::make_pair("c-string", 7);
+			static_assert(my::is_same<decltype(made), my::pair<const char*, int>>::value, "make_pair should decay");
+		}
+
+		TEST_METHOD(TestReferenceMembers) {
+			int a = 1, b = 2;
+			my::pair<int&, int&> refs(a, b);
+			refs = my::pair<int, int>(10, 20);
+			Assert::AreEqual(10, a);
+			Assert::AreEqual(20, b);
+
+			int c = 30, d = 40;
+			my::pair<int&, int&> other(c, d);
+			refs = other;
+			Assert::AreEqual(30, a);
+			Assert::AreEqual(40, b);
+			Assert::AreEqual(&a, &refs.first);
+		}
+
+		TEST_METHOD(TestSwapCompareGet) {
+			my::pair<int, std::string> lhs(1, "one");
+			my::pair<int, std::string> rhs(2, "two");
+			Assert::IsTrue(lhs < rhs);
+			Assert::IsTrue(lhs <= rhs);
+			Assert::IsTrue(rhs > lhs);
+			Assert::IsTrue(lhs != rhs);
+
+			my::swap(lhs, rhs);
+			Assert::AreEqual(2, lhs.first);
+			Assert::AreEqual(std::string("one"), rhs.second);
+			Assert::IsTrue(rhs >= my::pair<int, std::string>(1, "one"));
+
+			my::get<0>(lhs) = 5;
+			Assert::AreEqual(5, lhs.first);
+			Assert::AreEqual(std::string("two"), my::get<std::string>(lhs));
+			std::string taken = my::get<1>(my::move(lhs));
+			Assert::AreEqual(std::string("two"), taken);
+			static_assert(my::tuple_size<const my::pair<int, char>>::value == 2, "");
+			static_assert(my::is_same<my::tuple_element_t<1, const my::pair<int, char>>, const char>::value, "");
+		}
+	};
+
+	TEST_CLASS(Test_compressed_pair) {
+	public:
+		TEST_METHOD(TestSize) {
+			static_assert(sizeof(my::compressed_pair<int*, empty_policy>) == sizeof(int*), "empty second member should take no space");
+			static_assert(sizeof(my::compressed_pair<empty_policy, int*>) == sizeof(int*), "empty first member should take no space");
+			static_assert(my::is_empty<my::compressed_pair<empty_policy, other_empty_policy>>::value, "two empty members should stay empty");
+			static_assert(sizeof(my::compressed_pair<int*, my::compressed_pair<empty_policy, other_empty_policy>>) == sizeof(int*), "nested empty pair should take no space");
+			static_assert(sizeof(my::compressed_pair<int*, final_policy>) > sizeof(int*), "final classes cannot be empty bases");
+			static_assert(my::is_trivially_copyable<my::compressed_pair<int, empty_policy>>::value, "compressed_pair of trivial types should be trivially copyable");
+		}
+
+		TEST_METHOD(TestAccess) {
+			my::compressed_pair<int, empty_policy> defaulted;
+			Assert::AreEqual(0, defaulted.first());
+			Assert::AreEqual(6, defaulted.second()(3));
+
+			my::compressed_pair<std::string, counting_policy> lhs("left", counting_policy(1));
+			my::compressed_pair<std::string, counting_policy> rhs("right", counting_policy(2));
+			my::swap(lhs, rhs);
+			Assert::AreEqual(std::string("right"), lhs.first());
+			Assert::AreEqual(1, rhs.second().count);
+
+			my::compressed_pair<empty_policy, empty_policy> same;
+			Assert::IsTrue(static_cast<void*>(&same.first()) != static_cast<void*>(&same.second()));
+
+			int target = 1;
+			my::compressed_pair<int&, empty_policy> ref(target, empty_policy());
+			ref.first() = 5;
+			Assert::AreEqual(5, target);
+		}
+	};
+
+	TEST_CLASS(Test_swap_ranges) {
+	public:
+		TEST_METHOD(TestBulkSwap) {
+			static_assert(my::inner::__is_bulk_swappable<int*, int*>::value, "int ranges should be swapped in blocks");
+			static_assert(!my::inner::__is_bulk_swappable<std::string*, std::string*>::value, "string ranges must be swapped element-wise");
+
+			// 非 64 的倍数，覆盖各种块大小与末尾的单字节
+			unsigned char left_bytes[203], right_bytes[203];
+			for (int i = 0; i < 203; ++i) {
+				left_bytes[i] = static_cast<unsigned char>(i);
+				right_bytes[i] = static_cast<unsigned char>(255 - i);
+			}
+			unsigned char* end = my::swap_ranges(left_bytes + 1, left_bytes + 202, right_bytes + 1);
+			Assert::IsTrue(end == right_bytes + 202);
+			Assert::AreEqual(0, static_cast<int>(left_bytes[0]));
+			Assert::AreEqual(255 - 202, static_cast<int>(right_bytes[202]));
+			for (int i = 1; i < 202; ++i) {
+				Assert::AreEqual(255 - i, static_cast<int>(left_bytes[i]));
+				Assert::AreEqual(i, static_cast<int>(right_bytes[i]));
+			}
+
+			my::pair<int, double> left_pairs[37], right_pairs[37];
+			for (int i = 0; i < 37; ++i) {
+				left_pairs[i] = my::pair<int, double>(i, i * 0.5);
+				right_pairs[i] = my::pair<int, double>(-i, -i * 0.5);
+			}
+			my::swap(left_pairs, right_pairs);
+			for (int i = 0; i < 37; ++i) {
+				Assert::AreEqual(-i, left_pairs[i].first);
+				Assert::AreEqual(i * 0.5, right_pairs[i].second);
+			}
+
+			int left_grid[3][5] = {}, right_grid[3][5] = {};
+			right_grid[2][4] = 7;
+			my::swap(left_grid, right_grid);
+			Assert::AreEqual(7, left_grid[2][4]);
+			Assert::AreEqual(0, right_grid[2][4]);
+
+			#if __HAS_CPP20
+			static_assert(swap_in_constant_evaluation() == 403, "array swap should stay usable in constant evaluation");
+			#endif // __HAS_CPP20
+		}
+
+		TEST_METHOD(TestElementwiseSwap) {
+			std::string left[4] = { "a", "b", "c", "a long string that does not fit in the small buffer" };
+			std::string right[4] = { "w", "x", "y", "z" };
+			my::swap(left, right);
+			Assert::AreEqual(std::string("w"), left[0]);
+			Assert::AreEqual(std::string("a long string that does not fit in the small buffer"), right[3]);
+
+			std::string* end = my::swap_ranges(left, left + 2, right + 2);
+			Assert::IsTrue(end == right + 4);
+			Assert::AreEqual(std::string("c"), left[0]);
+			Assert::AreEqual(std::string("x"), right[3]);
+		}
+
+		TEST_METHOD(TestUnassignableSwap) {
+			static_assert(std::is_trivially_copyable<unassignable>::value, "");
+			unassignable left[3] = { { 1 }, { 2 }, { 3 } };
+			unassignable right[3] = { { 4 }, { 5 }, { 6 } };
+			unassignable::swaps = 0;
+			// 不能按字节整块交换，逐个调用自定义的 swap
+			my::swap_ranges(left, left + 3, right);
+			Assert::AreEqual(3, unassignable::swaps);
+			Assert::AreEqual(4, left[0].value);
+			Assert::AreEqual(3, right[2].value);
+		}
+	};
+
+	TEST_CLASS(Test_integer_sequence) {
+	public:
+		template <typename T, T... Ints>
+		static T sum(my::integer_sequence<T, Ints...>) {
+			T total = 0;
+			for (T value : { static_cast<T>(0), Ints... }) {
+				total += value;
+			}
+			return total;
+		}
+
+		TEST_METHOD(TestMakeSequence) {
+			static_assert(my::is_same<my::make_index_sequence<0>, my::index_sequence<>>::value, "");
+			static_assert(my::is_same<my::make_index_sequence<1>, my::index_sequence<0>>::value, "");
+			static_assert(my::is_same<my::make_integer_sequence<int, 5>, my::integer_sequence<int, 0, 1, 2, 3, 4>>::value, "");
+			static_assert(my::is_same<my::index_sequence_for<int, char, double>, my::index_sequence<0, 1, 2>>::value, "");
+			static_assert(my::make_index_sequence<1000>::size() == 1000, "");
+
+			Assert::AreEqual(static_cast<std::size_t>(4950), sum(my::make_index_sequence<100>()));
+			Assert::AreEqual(static_cast<long long>(2999 * 3000 / 2), sum(my::make_integer_sequence<long long, 3000>()));
+		}
+
+		TEST_METHOD(TestTypeList) {
+			using list = my::type_list<int, char, double, char>;
+			static_assert(list::size() == 4, "");
+			static_assert(my::is_same<my::type_at_t<0, list>, int>::value, "");
+			static_assert(my::is_same<my::type_at_t<3, list>, char>::value, "");
+			static_assert(my::index_of<double, list>::value == 2, "");
+			static_assert(my::index_of<char, list>::value == 1, "first occurrence expected");
+			static_assert(my::index_of<float, list>::value == 4, "missing types map to the list size");
+			static_assert(my::index_of<int, my::type_list<>>::value == 0, "");
+
+			static_assert(my::is_any_of<int, char, int>::value, "");
+			static_assert(!my::is_any_of<int, char, long>::value, "");
+			static_assert(!my::is_any_of<int>::value, "");
+			static_assert(my::is_integral<unsigned long long>::value && !my::is_integral<float>::value, "");
+			Assert::IsTrue(my::is_floating_point<const double>::value);
+		}
+	};
+}
@@ -0,0 +1,263 @@
+﻿#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "../MyTinySTL/vector.hpp"
+
+#include <list>
+#include <sstream>
+#include <iterator>
+#include <string>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Test_vector {
+	// 记录移动构造次数，并声明可按字节搬移
+	struct relocatable_handle {
+		using is_trivially_relocatable = my::true_type;
+
+		static int moves;
+		int* resource;
+
+		explicit relocatable_handle(int value): resource(new int(value)) {}
+		relocatable_handle(relocatable_handle&& other) noexcept: resource(other.resource) {
+			other.resource = nullptr;
+			++moves;
+		}
+		relocatable_handle& operator=(relocatable_handle&& other) noexcept {
+			my::swap(resource, other.resource);
+			return *this;
+		}
+		~relocatable_handle() { delete resource; }
+	};
+
+	int relocatable_handle::moves = 0;
+
+	// 移动构造可能抛出异常且可复制，扩容时应复制；第 limit 次复制抛出异常
+	struct throwing_copy {
+		static int copies;
+		static int limit;
+		std::string value;
+
+		explicit throwing_copy(std::string value): value(std::move(value)) {}
+		throwing_copy(const throwing_copy& other): value(other.value) {
+			if (++copies == limit) {
+				throw 0;
+			}
+		}
+		throwing_copy(throwing_copy&& other): value(std::move(other.value)) {}
+		throwing_copy& operator=(const throwing_copy&) = default;
+		throwing_copy& operator=(throwing_copy&&) = default;
+	};
+
+	int throwing_copy::copies = 0;
+	int throwing_copy::limit = 0;
+
+	// 定制 construct 的分配器，vector 不能绕过它按字节搬移元素
+	template <typename T>
+	struct counting_allocator {
+		using value_type = T;
+
+		static int constructs;
+
+		counting_allocator() = default;
+		template <typename U>
+		counting_allocator(const counting_allocator<U>&) noexcept {}
+
+		T* allocate(size_t n) { return my::allocator<T>().allocate(n); }
+		void deallocate(T* ptr, size_t n) noexcept { my::allocator<T>().deallocate(ptr, n); }
+
+		template <typename U, typename... Args>
+		void construct(U* ptr, Args&&... args) {
+			++constructs;
+			::new (static_cast<void*>(ptr)) U(my::forward<Args>(args)...);
+		}
+
+		bool operator==(const counting_allocator&) const noexcept { return true; }
+		bool operator!=(const counting_allocator&) const noexcept { return false; }
+	};
+
+	template <typename T>
+	int counting_allocator<T>::constructs = 0;
+
+	struct slow_growth {
+		int value;
+	};
+}
+
+namespace my {
+	template <>
+	struct vector_growth_factor<Test_vector::slow_growth> {
+		static constexpr ::size_t numerator = 3;
+		static constexpr ::size_t denominator = 2;
+	};
+}
+
+namespace Test_vector {
+	TEST_CLASS(Test_vector_basics) {
+	public:
+		TEST_METHOD(TestConstruction) {
+			my::vector<int> empty;
+			Assert::IsTrue(empty.empty() && empty.capacity() == 0 && empty.data() == nullptr);
+
+			my::vector<int> zeros(5);
+			Assert::AreEqual(size_t(5), zeros.size());
+			Assert::AreEqual(0, zeros[4]);
+
+			my::vector<std::string> filled(3, "ab");
+			Assert::AreEqual(std::string("ab"), filled.back());
+
+			std::istringstream input("1 2 3 4");
+			my::vector<int> from_stream((std::istream_iterator<int>(input)), std::istream_iterator<int>());
+			Assert::AreEqual(size_t(4), from_stream.size());
+
+			my::vector<int> listed{ 1, 2, 3 };
+			my::vector<int> copied(listed);
+			my::vector<int> moved(my::move(copied));
+			Assert::IsTrue(copied.empty());
+			Assert::IsTrue(moved == listed);
+
+			copied = moved;
+			listed = { 7 };
+			listed = my::move(copied);
+			Assert::AreEqual(size_t(3), listed.size());
+			Assert::AreEqual(3, listed.at(2));
+
+			bool thrown = false;
+			try {
+				(void)listed.at(3);
+			}
+			catch (const std::out_of_range&) {
+				thrown = true;
+			}
+			Assert::IsTrue(thrown);
+		}
+
+		TEST_METHOD(TestModifiers) {
+			my::vector<std::string> words{ "a", "b", "c" };
+			words.insert(words.begin() + 1, 2, words[2]);
+			words.emplace(words.begin(), words.back());
+			words.insert(words.end(), { "x", "y" });
+			std::list<std::string> tail{ "p", "q" };
+			words.insert(words.begin() + 2, tail.begin(), tail.end());
+			// c a p q c c b c x y
+			Assert::AreEqual(size_t(10), words.size());
+			Assert::AreEqual(std::string("c"), words[0]);
+			Assert::AreEqual(std::string("q"), words[3]);
+			Assert::AreEqual(std::string("b"), words[6]);
+
+			words.erase(words.begin() + 1, words.begin() + 4);
+			words.erase(words.begin());
+			Assert::AreEqual(std::string("c"), words.front());
+			Assert::AreEqual(size_t(6), words.size());
+
+			words.resize(8, words.front());
+			Assert::AreEqual(std::string("c"), words.back());
+			words.resize(2);
+			words.pop_back();
+			Assert::AreEqual(size_t(1), words.size());
+
+			words.assign(4, "z");
+			Assert::AreEqual(std::string("z"), words[3]);
+			words.clear();
+			Assert::IsTrue(words.empty());
+		}
+
+		TEST_METHOD(TestCompare) {
+			my::vector<int> a{ 1, 2, 3 }, b{ 1, 2, 4 }, c{ 1, 2 };
+			Assert::IsTrue(a < b && c < a && a != b && !(a > b));
+			my::vector<unsigned char> bytes1{ 1, 200 }, bytes2{ 2 };
+			Assert::IsTrue(bytes1 < bytes2);
+			my::vector<std::string> s1{ "a", "b" }, s2{ "a", "b" };
+			Assert::IsTrue(s1 == s2 && s1 <= s2);
+		}
+	};
+
+	TEST_CLASS(Test_vector_growth) {
+	public:
+		TEST_METHOD(TestRelocation) {
+			relocatable_handle::moves = 0;
+			my::vector<relocatable_handle> handles;
+			for (int i = 0; i < 100; ++i) {
+				handles.emplace_back(i);
+			}
+			handles.emplace(handles.begin(), -1);
+			handles.erase(handles.begin() + 10);
+			// 扩容、中间插入与删除均按字节搬移，不调用移动构造函数
+			Assert::AreEqual(0, relocatable_handle::moves);
+			Assert::AreEqual(-1, *handles[0].resource);
+			Assert::AreEqual(10, *handles[10].resource);
+			Assert::AreEqual(99, *handles.back().resource);
+		}
+
+		TEST_METHOD(TestStrongGuarantee) {
+			my::vector<throwing_copy> values;
+			values.reserve_exact(4);
+			for (int i = 0; i < 4; ++i) {
+				values.emplace_back(std::to_string(i));
+			}
+			throwing_copy::copies = 0;
+			throwing_copy::limit = 3;
+			bool thrown = false;
+			try {
+				values.emplace_back("4");
+			}
+			catch (int) {
+				thrown = true;
+			}
+			// 移动可能抛出异常，扩容时复制原有元素；复制失败后容器保持不变
+			Assert::IsTrue(thrown);
+			Assert::AreEqual(size_t(4), values.size());
+			Assert::AreEqual(size_t(4), values.capacity());
+			Assert::AreEqual(std::string("3"), values[3].value);
+
+			throwing_copy::limit = 0;
+			values.emplace_back("4");
+			Assert::AreEqual(std::string("0"), values[0].value);
+			Assert::AreEqual(std::string("4"), values[4].value);
+		}
+
+		TEST_METHOD(TestCustomConstruct) {
+			counting_allocator<int>::constructs = 0;
+			my::vector<int, counting_allocator<int>> values;
+			values.reserve_exact(2);
+			values.push_back(1);
+			values.push_back(2);
+			values.push_back(3);
+			// 分配器定制了 construct，扩容时逐个通过分配器构造
+			Assert::AreEqual(5, counting_allocator<int>::constructs);
+			Assert::AreEqual(3, values[2]);
+		}
+
+		TEST_METHOD(TestCapacity) {
+			my::vector<int> values;
+			values.reserve(10);
+			Assert::AreEqual(size_t(10), values.capacity());
+			values.reserve(11);
+			Assert::AreEqual(size_t(20), values.capacity());
+			values.reserve_exact(21);
+			Assert::AreEqual(size_t(21), values.capacity());
+			values.push_back(1);
+			values.shrink_to_fit();
+			Assert::AreEqual(size_t(1), values.capacity());
+
+			my::vector<slow_growth> slow;
+			slow.reserve_exact(10);
+			slow.resize(11);
+			Assert::AreEqual(size_t(15), slow.capacity());
+		}
+
+		TEST_METHOD(TestExpandInPlace) {
+			my::inline_arena<1024> arena;
+			my::vector<int, my::inline_allocator<int, 1024>> values{ my::inline_allocator<int, 1024>(arena) };
+			values.push_back(0);
+			const int* data = values.data();
+			for (int i = 1; i < 64; ++i) {
+				values.push_back(i);
+			}
+			// 存储是 arena 中最近一次分配的内存，每次扩容都原地完成
+			Assert::IsTrue(values.data() == data);
+			Assert::AreEqual(63, values.back());
+			Assert::AreEqual(size_t(64 * sizeof(int)), arena.used());
+		}
+	};
+}
@@ -0,0 +1,835 @@
+﻿#pragma once
+#include "core.h"
+
+#if __HAS_CPP11
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include "vector.hpp"
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace __MY_NAMESPACE {
+
+	#pragma region bit_vector
+	template <typename Alloc = allocator<::std::uint64_t>>
+	class bit_vector;
+
+	__INNER_BEGIN
+	using __bit_word = ::std::uint64_t;
+
+	constexpr ::size_t __bits_per_word = 64;
+
+	// 置位的个数
+	inline unsigned __popcount(__bit_word word) noexcept {
+		#if defined(__GNUC__) || defined(__clang__)
+		return static_cast<unsigned>(__builtin_popcountll(word));
+		#elif defined(_MSC_VER) && defined(_M_X64)
+		return static_cast<unsigned>(__popcnt64(word));
+		#else
+		word = word - ((word >> 1) & 0x5555555555555555ULL);
+		word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+		word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+		return static_cast<unsigned>((word * 0x0101010101010101ULL) >> 56);
+		#endif
+	}
+
+	// 最低置位的下标，word 不能为 0
+	inline unsigned __countr_zero(__bit_word word) noexcept {
+		#if defined(__GNUC__) || defined(__clang__)
+		return static_cast<unsigned>(__builtin_ctzll(word));
+		#elif defined(_MSC_VER) && defined(_M_X64)
+		unsigned long index;
+		_BitScanForward64(&index, word);
+		return static_cast<unsigned>(index);
+		#else
+		unsigned index = 0;
+		for (; (word & 1) == 0; word >>= 1) {
+			++index;
+		}
+		return index;
+		#endif
+	}
+
+	// 一个字中下标不小于 bit 的位
+	constexpr __bit_word __mask_from(::size_t bit) noexcept {
+		return ~__bit_word(0) << bit;
+	}
+
+	// 一个字中下标不大于 bit 的位
+	constexpr __bit_word __mask_through(::size_t bit) noexcept {
+		return ~__bit_word(0) >> (__bits_per_word - 1 - bit);
+	}
+
+	/**
+	 * @brief (non-standard feature) proxy reference to a single bit of a bit_vector
+	 * @brief （非标准内容）指向 bit_vector 中单个位的代理引用
+	*/
+	class __bit_reference {
+	private:
+		template <bool>
+		friend class __bit_iterator;
+
+		__bit_word* __word;
+		__bit_word __mask;
+
+		__bit_reference(__bit_word* word, __bit_word mask) noexcept: __word(word), __mask(mask) {}
+
+	public:
+		template <typename>
+		friend class __MY_NAMESPACE::bit_vector;
+
+		__bit_reference(const __bit_reference&) = default;
+
+		operator bool() const noexcept {
+			return (*__word & __mask) != 0;
+		}
+
+		bool operator~() const noexcept {
+			return (*__word & __mask) == 0;
+		}
+
+		// 赋值改变所指的位，而非重新绑定
+		__bit_reference& operator=(bool value) noexcept {
+			if (value) {
+				*__word |= __mask;
+			}
+			else {
+				*__word &= ~__mask;
+			}
+			return *this;
+		}
+
+		__bit_reference& operator=(const __bit_reference& other) noexcept {
+			return *this = static_cast<bool>(other);
+		}
+
+		void flip() noexcept {
+			*__word ^= __mask;
+		}
+
+		friend void swap(__bit_reference lhs, __bit_reference rhs) noexcept {
+			const bool temp = lhs;
+			lhs = static_cast<bool>(rhs);
+			rhs = temp;
+		}
+
+		friend void swap(__bit_reference lhs, bool& rhs) noexcept {
+			const bool temp = lhs;
+			lhs = rhs;
+			rhs = temp;
+		}
+
+		friend void swap(bool& lhs, __bit_reference rhs) noexcept {
+			swap(rhs, lhs);
+		}
+	};
+
+	/**
+	 * @brief (non-standard feature) random access iterator over the bits of a bit_vector
+	 * @brief （非标准内容）bit_vector 的随机访问迭代器，记录所在的字与字内的位下标
+	*/
+	template <bool Const>
+	class __bit_iterator {
+	private:
+		template <bool>
+		friend class __bit_iterator;
+		template <typename>
+		friend class __MY_NAMESPACE::bit_vector;
+
+		using __word_pointer = typename conditional<Const, const __bit_word*, __bit_word*>::type;
+
+		__word_pointer __word;
+		::size_t __bit;
+
+		__bit_iterator(__word_pointer word, ::size_t bit) noexcept: __word(word), __bit(bit) {}
+
+		__bit_reference __deref(false_type) const noexcept {
+			return __bit_reference(__word, __bit_word(1) << __bit);
+		}
+
+		bool __deref(true_type) const noexcept {
+			return (*__word >> __bit & 1) != 0;
+		}
+
+	public:
+		using iterator_category = ::std::random_access_iterator_tag;
+		using value_type = bool;
+		using difference_type = ::ptrdiff_t;
+		using pointer = void;
+		using reference = typename conditional<Const, bool, __bit_reference>::type;
+
+		__bit_iterator() noexcept: __word(nullptr), __bit(0) {}
+
+		// iterator 可以转换为 const_iterator
+		template <bool OtherConst, typename = typename enable_if<Const && !OtherConst>::type>
+		__bit_iterator(const __bit_iterator<OtherConst>& other) noexcept: __word(other.__word), __bit(other.__bit) {}
+
+		reference operator*() const noexcept {
+			return __deref(integral_constant<bool, Const>());
+		}
+
+		reference operator[](difference_type offset) const noexcept {
+			return *(*this + offset);
+		}
+
+		__bit_iterator& operator++() noexcept {
+			if (++__bit == __bits_per_word) {
+				__bit = 0;
+				++__word;
+			}
+			return *this;
+		}
+
+		__bit_iterator operator++(int) noexcept {
+			__bit_iterator temp = *this;
+			++*this;
+			return temp;
+		}
+
+		__bit_iterator& operator--() noexcept {
+			if (__bit-- == 0) {
+				__bit = __bits_per_word - 1;
+				--__word;
+			}
+			return *this;
+		}
+
+		__bit_iterator operator--(int) noexcept {
+			__bit_iterator temp = *this;
+			--*this;
+			return temp;
+		}
+
+		__bit_iterator& operator+=(difference_type offset) noexcept {
+			// 向负无穷取整，使位下标落在 [0, 64)
+			const difference_type position = static_cast<difference_type>(__bit) + offset;
+			difference_type words = position / static_cast<difference_type>(__bits_per_word);
+			difference_type bit = position % static_cast<difference_type>(__bits_per_word);
+			if (bit < 0) {
+				bit += static_cast<difference_type>(__bits_per_word);
+				--words;
+			}
+			__word += words;
+			__bit = static_cast<::size_t>(bit);
+			return *this;
+		}
+
+		__bit_iterator& operator-=(difference_type offset) noexcept {
+			return *this += -offset;
+		}
+
+		friend __bit_iterator operator+(__bit_iterator it, difference_type offset) noexcept {
+			return it += offset;
+		}
+
+		friend __bit_iterator operator+(difference_type offset, __bit_iterator it) noexcept {
+			return it += offset;
+		}
+
+		friend __bit_iterator operator-(__bit_iterator it, difference_type offset) noexcept {
+			return it -= offset;
+		}
+
+		friend difference_type operator-(const __bit_iterator& lhs, const __bit_iterator& rhs) noexcept {
+			return (lhs.__word - rhs.__word) * static_cast<difference_type>(__bits_per_word) +
+				static_cast<difference_type>(lhs.__bit) - static_cast<difference_type>(rhs.__bit);
+		}
+
+		friend bool operator==(const __bit_iterator& lhs, const __bit_iterator& rhs) noexcept {
+			return lhs.__word == rhs.__word && lhs.__bit == rhs.__bit;
+		}
+
+		friend bool operator!=(const __bit_iterator& lhs, const __bit_iterator& rhs) noexcept {
+			return !(lhs == rhs);
+		}
+
+		friend bool operator<(const __bit_iterator& lhs, const __bit_iterator& rhs) noexcept {
+			return lhs - rhs < 0;
+		}
+
+		friend bool operator>(const __bit_iterator& lhs, const __bit_iterator& rhs) noexcept {
+			return rhs < lhs;
+		}
+
+		friend bool operator<=(const __bit_iterator& lhs, const __bit_iterator& rhs) noexcept {
+			return !(rhs < lhs);
+		}
+
+		friend bool operator>=(const __bit_iterator& lhs, const __bit_iterator& rhs) noexcept {
+			return !(lhs < rhs);
+		}
+	};
+	__INNER_END
+
+	/**
+	 * @brief (non-standard feature) dynamic array of bits packed into 64-bit words
+	 * @brief （非标准内容）按 64 位的字紧凑存放的动态位数组
+	 * @tparam Alloc 字的分配器类型，value_type 须为 std::uint64_t
+	 *
+	 * @note
+	 * 位 i 存放在第 i / 64 个字的第 i % 64 位；最后一个字中超出 size() 的位始终为 0，
+	 * 因此 count、find_first / find_next 与按位运算都可以逐字处理，并使用 popcount / ctz 指令
+	 * 元素通过代理类型 reference 访问，迭代器不是指针；只支持在末尾增删元素
+	 * 按位运算 &=、|=、^= 与 and_not 要求两侧的 size() 相同，否则抛出 std::invalid_argument
+	*/
+	template <typename Alloc>
+	class bit_vector {
+	public:
+		using word_type = ::std::uint64_t;
+		using value_type = bool;
+		using allocator_type = Alloc;
+		using size_type = ::size_t;
+		using difference_type = ::ptrdiff_t;
+		using reference = __INNER_NAMESPACE::__bit_reference;
+		using const_reference = bool;
+		using iterator = __INNER_NAMESPACE::__bit_iterator<false>;
+		using const_iterator = __INNER_NAMESPACE::__bit_iterator<true>;
+		using reverse_iterator = ::std::reverse_iterator<iterator>;
+		using const_reverse_iterator = ::std::reverse_iterator<const_iterator>;
+
+		static constexpr size_type bits_per_word = __INNER_NAMESPACE::__bits_per_word;
+		static constexpr size_type npos = static_cast<size_type>(-1);
+
+		static_assert(is_same<typename Alloc::value_type, word_type>::value, "bit_vector requires Alloc::value_type to be std::uint64_t");
+
+	private:
+		vector<word_type, Alloc> __words;
+		size_type __size;
+
+		#pragma region helpers
+		static size_type __word_count(size_type bits) noexcept {
+			return (bits + bits_per_word - 1) / bits_per_word;
+		}
+
+		static word_type __fill_word(bool value) noexcept {
+			return value ? ~word_type(0) : word_type(0);
+		}
+
+		// 将最后一个字中超出 size() 的位清零
+		void __clear_tail() noexcept {
+			if (__size % bits_per_word != 0) {
+				__words.back() &= ~__INNER_NAMESPACE::__mask_from(__size % bits_per_word);
+			}
+		}
+
+		void __check_length(size_type count) const {
+			if (count > max_size()) {
+				throw ::std::length_error("bit_vector too long");
+			}
+		}
+
+		void __check_same_size(const bit_vector& other) const {
+			if (__size != other.__size) {
+				throw ::std::invalid_argument("bit_vector sizes differ");
+			}
+		}
+
+		template <typename InputIt>
+		void __append_range(InputIt first, InputIt last, false_type) {
+			for (; first != last; ++first) {
+				push_back(static_cast<bool>(*first));
+			}
+		}
+
+		template <typename ForwardIt>
+		void __append_range(ForwardIt first, ForwardIt last, true_type) {
+			reserve(__size + static_cast<size_type>(::std::distance(first, last)));
+			__append_range(first, last, false_type());
+		}
+
+		/**
+		 * @brief calls op(word, mask) for every word overlapping [first, last)
+		 * @brief 对与 [first, last) 相交的每个字调用 op(word, mask)，mask 为该字中落在范围内的位；首尾之间的整字 mask 为全 1
+		*/
+		template <typename Word, typename Op>
+		static void __for_each_word(Word* words, size_type first, size_type last, Op op) {
+			if (first >= last) {
+				return;
+			}
+			const size_type first_word = first / bits_per_word;
+			const size_type last_word = (last - 1) / bits_per_word;
+			const word_type first_mask = __INNER_NAMESPACE::__mask_from(first % bits_per_word);
+			const word_type last_mask = __INNER_NAMESPACE::__mask_through((last - 1) % bits_per_word);
+			if (first_word == last_word) {
+				op(words[first_word], first_mask & last_mask);
+				return;
+			}
+			op(words[first_word], first_mask);
+			for (size_type i = first_word + 1; i != last_word; ++i) {
+				op(words[i], ~word_type(0));
+			}
+			op(words[last_word], last_mask);
+		}
+
+		// 从第 index 个字开始查找置位，word 为该字中尚未排除的位
+		size_type __find_from(size_type index, word_type word) const noexcept {
+			const size_type count = __words.size();
+			for (;;) {
+				if (word != 0) {
+					return index * bits_per_word + __INNER_NAMESPACE::__countr_zero(word);
+				}
+				if (++index == count) {
+					return npos;
+				}
+				word = __words[index];
+			}
+		}
+		#pragma endregion helpers
+
+	public:
+		bit_vector() noexcept(noexcept(Alloc())): __words(), __size(0) {}
+
+		explicit bit_vector(const Alloc& alloc) noexcept: __words(alloc), __size(0) {}
+
+		explicit bit_vector(size_type count, const Alloc& alloc = Alloc()): bit_vector(count, false, alloc) {}
+
+		bit_vector(size_type count, bool value, const Alloc& alloc = Alloc()): __words(alloc), __size(0) {
+			assign(count, value);
+		}
+
+		template <typename InputIt, typename = typename enable_if<__INNER_NAMESPACE::__is_input_iterator<InputIt>::value>::type>
+		bit_vector(InputIt first, InputIt last, const Alloc& alloc = Alloc()): __words(alloc), __size(0) {
+			__append_range(first, last, __INNER_NAMESPACE::__is_forward_iterator<InputIt>());
+		}
+
+		bit_vector(::std::initializer_list<bool> init, const Alloc& alloc = Alloc()): bit_vector(init.begin(), init.end(), alloc) {}
+
+		bit_vector(const bit_vector& other) = default;
+
+		bit_vector(bit_vector&& other) noexcept: __words(__MY_NAMESPACE::move(other.__words)), __size(other.__size) {
+			other.__size = 0;
+		}
+
+		bit_vector& operator=(const bit_vector& other) = default;
+
+		bit_vector& operator=(bit_vector&& other) noexcept(noexcept(__words = __MY_NAMESPACE::move(other.__words))) {
+			if (this != __MY_NAMESPACE::addressof(other)) {
+				__words = __MY_NAMESPACE::move(other.__words);
+				__size = other.__size;
+				other.__words.clear();
+				other.__size = 0;
+			}
+			return *this;
+		}
+
+		bit_vector& operator=(::std::initializer_list<bool> init) {
+			assign(init.begin(), init.end());
+			return *this;
+		}
+
+		/**
+		 * @brief replaces the contents with count copies of value
+		 * @brief 将内容替换为 count 个 value，逐字填充
+		*/
+		void assign(size_type count, bool value) {
+			__check_length(count);
+			__words.assign(__word_count(count), __fill_word(value));
+			__size = count;
+			__clear_tail();
+		}
+
+		template <typename InputIt, typename = typename enable_if<__INNER_NAMESPACE::__is_input_iterator<InputIt>::value>::type>
+		void assign(InputIt first, InputIt last) {
+			clear();
+			__append_range(first, last, __INNER_NAMESPACE::__is_forward_iterator<InputIt>());
+		}
+
+		void assign(::std::initializer_list<bool> init) {
+			assign(init.begin(), init.end());
+		}
+
+		allocator_type get_allocator() const noexcept {
+			return __words.get_allocator();
+		}
+
+		#pragma region element access
+		reference at(size_type index) {
+			if (index >= __size) {
+				throw ::std::out_of_range("bit_vector index out of range");
+			}
+			return (*this)[index];
+		}
+
+		const_reference at(size_type index) const {
+			if (index >= __size) {
+				throw ::std::out_of_range("bit_vector index out of range");
+			}
+			return (*this)[index];
+		}
+
+		reference operator[](size_type index) noexcept {
+			return reference(__words.data() + index / bits_per_word, word_type(1) << (index % bits_per_word));
+		}
+
+		const_reference operator[](size_type index) const noexcept {
+			return test(index);
+		}
+
+		bool test(size_type index) const noexcept {
+			return (__words[index / bits_per_word] >> (index % bits_per_word) & 1) != 0;
+		}
+
+		reference front() noexcept { return (*this)[0]; }
+		const_reference front() const noexcept { return test(0); }
+
+		reference back() noexcept { return (*this)[__size - 1]; }
+		const_reference back() const noexcept { return test(__size - 1); }
+
+		/**
+		 * @brief the underlying words, bit i is bit i % 64 of word i / 64
+		 * @brief 底层的字，位 i 位于第 i / 64 个字的第 i % 64 位，最后一个字中超出 size() 的位为 0
+		*/
+		const word_type* data() const noexcept { return __words.data(); }
+
+		size_type word_count() const noexcept { return __words.size(); }
+		#pragma endregion element access
+
+		#pragma region iterators
+		iterator begin() noexcept { return iterator(__words.data(), 0); }
+		const_iterator begin() const noexcept { return const_iterator(__words.data(), 0); }
+		const_iterator cbegin() const noexcept { return begin(); }
+
+		iterator end() noexcept { return begin() + static_cast<difference_type>(__size); }
+		const_iterator end() const noexcept { return begin() + static_cast<difference_type>(__size); }
+		const_iterator cend() const noexcept { return end(); }
+
+		reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+		const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+		const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(end()); }
+
+		reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+		const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+		const_reverse_iterator crend() const noexcept { return const_reverse_iterator(begin()); }
+		#pragma endregion iterators
+
+		#pragma region capacity
+		__NODISCARD bool empty() const noexcept { return __size == 0; }
+
+		size_type size() const noexcept { return __size; }
+
+		size_type capacity() const noexcept { return __words.capacity() * bits_per_word; }
+
+		size_type max_size() const noexcept {
+			// 保证 __word_count 中的 bits + 63 不溢出
+			const size_type max_words = npos / bits_per_word - 1;
+			const size_type words = __words.max_size();
+			return (words < max_words ? words : max_words) * bits_per_word;
+		}
+
+		void reserve(size_type count) {
+			__check_length(count);
+			__words.reserve(__word_count(count));
+		}
+
+		void shrink_to_fit() {
+			__words.shrink_to_fit();
+		}
+		#pragma endregion capacity
+
+		#pragma region modifiers
+		void clear() noexcept {
+			__words.clear();
+			__size = 0;
+		}
+
+		void push_back(bool value) {
+			if (__size % bits_per_word == 0) {
+				__check_length(__size + 1);
+				__words.push_back(word_type(0));
+			}
+			if (value) {
+				__words.back() |= word_type(1) << (__size % bits_per_word);
+			}
+			++__size;
+		}
+
+		void pop_back() noexcept {
+			--__size;
+			if (__size % bits_per_word == 0) {
+				__words.pop_back();
+			}
+			else {
+				__words.back() &= ~(word_type(1) << (__size % bits_per_word));
+			}
+		}
+
+		void resize(size_type count, bool value = false) {
+			if (count <= __size) {
+				__words.resize(__word_count(count));
+				__size = count;
+				__clear_tail();
+				return;
+			}
+			__check_length(count);
+			const size_type old_size = __size;
+			__words.resize(__word_count(count), __fill_word(value));
+			if (value && old_size % bits_per_word != 0) {
+				__words[old_size / bits_per_word] |= __INNER_NAMESPACE::__mask_from(old_size % bits_per_word);
+			}
+			__size = count;
+			__clear_tail();
+		}
+
+		void swap(bit_vector& other) noexcept {
+			__words.swap(other.__words);
+			__INNER_NAMESPACE::__swap_adl(__size, other.__size);
+		}
+
+		void set(size_type index, bool value = true) noexcept {
+			(*this)[index] = value;
+		}
+
+		void reset(size_type index) noexcept {
+			(*this)[index] = false;
+		}
+
+		void flip(size_type index) noexcept {
+			(*this)[index].flip();
+		}
+
+		// 全部置 1
+		void set() noexcept {
+			fill(0, __size, true);
+		}
+
+		// 全部置 0
+		void reset() noexcept {
+			if (!__words.empty()) {
+				::std::memset(__words.data(), 0, __words.size() * sizeof(word_type));
+			}
+		}
+
+		// 全部取反
+		void flip() noexcept {
+			for (word_type& word : __words) {
+				word = ~word;
+			}
+			__clear_tail();
+		}
+
+		/**
+		 * @brief sets the bits in [first, last) to value
+		 * @brief 将 [first, last) 中的位置为 value：首尾的字按掩码修改，中间的整字直接填充
+		 * @param first 起始下标
+		 * @param last 末尾下标，不能超过 size()
+		*/
+		void fill(size_type first, size_type last, bool value) noexcept {
+			if (value) {
+				__for_each_word(__words.data(), first, last, [](word_type& word, word_type mask) { word |= mask; });
+			}
+			else {
+				__for_each_word(__words.data(), first, last, [](word_type& word, word_type mask) { word &= ~mask; });
+			}
+		}
+		#pragma endregion modifiers
+
+		#pragma region bit operations
+		/**
+		 * @brief the number of set bits
+		 * @brief 置位的个数，逐字使用 popcount
+		*/
+		size_type count() const noexcept {
+			size_type result = 0;
+			for (word_type word : __words) {
+				result += __INNER_NAMESPACE::__popcount(word);
+			}
+			return result;
+		}
+
+		/**
+		 * @brief the number of set bits in [first, last)
+		 * @brief [first, last) 中置位的个数，last 不能超过 size()
+		*/
+		size_type count(size_type first, size_type last) const noexcept {
+			size_type result = 0;
+			__for_each_word(__words.data(), first, last, [&result](const word_type& word, word_type mask) {
+				result += __INNER_NAMESPACE::__popcount(word & mask);
+			});
+			return result;
+		}
+
+		bool any() const noexcept {
+			for (word_type word : __words) {
+				if (word != 0) {
+					return true;
+				}
+			}
+			return false;
+		}
+
+		bool none() const noexcept {
+			return !any();
+		}
+
+		bool all() const noexcept {
+			return count() == __size;
+		}
+
+		/**
+		 * @brief the index of the first set bit
+		 * @brief 第一个置位的下标，没有时返回 npos
+		*/
+		size_type find_first() const noexcept {
+			return __words.empty() ? npos : __find_from(0, __words[0]);
+		}
+
+		/**
+		 * @brief the index of the first set bit after position
+		 * @brief position 之后（不含 position）第一个置位的下标，没有时返回 npos
+		*/
+		size_type find_next(size_type position) const noexcept {
+			if (position >= __size || ++position == __size) {
+				return npos;
+			}
+			const size_type index = position / bits_per_word;
+			return __find_from(index, __words[index] & __INNER_NAMESPACE::__mask_from(position % bits_per_word));
+		}
+
+		bit_vector& operator&=(const bit_vector& other) {
+			__check_same_size(other);
+			for (size_type i = 0, words = __words.size(); i != words; ++i) {
+				__words[i] &= other.__words[i];
+			}
+			return *this;
+		}
+
+		bit_vector& operator|=(const bit_vector& other) {
+			__check_same_size(other);
+			for (size_type i = 0, words = __words.size(); i != words; ++i) {
+				__words[i] |= other.__words[i];
+			}
+			return *this;
+		}
+
+		bit_vector& operator^=(const bit_vector& other) {
+			__check_same_size(other);
+			for (size_type i = 0, words = __words.size(); i != words; ++i) {
+				__words[i] ^= other.__words[i];
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief clears the bits that are set in other
+		 * @brief 清除 other 中置位的位，即 *this &= ~other，不需要构造 ~other
+		*/
+		bit_vector& and_not(const bit_vector& other) {
+			__check_same_size(other);
+			for (size_type i = 0, words = __words.size(); i != words; ++i) {
+				__words[i] &= ~other.__words[i];
+			}
+			return *this;
+		}
+
+		bit_vector operator~() const {
+			bit_vector result(*this);
+			result.flip();
+			return result;
+		}
+		#pragma endregion bit operations
+	};
+
+	template <typename Alloc>
+	constexpr typename bit_vector<Alloc>::size_type bit_vector<Alloc>::bits_per_word;
+
+	template <typename Alloc>
+	constexpr typename bit_vector<Alloc>::size_type bit_vector<Alloc>::npos;
+
+	template <typename Alloc>
+	void swap(bit_vector<Alloc>& lhs, bit_vector<Alloc>& rhs) noexcept {
+		lhs.swap(rhs);
+	}
+
+	// 只持有 vector 与位数
+	template <typename Alloc>
+	struct is_trivially_relocatable<bit_vector<Alloc>>: is_trivially_relocatable<Alloc> {};
+
+	template <typename Alloc>
+	__NODISCARD bit_vector<Alloc> operator&(const bit_vector<Alloc>& lhs, const bit_vector<Alloc>& rhs) {
+		bit_vector<Alloc> result(lhs);
+		result &= rhs;
+		return result;
+	}
+
+	template <typename Alloc>
+	__NODISCARD bit_vector<Alloc> operator|(const bit_vector<Alloc>& lhs, const bit_vector<Alloc>& rhs) {
+		bit_vector<Alloc> result(lhs);
+		result |= rhs;
+		return result;
+	}
+
+	template <typename Alloc>
+	__NODISCARD bit_vector<Alloc> operator^(const bit_vector<Alloc>& lhs, const bit_vector<Alloc>& rhs) {
+		bit_vector<Alloc> result(lhs);
+		result ^= rhs;
+		return result;
+	}
+
+	__INNER_BEGIN
+	/**
+	 * @brief lexicographically compares two packed bit sequences, bit 0 first
+	 * @brief 按字典序比较两个位序列（从位 0 开始），逐字找到第一个不同的位；返回负数、0 或正数
+	*/
+	inline int __bit_compare(const __bit_word* lhs, ::size_t lhs_size, const __bit_word* rhs, ::size_t rhs_size) noexcept {
+		const ::size_t count = lhs_size < rhs_size ? lhs_size : rhs_size;
+		const ::size_t words = count / __bits_per_word;
+		for (::size_t i = 0; i != words + (count % __bits_per_word != 0); ++i) {
+			__bit_word diff = lhs[i] ^ rhs[i];
+			if (i == words) {
+				diff &= ~__mask_from(count % __bits_per_word);
+			}
+			if (diff != 0) {
+				return (lhs[i] >> __countr_zero(diff) & 1) != 0 ? 1 : -1;
+			}
+		}
+		return lhs_size < rhs_size ? -1 : lhs_size > rhs_size ? 1 : 0;
+	}
+	__INNER_END
+
+	template <typename Alloc>
+	__NODISCARD bool operator==(const bit_vector<Alloc>& lhs, const bit_vector<Alloc>& rhs) {
+		// 超出 size() 的位均为 0，可以整字比较
+		return lhs.size() == rhs.size() &&
+			__INNER_NAMESPACE::__contiguous_equal(lhs.data(), lhs.word_count(), rhs.data(), rhs.word_count());
+	}
+
+	#if __HAS_CPP20
+	template <typename Alloc>
+	__NODISCARD strong_ordering operator<=>(const bit_vector<Alloc>& lhs, const bit_vector<Alloc>& rhs) {
+		return __INNER_NAMESPACE::__ordering_cast(__INNER_NAMESPACE::__bit_compare(lhs.data(), lhs.size(), rhs.data(), rhs.size()) <=> 0);
+	}
+	#else // ^^^ __HAS_CPP20 / vvv !__HAS_CPP20
+	template <typename Alloc>
+	__NODISCARD bool operator!=(const bit_vector<Alloc>& lhs, const bit_vector<Alloc>& rhs) {
+		return !(lhs == rhs);
+	}
+
+	template <typename Alloc>
+	__NODISCARD bool operator<(const bit_vector<Alloc>& lhs, const bit_vector<Alloc>& rhs) {
+		return __INNER_NAMESPACE::__bit_compare(lhs.data(), lhs.size(), rhs.data(), rhs.size()) < 0;
+	}
+
+	template <typename Alloc>
+	__NODISCARD bool operator>(const bit_vector<Alloc>& lhs, const bit_vector<Alloc>& rhs) {
+		return rhs < lhs;
+	}
+
+	template <typename Alloc>
+	__NODISCARD bool operator<=(const bit_vector<Alloc>& lhs, const bit_vector<Alloc>& rhs) {
+		return !(rhs < lhs);
+	}
+
+	template <typename Alloc>
+	__NODISCARD bool operator>=(const bit_vector<Alloc>& lhs, const bit_vector<Alloc>& rhs) {
+		return !(lhs < rhs);
+	}
+	#endif // __HAS_CPP20
+	#pragma endregion bit_vector
+
+} // namespace __MY_NAMESPACE
+#endif // __HAS_CPP11
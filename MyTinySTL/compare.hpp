@@ -0,0 +1,442 @@
+﻿#pragma once
+#include "core.h"
+
+#if __HAS_CPP20
+// 内置类型的 operator<=> 返回 std 中的比较类别，须包含 <compare>
+#include <compare>
+#include <cstring>
+#include "type_traits.hpp"
+
+namespace __MY_NAMESPACE {
+
+	#pragma region comparison categories
+	class partial_ordering;
+	class weak_ordering;
+	class strong_ordering;
+
+	__INNER_BEGIN
+	enum class __ordering_value: signed char {
+		__less = -1,
+		__equivalent = 0,
+		__greater = 1,
+		__unordered = 2
+	};
+
+	/**
+	 * @brief (non-standard feature) parameter type that only accepts the literal 0
+	 * @brief （非标准内容）只接受字面量 0 的参数类型，比较类别只能与 0 比较
+	*/
+	struct __literal_zero {
+		consteval __literal_zero(__literal_zero*) noexcept {}
+	};
+	__INNER_END
+
+	/**
+	 * @brief the result type of 3-way comparison that supports all 6 operators, is not substitutable, and allows incomparable values
+	 * @brief 三路比较的结果类型，支持全部 6 种比较运算符，不可替换，允许不可比较的值
+	*/
+	class partial_ordering {
+	private:
+		signed char __value;
+
+		constexpr explicit partial_ordering(__INNER_NAMESPACE::__ordering_value value) noexcept:
+			__value(static_cast<signed char>(value)) {}
+
+		friend class weak_ordering;
+		friend class strong_ordering;
+
+	public:
+		static const partial_ordering less;
+		static const partial_ordering equivalent;
+		static const partial_ordering greater;
+		static const partial_ordering unordered;
+
+		// 内置类型的比较结果为 std::partial_ordering
+		constexpr partial_ordering(::std::partial_ordering order) noexcept:
+			__value(order < 0 ? -1 : order > 0 ? 1 : order == 0 ? 0 : 2) {}
+
+		__NODISCARD friend constexpr bool operator==(partial_ordering, partial_ordering) noexcept = default;
+
+		__NODISCARD friend constexpr bool operator==(partial_ordering v, __INNER_NAMESPACE::__literal_zero) noexcept {
+			return v.__value == 0;
+		}
+		__NODISCARD friend constexpr bool operator<(partial_ordering v, __INNER_NAMESPACE::__literal_zero) noexcept {
+			return v.__value == -1;
+		}
+		__NODISCARD friend constexpr bool operator>(partial_ordering v, __INNER_NAMESPACE::__literal_zero) noexcept {
+			return v.__value == 1;
+		}
+		__NODISCARD friend constexpr bool operator<=(partial_ordering v, __INNER_NAMESPACE::__literal_zero) noexcept {
+			return v.__value == -1 || v.__value == 0;
+		}
+		__NODISCARD friend constexpr bool operator>=(partial_ordering v, __INNER_NAMESPACE::__literal_zero) noexcept {
+			return v.__value == 0 || v.__value == 1;
+		}
+		__NODISCARD friend constexpr bool operator<(__INNER_NAMESPACE::__literal_zero, partial_ordering v) noexcept {
+			return v.__value == 1;
+		}
+		__NODISCARD friend constexpr bool operator>(__INNER_NAMESPACE::__literal_zero, partial_ordering v) noexcept {
+			return v.__value == -1;
+		}
+		__NODISCARD friend constexpr bool operator<=(__INNER_NAMESPACE::__literal_zero, partial_ordering v) noexcept {
+			return v.__value == 0 || v.__value == 1;
+		}
+		__NODISCARD friend constexpr bool operator>=(__INNER_NAMESPACE::__literal_zero, partial_ordering v) noexcept {
+			return v.__value == -1 || v.__value == 0;
+		}
+		__NODISCARD friend constexpr partial_ordering operator<=>(partial_ordering v, __INNER_NAMESPACE::__literal_zero) noexcept {
+			return v;
+		}
+		__NODISCARD friend constexpr partial_ordering operator<=>(__INNER_NAMESPACE::__literal_zero, partial_ordering v) noexcept {
+			return v.__value == 1 || v.__value == -1 ? partial_ordering(static_cast<__INNER_NAMESPACE::__ordering_value>(-v.__value)) : v;
+		}
+	};
+
+	inline constexpr partial_ordering partial_ordering::less(__INNER_NAMESPACE::__ordering_value::__less);
+	inline constexpr partial_ordering partial_ordering::equivalent(__INNER_NAMESPACE::__ordering_value::__equivalent);
+	inline constexpr partial_ordering partial_ordering::greater(__INNER_NAMESPACE::__ordering_value::__greater);
+	inline constexpr partial_ordering partial_ordering::unordered(__INNER_NAMESPACE::__ordering_value::__unordered);
+
+	/**
+	 * @brief the result type of 3-way comparison that supports all 6 operators and is not substitutable
+	 * @brief 三路比较的结果类型，支持全部 6 种比较运算符，不可替换
+	*/
+	class weak_ordering {
+	private:
+		signed char __value;
+
+		constexpr explicit weak_ordering(__INNER_NAMESPACE::__ordering_value value) noexcept:
+			__value(static_cast<signed char>(value)) {}
+
+		friend class strong_ordering;
+
+	public:
+		static const weak_ordering less;
+		static const weak_ordering equivalent;
+		static const weak_ordering greater;
+
+		constexpr weak_ordering(::std::weak_ordering order) noexcept:
+			__value(order < 0 ? -1 : order > 0 ? 1 : 0) {}
+
+		constexpr operator partial_ordering() const noexcept {
+			return partial_ordering(static_cast<__INNER_NAMESPACE::__ordering_value>(__value));
+		}
+
+		__NODISCARD friend constexpr bool operator==(weak_ordering, weak_ordering) noexcept = default;
+
+		__NODISCARD friend constexpr bool operator==(weak_ordering v, __INNER_NAMESPACE::__literal_zero) noexcept {
+			return v.__value == 0;
+		}
+		__NODISCARD friend constexpr bool operator<(weak_ordering v, __INNER_NAMESPACE::__literal_zero) noexcept {
+			return v.__value < 0;
+		}
+		__NODISCARD friend constexpr bool operator>(weak_ordering v, __INNER_NAMESPACE::__literal_zero) noexcept {
+			return v.__value > 0;
+		}
+		__NODISCARD friend constexpr bool operator<=(weak_ordering v, __INNER_NAMESPACE::__literal_zero) noexcept {
+			return v.__value <= 0;
+		}
+		__NODISCARD friend constexpr bool operator>=(weak_ordering v, __INNER_NAMESPACE::__literal_zero) noexcept {
+			return v.__value >= 0;
+		}
+		__NODISCARD friend constexpr bool operator<(__INNER_NAMESPACE::__literal_zero, weak_ordering v) noexcept {
+			return 0 < v.__value;
+		}
+		__NODISCARD friend constexpr bool operator>(__INNER_NAMESPACE::__literal_zero, weak_ordering v) noexcept {
+			return 0 > v.__value;
+		}
+		__NODISCARD friend constexpr bool operator<=(__INNER_NAMESPACE::__literal_zero, weak_ordering v) noexcept {
+			return 0 <= v.__value;
+		}
+		__NODISCARD friend constexpr bool operator>=(__INNER_NAMESPACE::__literal_zero, weak_ordering v) noexcept {
+			return 0 >= v.__value;
+		}
+		__NODISCARD friend constexpr weak_ordering operator<=>(weak_ordering v, __INNER_NAMESPACE::__literal_zero) noexcept {
+			return v;
+		}
+		__NODISCARD friend constexpr weak_ordering operator<=>(__INNER_NAMESPACE::__literal_zero, weak_ordering v) noexcept {
+			return weak_ordering(static_cast<__INNER_NAMESPACE::__ordering_value>(-v.__value));
+		}
+	};
+
+	inline constexpr weak_ordering weak_ordering::less(__INNER_NAMESPACE::__ordering_value::__less);
+	inline constexpr weak_ordering weak_ordering::equivalent(__INNER_NAMESPACE::__ordering_value::__equivalent);
+	inline constexpr weak_ordering weak_ordering::greater(__INNER_NAMESPACE::__ordering_value::__greater);
+
+	/**
+	 * @brief the result type of 3-way comparison that supports all 6 operators and is substitutable
+	 * @brief 三路比较的结果类型，支持全部 6 种比较运算符，可替换
+	*/
+	class strong_ordering {
+	private:
+		signed char __value;
+
+		constexpr explicit strong_ordering(__INNER_NAMESPACE::__ordering_value value) noexcept:
+			__value(static_cast<signed char>(value)) {}
+
+	public:
+		static const strong_ordering less;
+		static const strong_ordering equal;
+		static const strong_ordering equivalent;
+		static const strong_ordering greater;
+
+		constexpr strong_ordering(::std::strong_ordering order) noexcept:
+			__value(order < 0 ? -1 : order > 0 ? 1 : 0) {}
+
+		constexpr operator partial_ordering() const noexcept {
+			return partial_ordering(static_cast<__INNER_NAMESPACE::__ordering_value>(__value));
+		}
+
+		constexpr operator weak_ordering() const noexcept {
+			return weak_ordering(static_cast<__INNER_NAMESPACE::__ordering_value>(__value));
+		}
+
+		__NODISCARD friend constexpr bool operator==(strong_ordering, strong_ordering) noexcept = default;
+
+		__NODISCARD friend constexpr bool operator==(strong_ordering v, __INNER_NAMESPACE::__literal_zero) noexcept {
+			return v.__value == 0;
+		}
+		__NODISCARD friend constexpr bool operator<(strong_ordering v, __INNER_NAMESPACE::__literal_zero) noexcept {
+			return v.__value < 0;
+		}
+		__NODISCARD friend constexpr bool operator>(strong_ordering v, __INNER_NAMESPACE::__literal_zero) noexcept {
+			return v.__value > 0;
+		}
+		__NODISCARD friend constexpr bool operator<=(strong_ordering v, __INNER_NAMESPACE::__literal_zero) noexcept {
+			return v.__value <= 0;
+		}
+		__NODISCARD friend constexpr bool operator>=(strong_ordering v, __INNER_NAMESPACE::__literal_zero) noexcept {
+			return v.__value >= 0;
+		}
+		__NODISCARD friend constexpr bool operator<(__INNER_NAMESPACE::__literal_zero, strong_ordering v) noexcept {
+			return 0 < v.__value;
+		}
+		__NODISCARD friend constexpr bool operator>(__INNER_NAMESPACE::__literal_zero, strong_ordering v) noexcept {
+			return 0 > v.__value;
+		}
+		__NODISCARD friend constexpr bool operator<=(__INNER_NAMESPACE::__literal_zero, strong_ordering v) noexcept {
+			return 0 <= v.__value;
+		}
+		__NODISCARD friend constexpr bool operator>=(__INNER_NAMESPACE::__literal_zero, strong_ordering v) noexcept {
+			return 0 >= v.__value;
+		}
+		__NODISCARD friend constexpr strong_ordering operator<=>(strong_ordering v, __INNER_NAMESPACE::__literal_zero) noexcept {
+			return v;
+		}
+		__NODISCARD friend constexpr strong_ordering operator<=>(__INNER_NAMESPACE::__literal_zero, strong_ordering v) noexcept {
+			return strong_ordering(static_cast<__INNER_NAMESPACE::__ordering_value>(-v.__value));
+		}
+	};
+
+	inline constexpr strong_ordering strong_ordering::less(__INNER_NAMESPACE::__ordering_value::__less);
+	inline constexpr strong_ordering strong_ordering::equal(__INNER_NAMESPACE::__ordering_value::__equivalent);
+	inline constexpr strong_ordering strong_ordering::equivalent(__INNER_NAMESPACE::__ordering_value::__equivalent);
+	inline constexpr strong_ordering strong_ordering::greater(__INNER_NAMESPACE::__ordering_value::__greater);
+
+	/**
+	 * @brief named comparison functions
+	 * @brief 具名比较函数，判断比较结果与 0 的关系
+	*/
+	__NODISCARD constexpr bool is_eq(partial_ordering order) noexcept { return order == 0; }
+	__NODISCARD constexpr bool is_neq(partial_ordering order) noexcept { return order != 0; }
+	__NODISCARD constexpr bool is_lt(partial_ordering order) noexcept { return order < 0; }
+	__NODISCARD constexpr bool is_lteq(partial_ordering order) noexcept { return order <= 0; }
+	__NODISCARD constexpr bool is_gt(partial_ordering order) noexcept { return order > 0; }
+	__NODISCARD constexpr bool is_gteq(partial_ordering order) noexcept { return order >= 0; }
+	#pragma endregion comparison categories
+
+	#pragma region common_comparison_category
+	__INNER_BEGIN
+	// 比较类别的强弱：0 为 strong，1 为 weak，2 为 partial，3 不是比较类别
+	template <typename T>
+	struct __ordering_rank: integral_constant<int, 3> {};
+
+	template <>
+	struct __ordering_rank<strong_ordering>: integral_constant<int, 0> {};
+
+	template <>
+	struct __ordering_rank<weak_ordering>: integral_constant<int, 1> {};
+
+	template <>
+	struct __ordering_rank<partial_ordering>: integral_constant<int, 2> {};
+
+	template <>
+	struct __ordering_rank<::std::strong_ordering>: integral_constant<int, 0> {};
+
+	template <>
+	struct __ordering_rank<::std::weak_ordering>: integral_constant<int, 1> {};
+
+	template <>
+	struct __ordering_rank<::std::partial_ordering>: integral_constant<int, 2> {};
+
+	template <int Rank>
+	struct __ordering_of_rank {
+		using type = void;
+	};
+
+	template <>
+	struct __ordering_of_rank<0> {
+		using type = strong_ordering;
+	};
+
+	template <>
+	struct __ordering_of_rank<1> {
+		using type = weak_ordering;
+	};
+
+	template <>
+	struct __ordering_of_rank<2> {
+		using type = partial_ordering;
+	};
+
+	template <int... Ranks>
+	constexpr int __weakest_rank() noexcept {
+		constexpr int ranks[] = { Ranks..., 0 };
+		int result = 0;
+		for (int rank: ranks) {
+			result = rank > result ? rank : result;
+		}
+		return result;
+	}
+	__INNER_END
+
+	/**
+	 * @brief the strongest comparison category to which all of the given types can be converted
+	 * @brief 所有给定类型都能转换到的最强比较类别，存在非比较类别时为 void
+	 *
+	 * @note
+	 * （非标准内容）std 中的比较类别也被接受，结果为 my 中对应的类别
+	*/
+	template <typename... Types>
+	struct common_comparison_category {
+		using type = typename __INNER_NAMESPACE::__ordering_of_rank<
+			__INNER_NAMESPACE::__weakest_rank<__INNER_NAMESPACE::__ordering_rank<typename remove_cv<Types>::type>::value...>()
+		>::type;
+	};
+
+	template <typename... Types>
+	using common_comparison_category_t = typename common_comparison_category<Types...>::type;
+	#pragma endregion common_comparison_category
+
+	#pragma region synth_three_way
+	__INNER_BEGIN
+	/**
+	 * @brief (non-standard feature) converts a comparison category of std to the one of my
+	 * @brief （非标准内容）将 std 中的比较类别转换为 my 中对应的类别
+	*/
+	constexpr strong_ordering __ordering_cast(::std::strong_ordering order) noexcept { return order; }
+	constexpr weak_ordering __ordering_cast(::std::weak_ordering order) noexcept { return order; }
+	constexpr partial_ordering __ordering_cast(::std::partial_ordering order) noexcept { return order; }
+	constexpr strong_ordering __ordering_cast(strong_ordering order) noexcept { return order; }
+	constexpr weak_ordering __ordering_cast(weak_ordering order) noexcept { return order; }
+	constexpr partial_ordering __ordering_cast(partial_ordering order) noexcept { return order; }
+
+	/**
+	 * @brief (non-standard feature) synth-three-way: uses operator<=> when available, otherwise operator<
+	 * @brief （非标准内容）synth-three-way：可用时使用 operator<=>，否则以 operator< 合成 weak_ordering
+	*/
+	struct __synth_three_way_t {
+		template <typename T, typename U>
+		constexpr auto operator()(const T& lhs, const U& rhs) const
+			requires requires {
+				static_cast<bool>(lhs < rhs);
+				static_cast<bool>(rhs < lhs);
+			}
+		{
+			if constexpr (requires { __INNER_NAMESPACE::__ordering_cast(lhs <=> rhs); }) {
+				return __INNER_NAMESPACE::__ordering_cast(lhs <=> rhs);
+			}
+			else {
+				return lhs < rhs ? weak_ordering::less : rhs < lhs ? weak_ordering::greater : weak_ordering::equivalent;
+			}
+		}
+	};
+
+	inline constexpr __synth_three_way_t __synth_three_way{};
+
+	template <typename T, typename U>
+	using __synth_three_way_result = decltype(__synth_three_way(declval<T&>(), declval<U&>()));
+	__INNER_END
+	#pragma endregion synth_three_way
+
+	#pragma region bytewise comparison
+	__INNER_BEGIN
+	/**
+	 * @brief (non-standard feature) whether two objects are equal exactly when their object representations are equal
+	 * @brief （非标准内容）两个对象相等当且仅当其对象表示相同，此时可用 memcmp 判断相等
+	 *
+	 * @note
+	 * 浮点数的 +0.0 与 -0.0 相等而 NaN 不等于自身，因此不在此列；复合类型可以特化此模板
+	*/
+	template <typename T, typename U>
+	struct __is_bitwise_equality_comparable: integral_constant<
+		bool,
+		is_same<typename remove_cv<T>::type, typename remove_cv<U>::type>::value && (
+			is_integral<T>::value || is_enum<T>::value || is_pointer<T>::value
+		)
+	> {};
+
+	/**
+	 * @brief (non-standard feature) whether memcmp orders two objects the same way as operator<=>
+	 * @brief （非标准内容）memcmp 的结果是否与 operator<=> 一致，仅单字节的无符号类型满足
+	*/
+	template <typename T, typename U>
+	struct __is_byte_comparable: integral_constant<
+		bool,
+		is_same<typename remove_cv<T>::type, typename remove_cv<U>::type>::value && (
+			is_any_of<typename remove_cv<T>::type, bool, unsigned char, char8_t, ::std::byte>::value ||
+			(is_same<typename remove_cv<T>::type, char>::value && static_cast<char>(-1) > 0)
+		)
+	> {};
+
+	inline bool __bytes_equal(const void* lhs, const void* rhs, ::size_t count) noexcept {
+		return ::std::memcmp(lhs, rhs, count) == 0;
+	}
+
+	inline strong_ordering __bytes_compare(const void* lhs, const void* rhs, ::size_t count) noexcept {
+		const int result = ::std::memcmp(lhs, rhs, count);
+		return result < 0 ? strong_ordering::less : result > 0 ? strong_ordering::greater : strong_ordering::equal;
+	}
+	__INNER_END
+	#pragma endregion bytewise comparison
+
+	#pragma region compare_three_way
+	/**
+	 * @brief the result type of the three-way comparison operator on two types
+	 * @brief 两个类型进行三路比较的结果类型
+	 *
+	 * @note
+	 * （非标准内容）结果为 my 中对应的比较类别
+	*/
+	template <typename T, typename U = T>
+	struct compare_three_way_result {};
+
+	template <typename T, typename U>
+		requires requires (const typename remove_reference<T>::type& lhs, const typename remove_reference<U>::type& rhs) {
+			__INNER_NAMESPACE::__ordering_cast(lhs <=> rhs);
+		}
+	struct compare_three_way_result<T, U> {
+		using type = decltype(__INNER_NAMESPACE::__ordering_cast(
+			declval<const typename remove_reference<T>::type&>() <=> declval<const typename remove_reference<U>::type&>()
+		));
+	};
+
+	template <typename T, typename U = T>
+	using compare_three_way_result_t = typename compare_three_way_result<T, U>::type;
+
+	/**
+	 * @brief function object implementing x <=> y
+	 * @brief 实现 x <=> y 的函数对象
+	*/
+	struct compare_three_way {
+		using is_transparent = void;
+
+		template <typename T, typename U>
+		constexpr compare_three_way_result_t<T, U> operator()(T&& lhs, U&& rhs) const {
+			return __INNER_NAMESPACE::__ordering_cast(static_cast<T&&>(lhs) <=> static_cast<U&&>(rhs));
+		}
+	};
+	#pragma endregion compare_three_way
+
+} // namespace __MY_NAMESPACE
+#endif // __HAS_CPP20
@@ -45,6 +45,49 @@
 
 #pragma endregion __HAS_CPPXX
 
+#pragma region __HAS_SIMD
+
+// 编译目标可用的向量指令集，AVX2 蕴含 SSE2
+#ifndef __HAS_AVX2
+#if defined(__AVX2__)
+#define __HAS_AVX2 1
+#else
+#define __HAS_AVX2 0
+#endif
+#endif // __HAS_AVX2
+
+#ifndef __HAS_SSE2
+#if __HAS_AVX2 || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define __HAS_SSE2 1
+#else
+#define __HAS_SSE2 0
+#endif
+#endif // __HAS_SSE2
+
+#pragma endregion __HAS_SIMD
+
+#pragma region __HAS_INTEGER_SEQ
+
+// 编译器提供的整数序列内建，用于 make_integer_sequence
+#if defined(__has_builtin)
+#if __has_builtin(__make_integer_seq)
+#define __HAS_MAKE_INTEGER_SEQ 1
+#elif __has_builtin(__integer_pack)
+#define __HAS_INTEGER_PACK 1
+#endif
+#elif defined(_MSC_VER)
+#define __HAS_MAKE_INTEGER_SEQ 1
+#endif
+
+#ifndef __HAS_MAKE_INTEGER_SEQ
+#define __HAS_MAKE_INTEGER_SEQ 0
+#endif // __HAS_MAKE_INTEGER_SEQ
+#ifndef __HAS_INTEGER_PACK
+#define __HAS_INTEGER_PACK 0
+#endif // __HAS_INTEGER_PACK
+
+#pragma endregion __HAS_INTEGER_SEQ
+
 #if __HAS_CPP17
 #define __NODISCARD [[nodiscard]]
 #else // ^^^ __HAS_CPP17 / vvv !__HAS_CPP17
@@ -92,6 +135,7 @@
 #pragma endregion __INLINEXX
 
 
-typedef unsigned long long size_t;
+// ::size_t 与 ::ptrdiff_t 由标准库提供，避免与平台的定义冲突
+#include <cstddef>
 
 #endif // ifndef __CORE_H__
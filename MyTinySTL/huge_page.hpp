@@ -0,0 +1,360 @@
+﻿#pragma once
+#include "core.h"
+
+#if __HAS_CPP11
+#include <new>
+#include <atomic>
+#include <cstdint>
+#include "memory.hpp"
+
+// 页映射所需的系统头文件只在此处包含；WIN32_LEAN_AND_MEAN、NOMINMAX 等配置宏由使用者决定
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace __MY_NAMESPACE {
+
+	#pragma region huge_page_allocator
+
+	__INNER_BEGIN
+	// 透明大页的默认大小（x86-64 与 AArch64 上均为 2 MiB）
+	constexpr ::size_t __huge_page_bytes = ::size_t(2) << 20;
+	static_assert((__huge_page_bytes & (__huge_page_bytes - 1)) == 0, "__huge_page_bytes must be a power of two");
+
+	// 系统的普通页大小
+	inline ::size_t __system_page_bytes() noexcept {
+		static const ::size_t page_bytes = []() noexcept -> ::size_t {
+			#if defined(_WIN32)
+			SYSTEM_INFO info;
+			::GetSystemInfo(&info);
+			return info.dwPageSize;
+			#elif defined(__unix__) || defined(__APPLE__)
+			long page = ::sysconf(_SC_PAGESIZE);
+			return page > 0 ? static_cast<::size_t>(page) : 4096;
+			#else
+			return 4096;
+			#endif
+		}();
+		return page_bytes;
+	}
+
+	/**
+	 * @brief (non-standard feature) layout of a page mapping serving one allocation
+	 * @brief （非标准内容）一次分配对应的页映射的布局，分配与释放时以相同的参数计算，因此无需保存头信息
+	*/
+	struct __page_mapping {
+		::size_t length;		// 映射的长度
+		::size_t alignment;		// 映射起始地址的对齐
+		bool huge;				// 是否请求大页
+
+		__page_mapping(::size_t bytes, ::size_t alignment, ::size_t huge_page_bytes) noexcept {
+			::size_t page = __system_page_bytes();
+			// 大页大小用作对齐，不是 2 的幂时视为不使用大页
+			huge = huge_page_bytes > page && (huge_page_bytes & (huge_page_bytes - 1)) == 0 && bytes >= huge_page_bytes;
+			::size_t granularity = huge ? huge_page_bytes : page;
+			length = (bytes + granularity - 1) / granularity * granularity;
+			this->alignment = alignment > granularity ? alignment : granularity;
+		}
+	};
+
+	// 逐页写入以预先触发缺页，anonymous 映射的内容本就为 0
+	inline void __prefault_pages(void* ptr, ::size_t length) noexcept {
+		#if defined(MADV_POPULATE_WRITE)
+		if (::madvise(ptr, length, MADV_POPULATE_WRITE) == 0) {
+			return;
+		}
+		#endif // MADV_POPULATE_WRITE
+		::size_t page = __system_page_bytes();
+		volatile char* p = static_cast<volatile char*>(ptr);
+		for (::size_t offset = 0; offset < length; offset += page) {
+			p[offset] = 0;
+		}
+	}
+
+	/**
+	 * @brief (non-standard feature) maps fresh pages for one allocation, using huge pages for large ones if possible
+	 * @brief （非标准内容）为一次分配映射新的页，较大的分配尽可能使用大页；失败时抛出 std::bad_alloc
+	 * @param populate 是否预先触发缺页，使之后的访问不再产生缺页中断
+	 *
+	 * @note
+	 * POSIX：以 mmap 映射，大页请求先多预留一个大页的地址空间以对齐，再以 madvise(MADV_HUGEPAGE) 请求透明大页；
+	 * 系统未启用透明大页时 madvise 失败，内存仍以普通页正常使用
+	 * 大页映射不使用 MAP_POPULATE，否则在 madvise 之前就会以普通页触发缺页；普通映射直接使用 MAP_POPULATE
+	 * Windows：以 VirtualAlloc 提交普通页（大页需要 SeLockMemoryPrivilege 权限，不做尝试）
+	 * 其他平台：退化为全局 operator new
+	*/
+	inline void* __map_pages(::size_t bytes, ::size_t alignment, ::size_t huge_page_bytes, bool populate) {
+		__page_mapping mapping(bytes == 0 ? 1 : bytes, alignment, huge_page_bytes);
+		#if defined(_WIN32)
+		SYSTEM_INFO info;
+		::GetSystemInfo(&info);
+		void* result = nullptr;
+		if (mapping.alignment <= info.dwAllocationGranularity) {
+			result = ::VirtualAlloc(nullptr, mapping.length, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+		}
+		else {
+			// 预留更大的地址空间以找到对齐的地址，释放后在该地址重新分配；其间可能被其他线程占用，因此重试数次
+			for (int attempt = 0; attempt < 8 && result == nullptr; ++attempt) {
+				char* raw = static_cast<char*>(::VirtualAlloc(nullptr, mapping.length + mapping.alignment, MEM_RESERVE, PAGE_NOACCESS));
+				if (raw == nullptr) {
+					break;
+				}
+				::std::uintptr_t addr = reinterpret_cast<::std::uintptr_t>(raw);
+				void* aligned = reinterpret_cast<void*>((addr + mapping.alignment - 1) & ~(mapping.alignment - 1));
+				::VirtualFree(raw, 0, MEM_RELEASE);
+				result = ::VirtualAlloc(aligned, mapping.length, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+			}
+		}
+		if (result == nullptr) {
+			throw ::std::bad_alloc();
+		}
+		if (populate) {
+			__prefault_pages(result, mapping.length);
+		}
+		return result;
+		#elif defined(__unix__) || defined(__APPLE__)
+		::size_t page = __system_page_bytes();
+		int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+		if (mapping.alignment <= page) {
+			#if defined(MAP_POPULATE)
+			if (populate) {
+				flags |= MAP_POPULATE;
+			}
+			#endif // MAP_POPULATE
+			void* result = ::mmap(nullptr, mapping.length, PROT_READ | PROT_WRITE, flags, -1, 0);
+			if (result == MAP_FAILED) {
+				throw ::std::bad_alloc();
+			}
+			#if !defined(MAP_POPULATE)
+			if (populate) {
+				__prefault_pages(result, mapping.length);
+			}
+			#endif // !MAP_POPULATE
+			return result;
+		}
+
+		// 多预留 alignment - page 字节，对齐后将首尾多余的部分归还
+		::size_t reserved = mapping.length + mapping.alignment - page;
+		void* raw = ::mmap(nullptr, reserved, PROT_READ | PROT_WRITE, flags, -1, 0);
+		if (raw == MAP_FAILED) {
+			throw ::std::bad_alloc();
+		}
+		::std::uintptr_t addr = reinterpret_cast<::std::uintptr_t>(raw);
+		::std::uintptr_t aligned = (addr + mapping.alignment - 1) & ~static_cast<::std::uintptr_t>(mapping.alignment - 1);
+		::size_t head = aligned - addr;
+		::size_t tail = reserved - head - mapping.length;
+		if (head != 0) {
+			::munmap(raw, head);
+		}
+		if (tail != 0) {
+			::munmap(reinterpret_cast<void*>(aligned + mapping.length), tail);
+		}
+		void* result = reinterpret_cast<void*>(aligned);
+
+		#if defined(MADV_HUGEPAGE)
+		if (mapping.huge) {
+			// 未启用透明大页时失败，此时继续使用普通页
+			::madvise(result, mapping.length, MADV_HUGEPAGE);
+		}
+		#endif // MADV_HUGEPAGE
+		if (populate) {
+			__prefault_pages(result, mapping.length);
+		}
+		return result;
+		#else
+		(void)populate;
+		return __allocate_bytes(mapping.length, mapping.alignment);
+		#endif
+	}
+
+	/**
+	 * @brief (non-standard feature) unmaps pages obtained from __map_pages with the same arguments
+	 * @brief （非标准内容）解除由相同参数的 __map_pages 得到的映射
+	*/
+	inline void __unmap_pages(void* ptr, ::size_t bytes, ::size_t alignment, ::size_t huge_page_bytes) noexcept {
+		__page_mapping mapping(bytes == 0 ? 1 : bytes, alignment, huge_page_bytes);
+		#if defined(_WIN32)
+		(void)mapping;
+		::VirtualFree(ptr, 0, MEM_RELEASE);
+		#elif defined(__unix__) || defined(__APPLE__)
+		::munmap(ptr, mapping.length);
+		#else
+		__deallocate_bytes(ptr, mapping.length, mapping.alignment);
+		#endif
+	}
+	__INNER_END
+
+	/**
+	 * @brief (non-standard feature) allocator mapping fresh pages for each allocation, huge pages for large ones
+	 * @brief （非标准内容）每次分配都映射新的页的分配器，不小于 2 MiB 的分配按大页对齐并请求透明大页
+	 * @tparam ValueT 分配的对象类型
+	 *
+	 * @note
+	 * 接口与 allocator 相同，适合数 GB 的 vector、哈希表等大块连续存储，以减少 TLB 缺失；
+	 * 每次分配至少占用一个普通页，不适合结点容器
+	 * 需要预先触发缺页或自定义大页大小时，使用 pmr::huge_page_resource
+	*/
+	template <typename ValueT>
+	struct huge_page_allocator {
+
+	public:
+		using value_type = ValueT;
+		using pointer = ValueT*;
+		using const_pointer = const ValueT*;
+		using reference = ValueT&;
+		using const_reference = const ValueT&;
+		using size_type = ::size_t;
+		using difference_type = ::ptrdiff_t;
+
+		template <typename OtherValueT>
+		struct rebind { using other = huge_page_allocator<OtherValueT>; };
+
+		/** @brief 所有实例均相等，容器移动赋值与交换时无需比较分配器 */
+		using is_always_equal = true_type;
+		using propagate_on_container_move_assignment = true_type;
+
+	public:
+		constexpr huge_page_allocator() noexcept {}
+
+		constexpr huge_page_allocator(const huge_page_allocator& other) noexcept = default;
+
+		template <typename OtherValueT>
+		constexpr huge_page_allocator(const huge_page_allocator<OtherValueT>&) noexcept {}
+
+		__CONSTEXPR20 ~huge_page_allocator() = default;
+
+		/**
+		 * @brief returns the largest supported allocation size
+		 * @brief 返回可分配的最大对象个数
+		*/
+		constexpr size_type max_size() const noexcept {
+			return static_cast<size_type>(-1) / 2 / sizeof(ValueT);
+		}
+
+		/**
+		 * @brief allocates uninitialized storage
+		 * @param n the number of objects to allocate storage for
+		 * @return Pointer to the first element of an array of n objects of type T whose elements have not been constructed yet.
+		*/
+		__NODISCARD pointer allocate(size_type n) {
+			if (n > max_size()) {
+				throw ::std::bad_array_new_length();
+			}
+			return static_cast<pointer>(__INNER_NAMESPACE::__map_pages(
+				n * sizeof(ValueT), alignment_of<ValueT>::value, __INNER_NAMESPACE::__huge_page_bytes, false
+			));
+		}
+
+		/**
+		 * @brief deallocates storage
+		 * @param ptr pointer obtained from allocate()
+		 * @param n number of objects earlier passed to allocate()
+		*/
+		void deallocate(pointer ptr, size_type n) noexcept {
+			__INNER_NAMESPACE::__unmap_pages(ptr, n * sizeof(ValueT), alignment_of<ValueT>::value, __INNER_NAMESPACE::__huge_page_bytes);
+		}
+
+	};
+
+	/**
+	 * @brief compares two huge_page_allocator instances
+	 * @param lhs huge page allocators to compare
+	 * @param rhs huge page allocators to compare
+	 * @return true, every mapping can be released by any huge page allocator
+	*/
+	template <typename ValueT1, typename ValueT2>
+	constexpr bool operator==(const huge_page_allocator<ValueT1>&, const huge_page_allocator<ValueT2>&) noexcept {
+		return true;
+	}
+
+	#if !__HAS_CPP20
+	/**
+	 * @brief compares two huge_page_allocator instances
+	 * @param lhs huge page allocators to compare
+	 * @param rhs huge page allocators to compare
+	 * @return false, every mapping can be released by any huge page allocator
+	*/
+	template <typename ValueT1, typename ValueT2>
+	constexpr bool operator!=(const huge_page_allocator<ValueT1>&, const huge_page_allocator<ValueT2>&) noexcept {
+		return false;
+	}
+	#endif // !__HAS_CPP20
+
+	#pragma endregion huge_page_allocator
+
+	#pragma region huge_page_resource
+
+	namespace pmr {
+
+		/**
+		 * @brief (non-standard feature) the options of huge_page_resource
+		 * @brief （非标准内容）huge_page_resource 的选项
+		*/
+		struct huge_page_options {
+			// 不小于该值的分配按其对齐并请求大页；为 0 或不是 2 的幂时不使用大页
+			::size_t huge_page_bytes = __MY_NAMESPACE::__INNER_NAMESPACE::__huge_page_bytes;
+			// 是否在分配时预先触发缺页
+			bool populate = false;
+		};
+
+		/**
+		 * @brief (non-standard feature) memory_resource mapping fresh pages for each allocation, huge pages for large ones
+		 * @brief （非标准内容）每次分配都映射新的页的内存资源，较大的分配请求透明大页，可选预先触发缺页
+		 *
+		 * @note
+		 * 与 huge_page_allocator 使用相同的映射方式，系统不支持大页时退化为普通页
+		 * 作为 monotonic_buffer_resource 的上游时即构成以大页为后备的 arena：缓冲区翻倍增长到大页大小后都落在大页上
+		*/
+		class huge_page_resource: public memory_resource {
+		private:
+			huge_page_options __options;
+			::std::atomic<::size_t> __bytes_mapped;
+
+		public:
+			huge_page_resource() noexcept: huge_page_resource(huge_page_options()) {}
+
+			explicit huge_page_resource(const huge_page_options& options) noexcept: __options(options), __bytes_mapped(0) {}
+
+			huge_page_resource(const huge_page_resource&) = delete;
+			huge_page_resource& operator=(const huge_page_resource&) = delete;
+
+			huge_page_options options() const noexcept {
+				return __options;
+			}
+
+			/**
+			 * @brief (non-standard feature) bytes of the mappings currently held, including rounding
+			 * @brief （非标准内容）当前持有的映射的总字节数，包括按页取整的部分
+			*/
+			::size_t bytes_mapped() const noexcept {
+				return __bytes_mapped.load(::std::memory_order_relaxed);
+			}
+
+		protected:
+			void* do_allocate(::size_t bytes, ::size_t alignment) override {
+				void* result = __MY_NAMESPACE::__INNER_NAMESPACE::__map_pages(bytes, alignment, __options.huge_page_bytes, __options.populate);
+				__MY_NAMESPACE::__INNER_NAMESPACE::__page_mapping mapping(bytes == 0 ? 1 : bytes, alignment, __options.huge_page_bytes);
+				__bytes_mapped.fetch_add(mapping.length, ::std::memory_order_relaxed);
+				return result;
+			}
+
+			void do_deallocate(void* ptr, ::size_t bytes, ::size_t alignment) override {
+				__MY_NAMESPACE::__INNER_NAMESPACE::__unmap_pages(ptr, bytes, alignment, __options.huge_page_bytes);
+				__MY_NAMESPACE::__INNER_NAMESPACE::__page_mapping mapping(bytes == 0 ? 1 : bytes, alignment, __options.huge_page_bytes);
+				__bytes_mapped.fetch_sub(mapping.length, ::std::memory_order_relaxed);
+			}
+
+			bool do_is_equal(const memory_resource& other) const noexcept override {
+				return this == &other;
+			}
+		};
+
+	} // namespace __MY_NAMESPACE::pmr
+
+	#pragma endregion huge_page_resource
+
+} // namespace __MY_NAMESPACE
+#endif // __HAS_CPP11
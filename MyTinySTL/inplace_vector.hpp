@@ -0,0 +1,713 @@
+﻿#pragma once
+#include "core.h"
+
+#if __HAS_CPP11
+#include <new>
+#include "vector.hpp"
+
+namespace __MY_NAMESPACE {
+
+	#pragma region inplace_vector
+	__INNER_BEGIN
+	// 存储的种类：0 平凡类型，1 其他可平凡复制的类型，2 其余类型，3 容量为 0
+	template <typename T, ::size_t N>
+	struct __inplace_vector_kind: integral_constant<
+		int,
+		N == 0 ? 3 : is_trivial<T>::value ? 0 : is_trivially_copyable<T>::value ? 1 : 2
+	> {};
+
+	template <typename T, ::size_t N, int = __inplace_vector_kind<T, N>::value>
+	struct __inplace_vector_storage;
+
+	// 平凡类型：普通数组，可用于常量求值，复制、移动与析构均为平凡操作
+	template <typename T, ::size_t N>
+	struct __inplace_vector_storage<T, N, 0> {
+		T __elems[N];
+		::size_t __size;
+
+		__CONSTEXPR20 __inplace_vector_storage() noexcept: __size(0) {
+			#if __HAS_CPP20
+			// 常量求值中不能读取未初始化的对象，而平凡的复制会读取全部 N 个元素
+			if (__builtin_is_constant_evaluated()) {
+				for (::size_t i = 0; i != N; ++i) {
+					__elems[i] = T();
+				}
+			}
+			#endif // __HAS_CPP20
+		}
+
+		__CONSTEXPR14 T* __data() noexcept { return __elems; }
+		constexpr const T* __data() const noexcept { return __elems; }
+	};
+
+	// 可平凡复制的类型：元素置于联合体中以免默认构造，复制、移动与析构仍为平凡操作
+	template <typename T, ::size_t N>
+	struct __inplace_vector_storage<T, N, 1> {
+		union {
+			T __elems[N];
+		};
+		::size_t __size;
+
+		__inplace_vector_storage() noexcept: __size(0) {}
+
+		T* __data() noexcept { return __elems; }
+		const T* __data() const noexcept { return __elems; }
+	};
+
+	// 其余类型：逐个复制、移动与析构存活的元素
+	template <typename T, ::size_t N>
+	struct __inplace_vector_storage<T, N, 2> {
+		union {
+			T __elems[N];
+		};
+		::size_t __size;
+
+		__inplace_vector_storage() noexcept: __size(0) {}
+
+		__inplace_vector_storage(const __inplace_vector_storage& other): __size(0) {
+			__size = static_cast<::size_t>(
+				__MY_NAMESPACE::uninitialized_copy(other.__data(), other.__data() + other.__size, __data()) - __data()
+			);
+		}
+
+		__inplace_vector_storage(__inplace_vector_storage&& other) noexcept(is_nothrow_move_constructible<T>::value): __size(0) {
+			__size = static_cast<::size_t>(
+				__MY_NAMESPACE::uninitialized_move(other.__data(), other.__data() + other.__size, __data()) - __data()
+			);
+		}
+
+		~__inplace_vector_storage() {
+			__MY_NAMESPACE::destroy(__data(), __data() + __size);
+		}
+
+		__inplace_vector_storage& operator=(const __inplace_vector_storage& other) {
+			if (this != __MY_NAMESPACE::addressof(other)) {
+				__assign(other.__data(), other.__size);
+			}
+			return *this;
+		}
+
+		__inplace_vector_storage& operator=(__inplace_vector_storage&& other) noexcept(
+			is_nothrow_move_constructible<T>::value && is_nothrow_move_assignable<T>::value
+		) {
+			if (this != __MY_NAMESPACE::addressof(other)) {
+				__assign(::std::make_move_iterator(other.__data()), other.__size);
+			}
+			return *this;
+		}
+
+		// 前 count 个已有元素赋值，多余的析构，不足的构造
+		template <typename It>
+		void __assign(It first, ::size_t count) {
+			T* current = __data();
+			T* const assign_last = __data() + (count < __size ? count : __size);
+			for (; current != assign_last; ++current, ++first) {
+				*current = *first;
+			}
+			if (count <= __size) {
+				__MY_NAMESPACE::destroy(current, __data() + __size);
+			}
+			else {
+				__MY_NAMESPACE::uninitialized_copy_n(first, count - __size, current);
+			}
+			__size = count;
+		}
+
+		T* __data() noexcept { return __elems; }
+		const T* __data() const noexcept { return __elems; }
+	};
+
+	template <typename T, ::size_t N>
+	struct __inplace_vector_storage<T, N, 3> {
+		::size_t __size;
+
+		constexpr __inplace_vector_storage() noexcept: __size(0) {}
+
+		__CONSTEXPR14 T* __data() noexcept { return nullptr; }
+		constexpr const T* __data() const noexcept { return nullptr; }
+	};
+	__INNER_END
+
+	/**
+	 * @brief (non-standard feature) dynamic contiguous array with a fixed capacity stored inside the object
+	 * @brief （非标准内容）容量固定为 N、元素存放在对象内部的动态连续数组，从不分配内存
+	 * @tparam T 元素类型
+	 * @tparam N 容量
+	 *
+	 * @note
+	 * 接口与 vector 相同，但没有分配器；超出容量时 push_back、insert 等抛出 std::bad_alloc，
+	 * try_push_back / try_emplace_back 则返回空指针，unchecked_push_back / unchecked_emplace_back 不做检查
+	 * T 可平凡复制时 inplace_vector 本身可平凡复制；T 为平凡类型时全部操作（C++20 起）可用于常量求值
+	 * 运行时满足 is_trivially_relocatable 的元素在中间插入与删除时以 memmove 搬移
+	*/
+	template <typename T, ::size_t N>
+	class inplace_vector {
+	public:
+		using value_type = T;
+		using size_type = ::size_t;
+		using difference_type = ::ptrdiff_t;
+		using reference = T&;
+		using const_reference = const T&;
+		using pointer = T*;
+		using const_pointer = const T*;
+		using iterator = T*;
+		using const_iterator = const T*;
+		using reverse_iterator = ::std::reverse_iterator<iterator>;
+		using const_reverse_iterator = ::std::reverse_iterator<const_iterator>;
+
+	private:
+		__INNER_NAMESPACE::__inplace_vector_storage<T, N> __storage;
+
+		__CONSTEXPR14 T* __begin() noexcept { return __storage.__data(); }
+		constexpr const T* __begin() const noexcept { return __storage.__data(); }
+		__CONSTEXPR14 T* __end() noexcept { return __storage.__data() + __storage.__size; }
+		constexpr const T* __end() const noexcept { return __storage.__data() + __storage.__size; }
+
+		#pragma region element helpers
+		static void __throw_overflow() {
+			throw ::std::bad_alloc();
+		}
+
+		// 常量求值中不能使用布置 new、memcpy 与 memmove，只能逐个赋值
+		static __CONSTEXPR20 bool __is_runtime() noexcept {
+			#if __HAS_CPP20
+			return !__builtin_is_constant_evaluated();
+			#else // ^^^ __HAS_CPP20 / vvv !__HAS_CPP20
+			return true;
+			#endif // __HAS_CPP20
+		}
+
+		static __CONSTEXPR20 bool __relocates_bitwise() noexcept {
+			return __is_runtime() && is_trivially_relocatable<T>::value;
+		}
+
+		// 常量求值中不能使用布置 new，平凡类型的元素已经存活，改为赋值
+		template <typename... Args>
+		static __CONSTEXPR20 void __construct(T* ptr, Args&&... args) {
+			#if __HAS_CPP20
+			if constexpr (is_trivial<T>::value) {
+				if (__builtin_is_constant_evaluated()) {
+					*ptr = T(__MY_NAMESPACE::forward<Args>(args)...);
+					return;
+				}
+			}
+			#endif // __HAS_CPP20
+			::new (static_cast<void*>(ptr)) T(__MY_NAMESPACE::forward<Args>(args)...);
+		}
+
+		// 在末尾构造 count 个以 args 构造的元素，抛出异常时析构本次构造的元素
+		template <typename... Args>
+		__CONSTEXPR20 void __append_n(size_type count, const Args&... args) {
+			T* const first = __end();
+			T* current = first;
+			try {
+				for (; count > 0; --count, ++current) {
+					__construct(current, args...);
+				}
+			}
+			catch (...) {
+				__MY_NAMESPACE::destroy(first, current);
+				throw;
+			}
+			__storage.__size += static_cast<size_type>(current - first);
+		}
+
+		__CONSTEXPR20 void __append_fill(size_type count, const T& value) {
+			if (__is_runtime()) {
+				__MY_NAMESPACE::uninitialized_fill_n(__end(), count, value);
+				__storage.__size += count;
+				return;
+			}
+			__append_n(count, value);
+		}
+
+		__CONSTEXPR20 void __append_value(size_type count) {
+			if (__is_runtime()) {
+				__MY_NAMESPACE::uninitialized_value_construct_n(__end(), count);
+				__storage.__size += count;
+				return;
+			}
+			__append_n(count);
+		}
+
+		/**
+		 * @brief appends the elements of [first, last), returns the old end
+		 * @brief 在末尾追加 [first, last) 中的元素，返回原来的末尾；超出容量或抛出异常时析构本次追加的元素，容器保持不变
+		*/
+		template <typename It>
+		__CONSTEXPR20 T* __append_range(It first, It last, false_type) {
+			T* const old_end = __end();
+			try {
+				for (; first != last; ++first) {
+					if (__storage.__size == N) {
+						__throw_overflow();
+					}
+					__construct(__end(), *first);
+					++__storage.__size;
+				}
+			}
+			catch (...) {
+				T* const new_end = __end();
+				__storage.__size = static_cast<size_type>(old_end - __begin());
+				__MY_NAMESPACE::destroy(old_end, new_end);
+				throw;
+			}
+			return old_end;
+		}
+
+		template <typename It>
+		__CONSTEXPR20 T* __append_range(It first, It last, true_type) {
+			const size_type count = static_cast<size_type>(::std::distance(first, last));
+			if (count > N - size()) {
+				__throw_overflow();
+			}
+			T* const old_end = __end();
+			if (__is_runtime()) {
+				__MY_NAMESPACE::uninitialized_copy(first, last, old_end);
+				__storage.__size += count;
+				return old_end;
+			}
+			return __append_range(first, last, false_type());
+		}
+
+		// 将最后一个元素移到 position，其后的元素依次后移一位
+		__CONSTEXPR20 void __rotate_last(T* position) {
+			T* const last = __end() - 1;
+			if (position == last) {
+				return;
+			}
+			if (__relocates_bitwise()) {
+				alignas(T) unsigned char buffer[sizeof(T)];
+				T* const temp = reinterpret_cast<T*>(buffer);
+				__MY_NAMESPACE::relocate_at(last, temp);
+				__MY_NAMESPACE::relocate(position, last, position + 1);
+				__MY_NAMESPACE::relocate_at(temp, position);
+				return;
+			}
+			T temp(__MY_NAMESPACE::move(*last));
+			for (T* current = last; current != position; --current) {
+				*current = __MY_NAMESPACE::move(*(current - 1));
+			}
+			*position = __MY_NAMESPACE::move(temp);
+		}
+
+		// 交换 [first, middle) 与 [middle, last) 的位置
+		static __CONSTEXPR20 void __rotate(T* first, T* middle, T* last) {
+			if (first == middle || middle == last) {
+				return;
+			}
+			T* next = middle;
+			while (first != next) {
+				__INNER_NAMESPACE::__swap_adl(*first++, *next++);
+				if (next == last) {
+					next = middle;
+				}
+				else if (first == middle) {
+					middle = next;
+				}
+			}
+		}
+
+		template <typename It>
+		__CONSTEXPR20 void __assign_range(It first, It last, false_type) {
+			T* current = __begin();
+			for (; first != last && current != __end(); ++first, ++current) {
+				*current = *first;
+			}
+			if (current != __end()) {
+				__MY_NAMESPACE::destroy(current, __end());
+				__storage.__size = static_cast<size_type>(current - __begin());
+				return;
+			}
+			__append_range(first, last, false_type());
+		}
+
+		template <typename It>
+		__CONSTEXPR20 void __assign_range(It first, It last, true_type) {
+			if (static_cast<size_type>(::std::distance(first, last)) > N) {
+				__throw_overflow();
+			}
+			__assign_range(first, last, false_type());
+		}
+		#pragma endregion element helpers
+
+	public:
+		inplace_vector() = default;
+
+		__CONSTEXPR20 explicit inplace_vector(size_type count) {
+			if (count > N) {
+				__throw_overflow();
+			}
+			__append_value(count);
+		}
+
+		__CONSTEXPR20 inplace_vector(size_type count, const T& value) {
+			if (count > N) {
+				__throw_overflow();
+			}
+			__append_fill(count, value);
+		}
+
+		template <typename InputIt, typename = typename enable_if<__INNER_NAMESPACE::__is_input_iterator<InputIt>::value>::type>
+		__CONSTEXPR20 inplace_vector(InputIt first, InputIt last) {
+			__append_range(first, last, __INNER_NAMESPACE::__is_forward_iterator<InputIt>());
+		}
+
+		__CONSTEXPR20 inplace_vector(::std::initializer_list<T> init): inplace_vector(init.begin(), init.end()) {}
+
+		__CONSTEXPR20 inplace_vector& operator=(::std::initializer_list<T> init) {
+			assign(init.begin(), init.end());
+			return *this;
+		}
+
+		/**
+		 * @brief replaces the contents with count copies of value
+		 * @brief 将内容替换为 count 个 value 的副本，count 超过 N 时抛出 std::bad_alloc
+		*/
+		__CONSTEXPR20 void assign(size_type count, const T& value) {
+			if (count > N) {
+				__throw_overflow();
+			}
+			const size_type size = this->size();
+			T* current = __begin();
+			for (T* assign_last = __begin() + (count < size ? count : size); current != assign_last; ++current) {
+				*current = value;
+			}
+			if (count <= size) {
+				__MY_NAMESPACE::destroy(current, __end());
+				__storage.__size = count;
+				return;
+			}
+			__append_fill(count - size, value);
+		}
+
+		template <typename InputIt, typename = typename enable_if<__INNER_NAMESPACE::__is_input_iterator<InputIt>::value>::type>
+		__CONSTEXPR20 void assign(InputIt first, InputIt last) {
+			__assign_range(first, last, __INNER_NAMESPACE::__is_forward_iterator<InputIt>());
+		}
+
+		__CONSTEXPR20 void assign(::std::initializer_list<T> init) {
+			assign(init.begin(), init.end());
+		}
+
+		#pragma region element access
+		__CONSTEXPR20 reference at(size_type index) {
+			if (index >= size()) {
+				throw ::std::out_of_range("inplace_vector index out of range");
+			}
+			return __begin()[index];
+		}
+
+		__CONSTEXPR20 const_reference at(size_type index) const {
+			if (index >= size()) {
+				throw ::std::out_of_range("inplace_vector index out of range");
+			}
+			return __begin()[index];
+		}
+
+		__CONSTEXPR14 reference operator[](size_type index) noexcept { return __begin()[index]; }
+		constexpr const_reference operator[](size_type index) const noexcept { return __begin()[index]; }
+
+		__CONSTEXPR14 reference front() noexcept { return *__begin(); }
+		constexpr const_reference front() const noexcept { return *__begin(); }
+
+		__CONSTEXPR14 reference back() noexcept { return *(__end() - 1); }
+		constexpr const_reference back() const noexcept { return *(__end() - 1); }
+
+		__CONSTEXPR14 T* data() noexcept { return __begin(); }
+		constexpr const T* data() const noexcept { return __begin(); }
+		#pragma endregion element access
+
+		#pragma region iterators
+		__CONSTEXPR14 iterator begin() noexcept { return __begin(); }
+		constexpr const_iterator begin() const noexcept { return __begin(); }
+		constexpr const_iterator cbegin() const noexcept { return __begin(); }
+
+		__CONSTEXPR14 iterator end() noexcept { return __end(); }
+		constexpr const_iterator end() const noexcept { return __end(); }
+		constexpr const_iterator cend() const noexcept { return __end(); }
+
+		__CONSTEXPR20 reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+		__CONSTEXPR20 const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+		__CONSTEXPR20 const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(end()); }
+
+		__CONSTEXPR20 reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+		__CONSTEXPR20 const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+		__CONSTEXPR20 const_reverse_iterator crend() const noexcept { return const_reverse_iterator(begin()); }
+		#pragma endregion iterators
+
+		#pragma region capacity
+		__NODISCARD constexpr bool empty() const noexcept { return __storage.__size == 0; }
+
+		constexpr size_type size() const noexcept { return __storage.__size; }
+
+		static constexpr size_type capacity() noexcept { return N; }
+
+		static constexpr size_type max_size() noexcept { return N; }
+
+		/**
+		 * @brief checks that count elements fit, the capacity never changes
+		 * @brief 容量固定，count 超过 N 时抛出 std::bad_alloc，否则不做任何事
+		*/
+		static __CONSTEXPR20 void reserve(size_type count) {
+			if (count > N) {
+				__throw_overflow();
+			}
+		}
+
+		static __CONSTEXPR20 void shrink_to_fit() noexcept {}
+		#pragma endregion capacity
+
+		#pragma region modifiers
+		__CONSTEXPR20 void clear() noexcept {
+			__MY_NAMESPACE::destroy(__begin(), __end());
+			__storage.__size = 0;
+		}
+
+		__CONSTEXPR20 iterator insert(const_iterator position, const T& value) {
+			return emplace(position, value);
+		}
+
+		__CONSTEXPR20 iterator insert(const_iterator position, T&& value) {
+			return emplace(position, __MY_NAMESPACE::move(value));
+		}
+
+		/**
+		 * @brief inserts count copies of value before position
+		 * @brief 在 position 之前插入 count 个 value 的副本：先在末尾构造，再旋转到位
+		*/
+		__CONSTEXPR20 iterator insert(const_iterator position, size_type count, const T& value) {
+			const size_type index = static_cast<size_type>(position - __begin());
+			if (count > N - size()) {
+				__throw_overflow();
+			}
+			T* const old_end = __end();
+			__append_fill(count, value);
+			__rotate(__begin() + index, old_end, __end());
+			return __begin() + index;
+		}
+
+		template <typename InputIt, typename = typename enable_if<__INNER_NAMESPACE::__is_input_iterator<InputIt>::value>::type>
+		__CONSTEXPR20 iterator insert(const_iterator position, InputIt first, InputIt last) {
+			const size_type index = static_cast<size_type>(position - __begin());
+			T* const old_end = __append_range(first, last, __INNER_NAMESPACE::__is_forward_iterator<InputIt>());
+			__rotate(__begin() + index, old_end, __end());
+			return __begin() + index;
+		}
+
+		__CONSTEXPR20 iterator insert(const_iterator position, ::std::initializer_list<T> init) {
+			return insert(position, init.begin(), init.end());
+		}
+
+		/**
+		 * @brief constructs an element in-place before position
+		 * @brief 在 position 之前原地构造元素：先在末尾构造（实参可能引用已有元素），再移到 position
+		*/
+		template <typename... Args>
+		__CONSTEXPR20 iterator emplace(const_iterator position, Args&&... args) {
+			const size_type index = static_cast<size_type>(position - __begin());
+			emplace_back(__MY_NAMESPACE::forward<Args>(args)...);
+			__rotate_last(__begin() + index);
+			return __begin() + index;
+		}
+
+		__CONSTEXPR20 iterator erase(const_iterator position) {
+			return erase(position, position + 1);
+		}
+
+		__CONSTEXPR20 iterator erase(const_iterator first, const_iterator last) {
+			T* const erase_first = __begin() + (first - __begin());
+			T* const erase_last = __begin() + (last - __begin());
+			if (erase_first == erase_last) {
+				return erase_first;
+			}
+			if (__relocates_bitwise()) {
+				__MY_NAMESPACE::destroy(erase_first, erase_last);
+				__MY_NAMESPACE::relocate(erase_last, __end(), erase_first);
+			}
+			else {
+				T* new_last = erase_first;
+				for (T* current = erase_last; current != __end(); ++new_last, ++current) {
+					*new_last = __MY_NAMESPACE::move(*current);
+				}
+				__MY_NAMESPACE::destroy(new_last, __end());
+			}
+			__storage.__size -= static_cast<size_type>(erase_last - erase_first);
+			return erase_first;
+		}
+
+		__CONSTEXPR20 void push_back(const T& value) {
+			emplace_back(value);
+		}
+
+		__CONSTEXPR20 void push_back(T&& value) {
+			emplace_back(__MY_NAMESPACE::move(value));
+		}
+
+		/**
+		 * @brief appends an element, throws std::bad_alloc when full
+		 * @brief 在末尾原地构造元素，已满时抛出 std::bad_alloc
+		*/
+		template <typename... Args>
+		__CONSTEXPR20 reference emplace_back(Args&&... args) {
+			if (__storage.__size == N) {
+				__throw_overflow();
+			}
+			return unchecked_emplace_back(__MY_NAMESPACE::forward<Args>(args)...);
+		}
+
+		/**
+		 * @brief appends an element if there is room
+		 * @brief 有空余容量时在末尾原地构造元素并返回其地址，已满时不做任何事并返回空指针
+		*/
+		template <typename... Args>
+		__CONSTEXPR20 T* try_emplace_back(Args&&... args) {
+			if (__storage.__size == N) {
+				return nullptr;
+			}
+			return __MY_NAMESPACE::addressof(unchecked_emplace_back(__MY_NAMESPACE::forward<Args>(args)...));
+		}
+
+		__CONSTEXPR20 T* try_push_back(const T& value) {
+			return try_emplace_back(value);
+		}
+
+		__CONSTEXPR20 T* try_push_back(T&& value) {
+			return try_emplace_back(__MY_NAMESPACE::move(value));
+		}
+
+		/**
+		 * @brief appends an element without checking the capacity
+		 * @brief 在末尾原地构造元素，调用方须保证未满
+		*/
+		template <typename... Args>
+		__CONSTEXPR20 reference unchecked_emplace_back(Args&&... args) {
+			T* const position = __end();
+			__construct(position, __MY_NAMESPACE::forward<Args>(args)...);
+			++__storage.__size;
+			return *position;
+		}
+
+		__CONSTEXPR20 reference unchecked_push_back(const T& value) {
+			return unchecked_emplace_back(value);
+		}
+
+		__CONSTEXPR20 reference unchecked_push_back(T&& value) {
+			return unchecked_emplace_back(__MY_NAMESPACE::move(value));
+		}
+
+		__CONSTEXPR20 void pop_back() noexcept {
+			--__storage.__size;
+			__MY_NAMESPACE::destroy_at(__end());
+		}
+
+		/**
+		 * @brief changes the number of elements, appending value-initialized elements
+		 * @brief 改变元素个数，新增的元素值初始化，count 超过 N 时抛出 std::bad_alloc
+		*/
+		__CONSTEXPR20 void resize(size_type count) {
+			if (count <= size()) {
+				__MY_NAMESPACE::destroy(__begin() + count, __end());
+				__storage.__size = count;
+				return;
+			}
+			if (count > N) {
+				__throw_overflow();
+			}
+			__append_value(count - size());
+		}
+
+		__CONSTEXPR20 void resize(size_type count, const T& value) {
+			if (count <= size()) {
+				__MY_NAMESPACE::destroy(__begin() + count, __end());
+				__storage.__size = count;
+				return;
+			}
+			if (count > N) {
+				__throw_overflow();
+			}
+			__append_fill(count - size(), value);
+		}
+
+		/**
+		 * @brief swaps the contents
+		 * @brief 交换两个 inplace_vector 的内容：交换共同长度的部分，较长一方多出的元素转移到另一方
+		*/
+		__CONSTEXPR20 void swap(inplace_vector& other) noexcept(
+			is_nothrow_move_constructible<T>::value && is_nothrow_swappable<T>::value
+		) {
+			inplace_vector& shorter = size() < other.size() ? *this : other;
+			inplace_vector& longer = size() < other.size() ? other : *this;
+			const size_type common = shorter.size();
+			__MY_NAMESPACE::swap_ranges(__begin(), __begin() + common, other.__begin());
+			T* const tail = longer.__begin() + common;
+			if (__relocates_bitwise()) {
+				__MY_NAMESPACE::uninitialized_relocate(tail, longer.__end(), shorter.__end());
+				shorter.__storage.__size = longer.size();
+			}
+			else {
+				for (T* current = tail; current != longer.__end(); ++current) {
+					shorter.unchecked_emplace_back(__MY_NAMESPACE::move(*current));
+				}
+				__MY_NAMESPACE::destroy(tail, longer.__end());
+			}
+			longer.__storage.__size = common;
+		}
+		#pragma endregion modifiers
+	};
+
+	template <typename T, ::size_t N>
+	__CONSTEXPR20 void swap(inplace_vector<T, N>& lhs, inplace_vector<T, N>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+		lhs.swap(rhs);
+	}
+
+	// 元素就存放在对象内部，不持有指向自身的指针
+	template <typename T, ::size_t N>
+	struct is_trivially_relocatable<inplace_vector<T, N>>: is_trivially_relocatable<T> {};
+
+	/**
+	 * @brief lexicographically compares the values in the inplace_vector
+	 * @brief 按字典序比较两个 inplace_vector，可按位比较的元素在运行时使用 memcmp
+	*/
+	template <typename T, ::size_t N>
+	__NODISCARD __CONSTEXPR20 bool operator==(const inplace_vector<T, N>& lhs, const inplace_vector<T, N>& rhs) {
+		return __INNER_NAMESPACE::__contiguous_equal(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+	}
+
+	#if __HAS_CPP20
+	template <typename T, ::size_t N>
+	__NODISCARD constexpr __INNER_NAMESPACE::__synth_three_way_result<const T, const T> operator<=>(
+		const inplace_vector<T, N>& lhs, const inplace_vector<T, N>& rhs
+	) {
+		return __INNER_NAMESPACE::__contiguous_three_way(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+	}
+	#else // ^^^ __HAS_CPP20 / vvv !__HAS_CPP20
+	template <typename T, ::size_t N>
+	__NODISCARD bool operator!=(const inplace_vector<T, N>& lhs, const inplace_vector<T, N>& rhs) {
+		return !(lhs == rhs);
+	}
+
+	template <typename T, ::size_t N>
+	__NODISCARD bool operator<(const inplace_vector<T, N>& lhs, const inplace_vector<T, N>& rhs) {
+		return __INNER_NAMESPACE::__contiguous_less(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+	}
+
+	template <typename T, ::size_t N>
+	__NODISCARD bool operator>(const inplace_vector<T, N>& lhs, const inplace_vector<T, N>& rhs) {
+		return rhs < lhs;
+	}
+
+	template <typename T, ::size_t N>
+	__NODISCARD bool operator<=(const inplace_vector<T, N>& lhs, const inplace_vector<T, N>& rhs) {
+		return !(rhs < lhs);
+	}
+
+	template <typename T, ::size_t N>
+	__NODISCARD bool operator>=(const inplace_vector<T, N>& lhs, const inplace_vector<T, N>& rhs) {
+		return !(lhs < rhs);
+	}
+	#endif // __HAS_CPP20
+	#pragma endregion inplace_vector
+
+} // namespace __MY_NAMESPACE
+#endif // __HAS_CPP11
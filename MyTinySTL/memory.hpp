@@ -1,9 +1,1190 @@
-#pragma once
-#include "macros.h"
-#include <cstddef>
+﻿#pragma once
+#include "core.h"
+
+#if __HAS_CPP11
+#include <new>
+#include <exception>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+#include "type_traits.hpp"
+#include "utility.hpp"
 
 namespace __MY_NAMESPACE {
 
+	#pragma region addressof
+	/**
+	 * @brief obtains the actual address of an object, even if the & operator is overloaded
+	 * @brief 获取对象的实际地址，即使其重载了 operator&
+	 * @param arg 左值对象
+	*/
+	template <typename T>
+	constexpr T* addressof(T& arg) noexcept {
+		return __builtin_addressof(arg);
+	}
+
+	// 禁止获取右值的地址
+	template <typename T>
+	const T* addressof(const T&&) = delete;
+	#pragma endregion addressof
+
+	#pragma region construct_at destroy_at
+	/**
+	 * @brief creates an object at a given address
+	 * @brief 在给定地址以 args 构造对象
+	 * @return 指向新对象的指针
+	*/
+	template <typename T, typename... Args>
+	T* construct_at(T* ptr, Args&&... args) {
+		return ::new (const_cast<void*>(static_cast<const volatile void*>(ptr))) T(__MY_NAMESPACE::forward<Args>(args)...);
+	}
+
+	template <typename ForwardIt>
+	__CONSTEXPR20 void destroy(ForwardIt first, ForwardIt last);
+
+	__INNER_BEGIN
+	template <typename T>
+	__CONSTEXPR20 void __destroy_at(T* ptr, false_type) {
+		ptr->~T();
+	}
+
+	template <typename T>
+	__CONSTEXPR20 void __destroy_at(T* ptr, true_type) {
+		__MY_NAMESPACE::destroy(*ptr + 0, *ptr + extent<T>::value);
+	}
+	__INNER_END
+
+	/**
+	 * @brief destroys an object at a given address
+	 * @brief 析构给定地址上的对象；若为数组，则逐个析构其元素
+	*/
+	template <typename T>
+	__CONSTEXPR20 void destroy_at(T* ptr) {
+		__INNER_NAMESPACE::__destroy_at(ptr, is_array<T>());
+	}
+	#pragma endregion construct_at destroy_at
+
+	#pragma region uninitialized memory algorithms
+
+	__INNER_BEGIN
+	// 迭代器所指对象的类型
+	template <typename It>
+	using __iter_value_t = typename remove_cv<typename remove_reference<decltype(*declval<It&>())>::type>::type;
+
+	// 取得迭代器所指存储的 void* 地址，用于布置 new
+	template <typename It>
+	void* __voidify(It& it) noexcept {
+		return const_cast<void*>(static_cast<const volatile void*>(__MY_NAMESPACE::addressof(*it)));
+	}
+
+	template <typename It, typename SizeT>
+	It __advance_n(It it, SizeT n) {
+		for (; n > 0; --n) {
+			++it;
+		}
+		return it;
+	}
+
+	template <typename T, typename SizeT>
+	T* __advance_n(T* ptr, SizeT n) {
+		return ptr + n;
+	}
+
+	// 以 Src 类型的对象按字节复制来构造 Dst 类型的对象是否与调用构造函数等价
+	template <typename Src, typename Dst, template <typename> class IsTrivialConstruct>
+	struct __is_bitwise_constructible: integral_constant<
+		bool,
+		is_same<typename remove_cv<Src>::type, Dst>::value &&
+		!is_volatile<Src>::value &&
+		IsTrivialConstruct<Dst>::value
+	> {};
+
+	template <typename ForwardIt>
+	__CONSTEXPR20 void __destroy(ForwardIt, ForwardIt, true_type) noexcept {}
+
+	template <typename ForwardIt>
+	__CONSTEXPR20 void __destroy(ForwardIt first, ForwardIt last, false_type) {
+		for (; first != last; ++first) {
+			__MY_NAMESPACE::destroy_at(__MY_NAMESPACE::addressof(*first));
+		}
+	}
+
+	template <typename ForwardIt, typename SizeT>
+	__CONSTEXPR20 ForwardIt __destroy_n(ForwardIt first, SizeT n, true_type) noexcept {
+		return __advance_n(first, n);
+	}
+
+	template <typename ForwardIt, typename SizeT>
+	__CONSTEXPR20 ForwardIt __destroy_n(ForwardIt first, SizeT n, false_type) {
+		for (; n > 0; ++first, --n) {
+			__MY_NAMESPACE::destroy_at(__MY_NAMESPACE::addressof(*first));
+		}
+		return first;
+	}
+
+	// 逐个构造，若构造抛出异常则析构已构造的对象后重新抛出
+	template <typename InputIt, typename ForwardIt>
+	ForwardIt __uninitialized_copy(InputIt first, InputIt last, ForwardIt d_first) {
+		using value_type = __iter_value_t<ForwardIt>;
+		ForwardIt current = d_first;
+		try {
+			for (; first != last; ++first, ++current) {
+				::new (__voidify(current)) value_type(*first);
+			}
+			return current;
+		}
+		catch (...) {
+			__MY_NAMESPACE::destroy(d_first, current);
+			throw;
+		}
+	}
+
+	template <typename T, typename U>
+	U* __uninitialized_copy_ptr(T* first, T* last, U* d_first, true_type) noexcept {
+		::size_t count = static_cast<::size_t>(last - first);
+		if (count != 0) {
+			::std::memcpy(d_first, first, count * sizeof(U));
+		}
+		return d_first + count;
+	}
+
+	template <typename T, typename U>
+	U* __uninitialized_copy_ptr(T* first, T* last, U* d_first, false_type) {
+		U* current = d_first;
+		try {
+			for (; first != last; ++first, ++current) {
+				::new (static_cast<void*>(current)) U(*first);
+			}
+			return current;
+		}
+		catch (...) {
+			__MY_NAMESPACE::destroy(d_first, current);
+			throw;
+		}
+	}
+
+	template <typename T, typename U>
+	U* __uninitialized_copy(T* first, T* last, U* d_first) {
+		return __uninitialized_copy_ptr(first, last, d_first,
+			__is_bitwise_constructible<T, U, is_trivially_copy_constructible>());
+	}
+
+	template <typename InputIt, typename ForwardIt>
+	ForwardIt __uninitialized_move(InputIt first, InputIt last, ForwardIt d_first) {
+		using value_type = __iter_value_t<ForwardIt>;
+		ForwardIt current = d_first;
+		try {
+			for (; first != last; ++first, ++current) {
+				::new (__voidify(current)) value_type(__MY_NAMESPACE::move(*first));
+			}
+			return current;
+		}
+		catch (...) {
+			__MY_NAMESPACE::destroy(d_first, current);
+			throw;
+		}
+	}
+
+	template <typename T, typename U>
+	U* __uninitialized_move_ptr(T* first, T* last, U* d_first, true_type) noexcept {
+		::size_t count = static_cast<::size_t>(last - first);
+		if (count != 0) {
+			::std::memmove(d_first, first, count * sizeof(U));
+		}
+		return d_first + count;
+	}
+
+	template <typename T, typename U>
+	U* __uninitialized_move_ptr(T* first, T* last, U* d_first, false_type) {
+		U* current = d_first;
+		try {
+			for (; first != last; ++first, ++current) {
+				::new (static_cast<void*>(current)) U(__MY_NAMESPACE::move(*first));
+			}
+			return current;
+		}
+		catch (...) {
+			__MY_NAMESPACE::destroy(d_first, current);
+			throw;
+		}
+	}
+
+	template <typename T, typename U>
+	U* __uninitialized_move(T* first, T* last, U* d_first) {
+		return __uninitialized_move_ptr(first, last, d_first,
+			__is_bitwise_constructible<T, U, is_trivially_move_constructible>());
+	}
+
+	template <typename ForwardIt, typename SizeT, typename T>
+	ForwardIt __uninitialized_fill_n(ForwardIt first, SizeT n, const T& value) {
+		using value_type = __iter_value_t<ForwardIt>;
+		ForwardIt current = first;
+		try {
+			for (; n > 0; ++current, --n) {
+				::new (__voidify(current)) value_type(value);
+			}
+			return current;
+		}
+		catch (...) {
+			__MY_NAMESPACE::destroy(first, current);
+			throw;
+		}
+	}
+
+	// 单字节的平凡类型：直接 memset
+	template <typename U, typename SizeT, typename T>
+	U* __uninitialized_fill_n_ptr(U* first, SizeT n, const T& value, true_type) noexcept {
+		if (n > 0) {
+			U tmp(value);
+			unsigned char byte;
+			::std::memcpy(&byte, &tmp, 1);
+			::std::memset(first, byte, static_cast<::size_t>(n));
+			return first + n;
+		}
+		return first;
+	}
+
+	template <typename U, typename SizeT, typename T>
+	U* __uninitialized_fill_n_ptr_loop(U* first, SizeT n, const T& value, true_type) noexcept {
+		for (; n > 0; ++first, --n) {
+			::new (static_cast<void*>(first)) U(value);
+		}
+		return first;
+	}
+
+	template <typename U, typename SizeT, typename T>
+	U* __uninitialized_fill_n_ptr_loop(U* first, SizeT n, const T& value, false_type) {
+		U* current = first;
+		try {
+			for (; n > 0; ++current, --n) {
+				::new (static_cast<void*>(current)) U(value);
+			}
+			return current;
+		}
+		catch (...) {
+			__MY_NAMESPACE::destroy(first, current);
+			throw;
+		}
+	}
+
+	template <typename U, typename SizeT, typename T>
+	U* __uninitialized_fill_n_ptr(U* first, SizeT n, const T& value, false_type) {
+		// 平凡复制构造且不抛出异常的类型无需回滚，循环可由编译器向量化
+		return __uninitialized_fill_n_ptr_loop(first, n, value, integral_constant<
+			bool,
+			is_same<typename remove_cv<T>::type, U>::value && is_trivially_copy_constructible<U>::value
+		>());
+	}
+
+	template <typename U, typename SizeT, typename T>
+	U* __uninitialized_fill_n(U* first, SizeT n, const T& value) {
+		return __uninitialized_fill_n_ptr(first, n, value, integral_constant<
+			bool,
+			sizeof(U) == 1 &&
+			is_same<typename remove_cv<T>::type, U>::value &&
+			is_trivially_copy_constructible<U>::value
+		>());
+	}
+
+	template <typename ForwardIt, typename SizeT>
+	ForwardIt __uninitialized_default_construct_n(ForwardIt first, SizeT n, true_type) noexcept {
+		return __advance_n(first, n);
+	}
+
+	template <typename ForwardIt, typename SizeT>
+	ForwardIt __uninitialized_default_construct_n(ForwardIt first, SizeT n, false_type) {
+		using value_type = __iter_value_t<ForwardIt>;
+		ForwardIt current = first;
+		try {
+			for (; n > 0; ++current, --n) {
+				::new (__voidify(current)) value_type;
+			}
+			return current;
+		}
+		catch (...) {
+			__MY_NAMESPACE::destroy(first, current);
+			throw;
+		}
+	}
+
+	template <typename ForwardIt, typename SizeT>
+	ForwardIt __uninitialized_value_construct_n(ForwardIt first, SizeT n) {
+		using value_type = __iter_value_t<ForwardIt>;
+		ForwardIt current = first;
+		try {
+			for (; n > 0; ++current, --n) {
+				::new (__voidify(current)) value_type();
+			}
+			return current;
+		}
+		catch (...) {
+			__MY_NAMESPACE::destroy(first, current);
+			throw;
+		}
+	}
+
+	// 算术类型与对象指针的值初始化即全零字节：直接 memset
+	template <typename U, typename SizeT>
+	U* __uninitialized_value_construct_n_ptr(U* first, SizeT n, true_type) noexcept {
+		if (n > 0) {
+			::std::memset(static_cast<void*>(first), 0, static_cast<::size_t>(n) * sizeof(U));
+			return first + n;
+		}
+		return first;
+	}
+
+	template <typename U, typename SizeT>
+	U* __uninitialized_value_construct_n_ptr(U* first, SizeT n, false_type) {
+		U* current = first;
+		try {
+			for (; n > 0; ++current, --n) {
+				::new (static_cast<void*>(current)) U();
+			}
+			return current;
+		}
+		catch (...) {
+			__MY_NAMESPACE::destroy(first, current);
+			throw;
+		}
+	}
+
+	template <typename U, typename SizeT>
+	U* __uninitialized_value_construct_n(U* first, SizeT n) {
+		return __uninitialized_value_construct_n_ptr(first, n, integral_constant<
+			bool,
+			is_scalar<U>::value && !is_member_pointer<U>::value && !is_volatile<U>::value
+		>());
+	}
+	__INNER_END
+
+	/**
+	 * @brief destroys a range of objects
+	 * @brief 析构 [first, last) 中的对象，平凡析构的类型不做任何事
+	*/
+	template <typename ForwardIt>
+	__CONSTEXPR20 void destroy(ForwardIt first, ForwardIt last) {
+		__INNER_NAMESPACE::__destroy(first, last,
+			is_trivially_destructible<__INNER_NAMESPACE::__iter_value_t<ForwardIt>>());
+	}
+
+	/**
+	 * @brief destroys a number of objects in a range
+	 * @brief 析构从 first 开始的 n 个对象，平凡析构的类型不做任何事
+	 * @return 被析构范围的尾后迭代器
+	*/
+	template <typename ForwardIt, typename SizeT>
+	__CONSTEXPR20 ForwardIt destroy_n(ForwardIt first, SizeT n) {
+		return __INNER_NAMESPACE::__destroy_n(first, n,
+			is_trivially_destructible<__INNER_NAMESPACE::__iter_value_t<ForwardIt>>());
+	}
+
+	/**
+	 * @brief copies a range of objects to an uninitialized area of memory
+	 * @brief 将 [first, last) 复制到以 d_first 开始的未初始化内存
+	 * @brief 二者均为同类型的指针且该类型可平凡复制构造时使用 memcpy；否则逐个构造，异常时析构已构造的对象
+	 * @return 最后一个被复制元素的后一位置
+	*/
+	template <typename InputIt, typename ForwardIt>
+	ForwardIt uninitialized_copy(InputIt first, InputIt last, ForwardIt d_first) {
+		return __INNER_NAMESPACE::__uninitialized_copy(first, last, d_first);
+	}
+
+	/**
+	 * @brief copies a number of objects to an uninitialized area of memory
+	 * @brief 将从 first 开始的 count 个元素复制到以 d_first 开始的未初始化内存
+	 * @return 最后一个被复制元素的后一位置
+	*/
+	template <typename InputIt, typename SizeT, typename ForwardIt>
+	ForwardIt uninitialized_copy_n(InputIt first, SizeT count, ForwardIt d_first) {
+		using value_type = __INNER_NAMESPACE::__iter_value_t<ForwardIt>;
+		ForwardIt current = d_first;
+		try {
+			for (; count > 0; ++first, ++current, --count) {
+				::new (__INNER_NAMESPACE::__voidify(current)) value_type(*first);
+			}
+			return current;
+		}
+		catch (...) {
+			__MY_NAMESPACE::destroy(d_first, current);
+			throw;
+		}
+	}
+
+	/**
+	 * @brief copies a number of objects to an uninitialized area of memory, pointer version
+	 * @brief 将从 first 开始的 count 个元素复制到以 d_first 开始的未初始化内存，可平凡复制构造时使用 memcpy
+	*/
+	template <typename T, typename SizeT, typename U>
+	U* uninitialized_copy_n(T* first, SizeT count, U* d_first) {
+		return __INNER_NAMESPACE::__uninitialized_copy(first, first + count, d_first);
+	}
+
+	/**
+	 * @brief moves a range of objects to an uninitialized area of memory
+	 * @brief 将 [first, last) 移动到以 d_first 开始的未初始化内存
+	 * @brief 二者均为同类型的指针且该类型可平凡移动构造时使用 memmove；否则逐个构造，异常时析构已构造的对象
+	 * @return 最后一个被移动元素的后一位置
+	*/
+	template <typename InputIt, typename ForwardIt>
+	ForwardIt uninitialized_move(InputIt first, InputIt last, ForwardIt d_first) {
+		return __INNER_NAMESPACE::__uninitialized_move(first, last, d_first);
+	}
+
+	/**
+	 * @brief copies an object to an uninitialized area of memory, defined by a range
+	 * @brief 以 value 的副本构造 [first, last) 中的对象
+	 * @brief 单字节平凡类型使用 memset，其他平凡类型的循环不做异常回滚
+	*/
+	template <typename ForwardIt, typename T>
+	void uninitialized_fill(ForwardIt first, ForwardIt last, const T& value) {
+		using value_type = __INNER_NAMESPACE::__iter_value_t<ForwardIt>;
+		ForwardIt current = first;
+		try {
+			for (; current != last; ++current) {
+				::new (__INNER_NAMESPACE::__voidify(current)) value_type(value);
+			}
+		}
+		catch (...) {
+			__MY_NAMESPACE::destroy(first, current);
+			throw;
+		}
+	}
+
+	/**
+	 * @brief copies an object to an uninitialized area of memory, defined by a range, pointer version
+	 * @brief 以 value 的副本构造 [first, last) 中的对象
+	*/
+	template <typename U, typename T>
+	void uninitialized_fill(U* first, U* last, const T& value) {
+		__INNER_NAMESPACE::__uninitialized_fill_n(first, last - first, value);
+	}
+
+	/**
+	 * @brief copies an object to an uninitialized area of memory, defined by a start and a count
+	 * @brief 以 value 的副本构造从 first 开始的 n 个对象
+	 * @return 最后一个被构造元素的后一位置
+	*/
+	template <typename ForwardIt, typename SizeT, typename T>
+	ForwardIt uninitialized_fill_n(ForwardIt first, SizeT n, const T& value) {
+		return __INNER_NAMESPACE::__uninitialized_fill_n(first, n, value);
+	}
+
+	/**
+	 * @brief constructs objects by default-initialization in an uninitialized area of memory, defined by a range
+	 * @brief 以默认初始化构造 [first, last) 中的对象，可平凡默认构造的类型不做任何事
+	*/
+	template <typename ForwardIt>
+	void uninitialized_default_construct(ForwardIt first, ForwardIt last) {
+		using value_type = __INNER_NAMESPACE::__iter_value_t<ForwardIt>;
+		if (is_trivially_default_constructible<value_type>::value) {
+			return;
+		}
+		ForwardIt current = first;
+		try {
+			for (; current != last; ++current) {
+				::new (__INNER_NAMESPACE::__voidify(current)) value_type;
+			}
+		}
+		catch (...) {
+			__MY_NAMESPACE::destroy(first, current);
+			throw;
+		}
+	}
+
+	/**
+	 * @brief constructs objects by default-initialization in an uninitialized area of memory, defined by a start and count
+	 * @brief 以默认初始化构造从 first 开始的 n 个对象，可平凡默认构造的类型不做任何事
+	 * @return 最后一个被构造元素的后一位置
+	*/
+	template <typename ForwardIt, typename SizeT>
+	ForwardIt uninitialized_default_construct_n(ForwardIt first, SizeT n) {
+		return __INNER_NAMESPACE::__uninitialized_default_construct_n(first, n,
+			is_trivially_default_constructible<__INNER_NAMESPACE::__iter_value_t<ForwardIt>>());
+	}
+
+	/**
+	 * @brief constructs objects by value-initialization in an uninitialized area of memory, defined by a range
+	 * @brief 以值初始化构造 [first, last) 中的对象，算术类型与指针使用 memset
+	*/
+	template <typename ForwardIt>
+	void uninitialized_value_construct(ForwardIt first, ForwardIt last) {
+		using value_type = __INNER_NAMESPACE::__iter_value_t<ForwardIt>;
+		ForwardIt current = first;
+		try {
+			for (; current != last; ++current) {
+				::new (__INNER_NAMESPACE::__voidify(current)) value_type();
+			}
+		}
+		catch (...) {
+			__MY_NAMESPACE::destroy(first, current);
+			throw;
+		}
+	}
+
+	/**
+	 * @brief constructs objects by value-initialization in an uninitialized area of memory, pointer version
+	 * @brief 以值初始化构造 [first, last) 中的对象，算术类型与指针使用 memset
+	*/
+	template <typename U>
+	void uninitialized_value_construct(U* first, U* last) {
+		__INNER_NAMESPACE::__uninitialized_value_construct_n(first, last - first);
+	}
+
+	/**
+	 * @brief constructs objects by value-initialization in an uninitialized area of memory, defined by a start and a count
+	 * @brief 以值初始化构造从 first 开始的 n 个对象，算术类型与指针使用 memset
+	 * @return 最后一个被构造元素的后一位置
+	*/
+	template <typename ForwardIt, typename SizeT>
+	ForwardIt uninitialized_value_construct_n(ForwardIt first, SizeT n) {
+		return __INNER_NAMESPACE::__uninitialized_value_construct_n(first, n);
+	}
+
+	__INNER_BEGIN
+	template <typename T>
+	T* __relocate_at(T* source, T* dest, true_type) noexcept {
+		::std::memcpy(static_cast<void*>(dest), static_cast<const void*>(source), sizeof(T));
+		return dest;
+	}
+
+	template <typename T>
+	T* __relocate_at(T* source, T* dest, false_type) noexcept(is_nothrow_move_constructible<T>::value) {
+		::new (static_cast<void*>(dest)) T(__MY_NAMESPACE::move(*source));
+		__MY_NAMESPACE::destroy_at(source);
+		return dest;
+	}
+
+	template <typename T>
+	T* __relocate(T* first, T* last, T* d_first, true_type) noexcept {
+		::size_t count = static_cast<::size_t>(last - first);
+		if (count != 0) {
+			::std::memmove(static_cast<void*>(d_first), static_cast<const void*>(first), count * sizeof(T));
+		}
+		return d_first + count;
+	}
+
+	// 逐个移动构造并析构原对象；异常时已搬到目标处的对象与尚未搬走的原对象互不重叠，一并析构
+	template <typename T>
+	T* __relocate_forward(T* first, T* last, T* d_first) {
+		T* current = d_first;
+		try {
+			for (; first != last; ++first, ++current) {
+				::new (static_cast<void*>(current)) T(__MY_NAMESPACE::move(*first));
+				__MY_NAMESPACE::destroy_at(first);
+			}
+			return current;
+		}
+		catch (...) {
+			__MY_NAMESPACE::destroy(d_first, current);
+			__MY_NAMESPACE::destroy(first, last);
+			throw;
+		}
+	}
+
+	template <typename T>
+	T* __relocate_backward(T* first, T* last, T* d_last) {
+		T* current = d_last;
+		try {
+			while (last != first) {
+				::new (static_cast<void*>(current - 1)) T(__MY_NAMESPACE::move(*(last - 1)));
+				--current;
+				--last;
+				__MY_NAMESPACE::destroy_at(last);
+			}
+			return current;
+		}
+		catch (...) {
+			__MY_NAMESPACE::destroy(current, d_last);
+			__MY_NAMESPACE::destroy(first, last);
+			throw;
+		}
+	}
+
+	template <typename T>
+	T* __relocate(T* first, T* last, T* d_first, false_type) {
+		T* d_last = d_first + (last - first);
+		if (d_first == first) {
+			return d_last;
+		}
+		// 目标起点落在源范围内部时须从后往前搬
+		if (first < d_first && d_first < last) {
+			__relocate_backward(first, last, d_last);
+		}
+		else {
+			__relocate_forward(first, last, d_first);
+		}
+		return d_last;
+	}
+
+	template <typename T>
+	T* __uninitialized_relocate(T* first, T* last, T* d_first, true_type) noexcept {
+		::size_t count = static_cast<::size_t>(last - first);
+		if (count != 0) {
+			::std::memcpy(static_cast<void*>(d_first), static_cast<const void*>(first), count * sizeof(T));
+		}
+		return d_first + count;
+	}
+
+	template <typename T>
+	T* __uninitialized_relocate(T* first, T* last, T* d_first, false_type) {
+		return __relocate_forward(first, last, d_first);
+	}
+	__INNER_END
+
+	/**
+	 * @brief (non-standard feature) relocates an object to an uninitialized area of memory
+	 * @brief （非标准内容）将 *source 重定位到 dest 处的未初始化内存，此后 source 处不再有对象
+	 * @brief 可平凡重定位的类型直接复制字节；否则移动构造后析构原对象，移动构造抛出异常时原对象保持不变
+	 * @return dest
+	*/
+	template <typename T>
+	T* relocate_at(T* source, T* dest) noexcept(is_trivially_relocatable<T>::value || is_nothrow_move_constructible<T>::value) {
+		return __INNER_NAMESPACE::__relocate_at(source, dest, is_trivially_relocatable<T>());
+	}
+
+	/**
+	 * @brief (non-standard feature) relocates a range of objects, the ranges may overlap
+	 * @brief （非标准内容）将 [first, last) 重定位到以 d_first 开始的位置，两范围可以重叠，目标中不与源重叠的部分须为未初始化内存
+	 * @brief 可平凡重定位的类型使用 memmove；否则按重叠方向逐个移动构造并析构原对象，
+	 * 异常时已重定位的对象与尚未重定位的原对象均被析构
+	 * @return 最后一个被重定位元素的后一位置
+	*/
+	template <typename T>
+	T* relocate(T* first, T* last, T* d_first) noexcept(is_trivially_relocatable<T>::value) {
+		return __INNER_NAMESPACE::__relocate(first, last, d_first, is_trivially_relocatable<T>());
+	}
+
+	/**
+	 * @brief (non-standard feature) relocates a range of objects to an uninitialized area of memory
+	 * @brief （非标准内容）将 [first, last) 重定位到以 d_first 开始的未初始化内存，两范围不得重叠
+	 * @brief 可平凡重定位的类型使用 memcpy；否则逐个移动构造并析构原对象，异常时两范围中的对象均被析构
+	 * @return 最后一个被重定位元素的后一位置
+	*/
+	template <typename T>
+	T* uninitialized_relocate(T* first, T* last, T* d_first) noexcept(is_trivially_relocatable<T>::value) {
+		return __INNER_NAMESPACE::__uninitialized_relocate(first, last, d_first, is_trivially_relocatable<T>());
+	}
+
+	/**
+	 * @brief (non-standard feature) relocates a number of objects to an uninitialized area of memory
+	 * @brief （非标准内容）将从 first 开始的 count 个元素重定位到以 d_first 开始的未初始化内存，两范围不得重叠
+	 * @return 最后一个被重定位元素的后一位置
+	*/
+	template <typename T, typename SizeT>
+	T* uninitialized_relocate_n(T* first, SizeT count, T* d_first) noexcept(is_trivially_relocatable<T>::value) {
+		return __INNER_NAMESPACE::__uninitialized_relocate(first, first + count, d_first, is_trivially_relocatable<T>());
+	}
+
+	#pragma endregion uninitialized memory algorithms
+
+	#pragma region allocator_traits
+
+	__INNER_BEGIN
+	// 以下帮助类检测分配器是否提供某个成员类型，若未提供则给出默认类型
+	template <typename Alloc, typename = void>
+	struct __alloc_pointer { using type = typename Alloc::value_type*; };
+	template <typename Alloc>
+	struct __alloc_pointer<Alloc, __void_t<typename Alloc::pointer>> { using type = typename Alloc::pointer; };
+
+	template <typename Alloc, typename = void>
+	struct __alloc_const_pointer { using type = const typename Alloc::value_type*; };
+	template <typename Alloc>
+	struct __alloc_const_pointer<Alloc, __void_t<typename Alloc::const_pointer>> { using type = typename Alloc::const_pointer; };
+
+	template <typename Alloc, typename = void>
+	struct __alloc_void_pointer { using type = void*; };
+	template <typename Alloc>
+	struct __alloc_void_pointer<Alloc, __void_t<typename Alloc::void_pointer>> { using type = typename Alloc::void_pointer; };
+
+	template <typename Alloc, typename = void>
+	struct __alloc_const_void_pointer { using type = const void*; };
+	template <typename Alloc>
+	struct __alloc_const_void_pointer<Alloc, __void_t<typename Alloc::const_void_pointer>> { using type = typename Alloc::const_void_pointer; };
+
+	template <typename Alloc, typename = void>
+	struct __alloc_difference_type { using type = ::ptrdiff_t; };
+	template <typename Alloc>
+	struct __alloc_difference_type<Alloc, __void_t<typename Alloc::difference_type>> { using type = typename Alloc::difference_type; };
+
+	template <typename Alloc, typename = void>
+	struct __alloc_size_type { using type = ::size_t; };
+	template <typename Alloc>
+	struct __alloc_size_type<Alloc, __void_t<typename Alloc::size_type>> { using type = typename Alloc::size_type; };
+
+	template <typename Alloc, typename = void>
+	struct __alloc_pocca { using type = false_type; };
+	template <typename Alloc>
+	struct __alloc_pocca<Alloc, __void_t<typename Alloc::propagate_on_container_copy_assignment>> {
+		using type = typename Alloc::propagate_on_container_copy_assignment;
+	};
+
+	template <typename Alloc, typename = void>
+	struct __alloc_pocma { using type = false_type; };
+	template <typename Alloc>
+	struct __alloc_pocma<Alloc, __void_t<typename Alloc::propagate_on_container_move_assignment>> {
+		using type = typename Alloc::propagate_on_container_move_assignment;
+	};
+
+	template <typename Alloc, typename = void>
+	struct __alloc_pocs { using type = false_type; };
+	template <typename Alloc>
+	struct __alloc_pocs<Alloc, __void_t<typename Alloc::propagate_on_container_swap>> {
+		using type = typename Alloc::propagate_on_container_swap;
+	};
+
+	// 未声明 is_always_equal 时，空的分配器类型被视为总是相等
+	template <typename Alloc, typename = void>
+	struct __alloc_is_always_equal { using type = typename is_empty<Alloc>::type; };
+	template <typename Alloc>
+	struct __alloc_is_always_equal<Alloc, __void_t<typename Alloc::is_always_equal>> {
+		using type = typename Alloc::is_always_equal;
+	};
+
+	// 未提供 rebind 时，将 Alloc<T, Args...> 替换为 Alloc<U, Args...>
+	template <typename Alloc, typename U>
+	struct __alloc_rebind_template {};
+	template <template <typename, typename...> class AllocTemplate, typename T, typename... Args, typename U>
+	struct __alloc_rebind_template<AllocTemplate<T, Args...>, U> { using type = AllocTemplate<U, Args...>; };
+
+	template <typename Alloc, typename U, typename = void>
+	struct __alloc_rebind: __alloc_rebind_template<Alloc, U> {};
+	template <typename Alloc, typename U>
+	struct __alloc_rebind<Alloc, U, __void_t<typename Alloc::template rebind<U>::other>> {
+		using type = typename Alloc::template rebind<U>::other;
+	};
+
+	// 以下函数检测分配器是否提供某个可选的成员函数
+	template <typename Alloc, typename SizeT, typename ConstVoidPtr,
+		typename = decltype(declval<Alloc&>().allocate(declval<SizeT>(), declval<ConstVoidPtr>()))>
+	auto __test_alloc_allocate_hint(int) -> true_type;
+	template <typename...>
+	auto __test_alloc_allocate_hint(...) -> false_type;
+
+	template <typename Alloc, typename T, typename... Args>
+	auto __test_alloc_construct(int) -> decltype(declval<Alloc&>().construct(declval<T*>(), declval<Args>()...), true_type());
+	template <typename...>
+	auto __test_alloc_construct(...) -> false_type;
+
+	template <typename Alloc, typename T, typename = decltype(declval<Alloc&>().destroy(declval<T*>()))>
+	auto __test_alloc_destroy(int) -> true_type;
+	template <typename...>
+	auto __test_alloc_destroy(...) -> false_type;
+
+	template <typename Alloc, typename = decltype(declval<const Alloc&>().max_size())>
+	auto __test_alloc_max_size(int) -> true_type;
+	template <typename...>
+	auto __test_alloc_max_size(...) -> false_type;
+
+	template <typename Alloc, typename = decltype(declval<const Alloc&>().select_on_container_copy_construction())>
+	auto __test_alloc_select_on_copy(int) -> true_type;
+	template <typename...>
+	auto __test_alloc_select_on_copy(...) -> false_type;
+
+	template <typename Alloc, typename Pointer, typename SizeT,
+		typename = decltype(static_cast<bool>(declval<Alloc&>().expand(declval<Pointer>(), declval<SizeT>(), declval<SizeT>())))>
+	auto __test_alloc_expand(int) -> true_type;
+	template <typename...>
+	auto __test_alloc_expand(...) -> false_type;
+	__INNER_END
+
+	/**
+	 * @brief provides information about allocator types
+	 * @brief 提供访问分配器各种属性的统一方法
+	 * @tparam Alloc 分配器类型
+	 *
+	 * @note
+	 * 分配器未提供的成员类型与成员函数由 allocator_traits 给出默认值或默认实现，判断均在编译期完成
+	 * 容器应通过 is_always_equal 与 propagate_on_container_move_assignment 在编译期选择移动赋值与交换的实现，
+	 * 当二者之一为 true_type 时可以直接接管对方的存储，无需在运行时比较分配器
+	 * 未提供 pointer 等成员类型时使用原生指针
+	*/
+	template <typename Alloc>
+	struct allocator_traits {
+		using allocator_type = Alloc;
+		using value_type = typename Alloc::value_type;
+		using pointer = typename __INNER_NAMESPACE::__alloc_pointer<Alloc>::type;
+		using const_pointer = typename __INNER_NAMESPACE::__alloc_const_pointer<Alloc>::type;
+		using void_pointer = typename __INNER_NAMESPACE::__alloc_void_pointer<Alloc>::type;
+		using const_void_pointer = typename __INNER_NAMESPACE::__alloc_const_void_pointer<Alloc>::type;
+		using difference_type = typename __INNER_NAMESPACE::__alloc_difference_type<Alloc>::type;
+		using size_type = typename __INNER_NAMESPACE::__alloc_size_type<Alloc>::type;
+
+		/** @brief 容器复制赋值时是否复制分配器 */
+		using propagate_on_container_copy_assignment = typename __INNER_NAMESPACE::__alloc_pocca<Alloc>::type;
+		/** @brief 容器移动赋值时是否移动分配器 */
+		using propagate_on_container_move_assignment = typename __INNER_NAMESPACE::__alloc_pocma<Alloc>::type;
+		/** @brief 容器交换时是否交换分配器 */
+		using propagate_on_container_swap = typename __INNER_NAMESPACE::__alloc_pocs<Alloc>::type;
+		/** @brief 该类型的任意两个分配器是否总是相等 */
+		using is_always_equal = typename __INNER_NAMESPACE::__alloc_is_always_equal<Alloc>::type;
+
+		/** @brief 分配 U 类型对象的对应分配器类型 */
+		template <typename U>
+		using rebind_alloc = typename __INNER_NAMESPACE::__alloc_rebind<Alloc, U>::type;
+
+		/** @brief 分配 U 类型对象的对应分配器的 allocator_traits */
+		template <typename U>
+		using rebind_traits = allocator_traits<rebind_alloc<U>>;
+
+	private:
+		static pointer __allocate(true_type, Alloc& a, size_type n, const_void_pointer hint) {
+			return a.allocate(n, hint);
+		}
+		static pointer __allocate(false_type, Alloc& a, size_type n, const_void_pointer) {
+			return a.allocate(n);
+		}
+
+		template <typename T, typename... Args>
+		static void __construct(true_type, Alloc& a, T* ptr, Args&&... args) {
+			a.construct(ptr, __MY_NAMESPACE::forward<Args>(args)...);
+		}
+		template <typename T, typename... Args>
+		static void __construct(false_type, Alloc&, T* ptr, Args&&... args) {
+			::new (static_cast<void*>(ptr)) T(__MY_NAMESPACE::forward<Args>(args)...);
+		}
+
+		template <typename T>
+		static void __destroy(true_type, Alloc& a, T* ptr) {
+			a.destroy(ptr);
+		}
+		template <typename T>
+		static void __destroy(false_type, Alloc&, T* ptr) {
+			ptr->~T();
+		}
+
+		static size_type __max_size(true_type, const Alloc& a) noexcept {
+			return a.max_size();
+		}
+		static size_type __max_size(false_type, const Alloc&) noexcept {
+			return static_cast<size_type>(-1) / sizeof(value_type);
+		}
+
+		static Alloc __select_on_copy(true_type, const Alloc& a) {
+			return a.select_on_container_copy_construction();
+		}
+		static Alloc __select_on_copy(false_type, const Alloc& a) {
+			return a;
+		}
+
+		static bool __expand(true_type, Alloc& a, pointer ptr, size_type n, size_type new_n) noexcept {
+			return static_cast<bool>(a.expand(ptr, n, new_n));
+		}
+		static bool __expand(false_type, Alloc&, pointer, size_type, size_type) noexcept {
+			return false;
+		}
+
+	public:
+		/**
+		 * @brief allocates uninitialized storage using the allocator
+		 * @brief 使用分配器分配 n 个对象的未初始化存储
+		*/
+		__NODISCARD static pointer allocate(Alloc& a, size_type n) {
+			return a.allocate(n);
+		}
+
+		/**
+		 * @brief allocates uninitialized storage using the allocator, passing the locality hint if supported
+		 * @brief 使用分配器分配 n 个对象的未初始化存储，若分配器支持则传递位置提示 hint
+		*/
+		__NODISCARD static pointer allocate(Alloc& a, size_type n, const_void_pointer hint) {
+			return __allocate(decltype(__INNER_NAMESPACE::__test_alloc_allocate_hint<Alloc, size_type, const_void_pointer>(0))(), a, n, hint);
+		}
+
+		/**
+		 * @brief deallocates storage using the allocator
+		 * @brief 使用分配器释放存储
+		*/
+		static void deallocate(Alloc& a, pointer ptr, size_type n) {
+			a.deallocate(ptr, n);
+		}
+
+		/**
+		 * @brief constructs an object in the allocated storage
+		 * @brief 在已分配的存储中构造对象，分配器提供 construct 时调用之，否则使用布置 new
+		*/
+		template <typename T, typename... Args>
+		static void construct(Alloc& a, T* ptr, Args&&... args) {
+			__construct(decltype(__INNER_NAMESPACE::__test_alloc_construct<Alloc, T, Args...>(0))(), a, ptr, __MY_NAMESPACE::forward<Args>(args)...);
+		}
+
+		/**
+		 * @brief destructs an object stored in the allocated storage
+		 * @brief 析构已分配存储中的对象，分配器提供 destroy 时调用之，否则直接调用析构函数
+		*/
+		template <typename T>
+		static void destroy(Alloc& a, T* ptr) {
+			__destroy(decltype(__INNER_NAMESPACE::__test_alloc_destroy<Alloc, T>(0))(), a, ptr);
+		}
+
+		/**
+		 * @brief returns the maximum object size supported by the allocator
+		 * @brief 返回分配器支持的最大对象个数
+		*/
+		static size_type max_size(const Alloc& a) noexcept {
+			return __max_size(decltype(__INNER_NAMESPACE::__test_alloc_max_size<Alloc>(0))(), a);
+		}
+
+		/**
+		 * @brief obtains the allocator to use after copying a standard container
+		 * @brief 获取容器被复制后副本所用的分配器
+		*/
+		static Alloc select_on_container_copy_construction(const Alloc& a) {
+			return __select_on_copy(decltype(__INNER_NAMESPACE::__test_alloc_select_on_copy<Alloc>(0))(), a);
+		}
+
+		/**
+		 * @brief (non-standard feature) tries to extend the storage obtained from allocate(a, n) in place to hold new_n objects
+		 * @brief （非标准内容）尝试原地扩展由 allocate(a, n) 得到的存储，使之能容纳 new_n 个对象
+		 * @return 分配器提供 expand 且扩展成功时返回 true，此后须以 new_n 释放该存储；否则返回 false，存储不变
+		*/
+		static bool expand(Alloc& a, pointer ptr, size_type n, size_type new_n) noexcept {
+			return __expand(decltype(__INNER_NAMESPACE::__test_alloc_expand<Alloc, pointer, size_type>(0))(), a, ptr, n, new_n);
+		}
+	};
+
+	#pragma endregion allocator_traits
+
+	#pragma region allocator
+
+	__INNER_BEGIN
+	#if __HAS_CPP17 && defined(__STDCPP_DEFAULT_NEW_ALIGNMENT__)
+	// operator new(size_t) 所保证的对齐
+	constexpr ::size_t __default_new_alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+	#else // ^^^ __HAS_CPP17 / vvv !__HAS_CPP17
+	constexpr ::size_t __default_new_alignment = alignof(::max_align_t);
+	#endif // __HAS_CPP17
+
+	// 小块内存池的参数：以 __pool_align 为粒度划分尺寸类，不超过 __pool_max_bytes 的请求由内存池提供
+	constexpr ::size_t __pool_align = __default_new_alignment;
+	constexpr ::size_t __pool_max_bytes = 256;
+	constexpr ::size_t __pool_class_count = __pool_max_bytes / __pool_align;
+	constexpr ::size_t __pool_chunk_bytes = 4096;
+
+	// 空闲块本身存放链表指针，因此不需要额外的块头
+	union __pool_block {
+		__pool_block* next;
+	};
+
+	/**
+	 * @brief (non-standard feature) an object that is constructed in place and never destroyed
+	 * @brief （非标准内容）原地构造且永不析构的对象，用作函数内的静态变量
+	 *
+	 * @note
+	 * 析构函数平凡，因此不登记静态析构：比它先构造的静态容器在析构时仍可能归还内存，所用的链表与互斥量必须一直有效
+	*/
+	template <typename T>
+	class __immortal {
+	private:
+		alignas(T) unsigned char __storage[sizeof(T)];
+
+	public:
+		__immortal() noexcept {
+			::new (static_cast<void*>(__storage)) T();
+		}
+
+		__immortal(const __immortal&) = delete;
+		__immortal& operator=(const __immortal&) = delete;
+
+		T& get() noexcept { return *reinterpret_cast<T*>(__storage); }
+	};
+
+	/**
+	 * @brief (non-standard feature) size-class segregated free lists for small blocks
+	 * @brief （非标准内容）按尺寸类分离的小块内存空闲链表
+	 *
+	 * @note
+	 * 每个尺寸类拥有独立的空闲链表与互斥量，不同尺寸的分配互不竞争
+	 * 释放时由调用方提供尺寸，从而直接定位尺寸类
+	 * 从系统取得的大块内存在程序结束前不会归还（与 SGI STL 的 alloc 相同），空闲链表与互斥量同样永不析构，
+	 * 因此静态析构阶段仍可以分配与释放
+	*/
+	class __size_class_pool {
+	private:
+		struct __free_list {
+			::std::mutex lock;
+			__pool_block* head = nullptr;
+		};
+
+		struct __free_lists {
+			__free_list lists[__pool_class_count];
+		};
+
+		static __free_list& __list_at(::size_t index) noexcept {
+			static __immortal<__free_lists> lists;
+			return lists.get().lists[index];
+		}
+
+		// 从系统取得一大块内存，切分为若干块，全部挂入空闲链表（调用方已持有锁）
+		static void __refill(__free_list& list, ::size_t block_bytes) {
+			::size_t block_count = __pool_chunk_bytes / block_bytes;
+			char* chunk = static_cast<char*>(::operator new(block_count * block_bytes));
+
+			__pool_block* first = reinterpret_cast<__pool_block*>(chunk);
+			__pool_block* cur = first;
+			for (::size_t i = 1; i < block_count; ++i) {
+				__pool_block* next = reinterpret_cast<__pool_block*>(chunk + i * block_bytes);
+				cur->next = next;
+				cur = next;
+			}
+			cur->next = list.head;
+			list.head = first;
+		}
+
+	public:
+		static constexpr ::size_t class_index(::size_t bytes) noexcept {
+			return (bytes - 1) / __pool_align;
+		}
+
+		static constexpr ::size_t class_bytes(::size_t index) noexcept {
+			return (index + 1) * __pool_align;
+		}
+
+		/**
+		 * @brief checks whether a pooled block obtained for bytes bytes can also hold new_bytes bytes
+		 * @brief 判断为 bytes 字节分配的池内块能否原地容纳 new_bytes 字节
+		 *
+		 * @note
+		 * 块按尺寸类取整，新旧大小属于同一尺寸类时块中已有足够的空间
+		 * bytes 为 0 时与分配时一样按 1 字节计
+		*/
+		static constexpr bool same_class(::size_t bytes, ::size_t new_bytes) noexcept {
+			return bytes <= __pool_max_bytes && new_bytes != 0 && new_bytes <= __pool_max_bytes &&
+				class_index(bytes == 0 ? 1 : bytes) == class_index(new_bytes);
+		}
+
+		/**
+		 * @brief allocates a block of at least bytes bytes, bytes must be in (0, __pool_max_bytes]
+		 * @brief 分配至少 bytes 字节的块，要求 0 < bytes <= __pool_max_bytes
+		*/
+		static void* allocate(::size_t bytes) {
+			::size_t index = class_index(bytes);
+			__free_list& list = __list_at(index);
+			::std::lock_guard<::std::mutex> guard(list.lock);
+
+			if (list.head == nullptr) {
+				__refill(list, class_bytes(index));
+			}
+			__pool_block* result = list.head;
+			list.head = result->next;
+			return result;
+		}
+
+		/**
+		 * @brief returns a block obtained from allocate(bytes) to its size class
+		 * @brief 将由 allocate(bytes) 得到的块归还给其尺寸类
+		*/
+		static void deallocate(void* ptr, ::size_t bytes) noexcept {
+			__free_list& list = __list_at(class_index(bytes));
+			__pool_block* block = static_cast<__pool_block*>(ptr);
+			::std::lock_guard<::std::mutex> guard(list.lock);
+			block->next = list.head;
+			list.head = block;
+		}
+
+		/**
+		 * @brief takes up to count blocks of the size class of bytes at once, under a single lock
+		 * @brief 在一次加锁内取出至多 count 个 bytes 所属尺寸类的块
+		 * @param count 期望的块数，返回时为实际取出的块数（至少为 1）
+		 * @return 以 nullptr 结尾的块链表
+		*/
+		static __pool_block* allocate_batch(::size_t bytes, ::size_t& count) {
+			::size_t index = class_index(bytes);
+			__free_list& list = __list_at(index);
+			::std::lock_guard<::std::mutex> guard(list.lock);
+
+			if (list.head == nullptr) {
+				__refill(list, class_bytes(index));
+			}
+			__pool_block* first = list.head;
+			__pool_block* last = first;
+			::size_t taken = 1;
+			for (; taken < count && last->next != nullptr; ++taken) {
+				last = last->next;
+			}
+			list.head = last->next;
+			last->next = nullptr;
+			count = taken;
+			return first;
+		}
+
+		/**
+		 * @brief returns the block list [first, last] to the size class of bytes under a single lock
+		 * @brief 在一次加锁内将块链表 [first, last] 归还给 bytes 所属的尺寸类
+		*/
+		static void deallocate_batch(__pool_block* first, __pool_block* last, ::size_t bytes) noexcept {
+			__free_list& list = __list_at(class_index(bytes));
+			::std::lock_guard<::std::mutex> guard(list.lock);
+			last->next = list.head;
+			list.head = first;
+		}
+	};
+
+	// 以全局 operator new 分配 bytes 字节、按 alignment 对齐的内存
+	inline void* __allocate_bytes(::size_t bytes, ::size_t alignment) {
+		#if __HAS_CPP17
+		if (alignment > __default_new_alignment) {
+			return ::operator new(bytes, ::std::align_val_t(alignment));
+		}
+		#else // ^^^ __HAS_CPP17 / vvv !__HAS_CPP17
+		if (alignment > __default_new_alignment) {
+			// 多分配 alignment 字节，并在对齐地址之前保存原始指针
+			char* raw = static_cast<char*>(::operator new(bytes + alignment + sizeof(void*)));
+			::std::uintptr_t addr = reinterpret_cast<::std::uintptr_t>(raw + sizeof(void*));
+			char* aligned = reinterpret_cast<char*>((addr + alignment - 1) & ~(alignment - 1));
+			reinterpret_cast<void**>(aligned)[-1] = raw;
+			return aligned;
+		}
+		#endif // __HAS_CPP17
+		return ::operator new(bytes);
+	}
+
+	// 归还由 __allocate_bytes(bytes, alignment) 得到的内存
+	inline void __deallocate_bytes(void* ptr, ::size_t bytes, ::size_t alignment) noexcept {
+		#if __HAS_CPP17
+		if (alignment > __default_new_alignment) {
+			#if defined(__cpp_sized_deallocation)
+			::operator delete(ptr, bytes, ::std::align_val_t(alignment));
+			#else
+			::operator delete(ptr, ::std::align_val_t(alignment));
+			#endif
+			return;
+		}
+		#else // ^^^ __HAS_CPP17 / vvv !__HAS_CPP17
+		if (alignment > __default_new_alignment) {
+			::operator delete(reinterpret_cast<void**>(ptr)[-1]);
+			return;
+		}
+		#endif // __HAS_CPP17
+		// inline_allocator 等先判断内存是否来自内部缓冲区，只把其余的内存交到这里
+		// g++ 内联后无法证明该判断成立，会对缓冲区误报 -Wfree-nonheap-object
+		#if defined(__GNUC__) && !defined(__clang__)
+		#pragma GCC diagnostic push
+		#pragma GCC diagnostic ignored "-Wfree-nonheap-object"
+		#endif
+		#if defined(__cpp_sized_deallocation)
+		::operator delete(ptr, bytes);
+		#else
+		(void)bytes;
+		::operator delete(ptr);
+		#endif
+		#if defined(__GNUC__) && !defined(__clang__)
+		#pragma GCC diagnostic pop
+		#endif
+	}
+	__INNER_END
+
+	/**
+	 * @brief the default allocator
+	 * @brief 默认的分配器
+	 * @tparam ValueT 分配的对象类型
+	 *
+	 * @note
+	 * 不超过 256 字节且无需超额对齐的请求由按尺寸类划分的空闲链表提供，其余请求交给全局 operator new
+	 * 超额对齐的类型（alignment_of<ValueT> 大于 operator new 的默认对齐）使用带对齐的 operator new
+	 * deallocate 根据 n 重新计算尺寸类，无需在块中保存任何头信息
+	*/
 	template <typename ValueT>
 	struct allocator {
 
@@ -15,42 +1196,3626 @@ namespace __MY_NAMESPACE {
 		using const_reference = const ValueT&;
 		using size_type = ::size_t;
 		using difference_type = ::ptrdiff_t;
-	
+
+		template <typename OtherValueT>
+		struct rebind { using other = allocator<OtherValueT>; };
+
+		/** @brief 所有实例均相等，容器移动赋值与交换时无需比较分配器 */
+		using is_always_equal = true_type;
+		using propagate_on_container_move_assignment = true_type;
+
+	private:
+		static constexpr ::size_t __alignment = alignment_of<ValueT>::value;
+
+		static constexpr bool __use_pool(::size_t bytes) noexcept {
+			return __alignment <= __INNER_NAMESPACE::__pool_align && bytes <= __INNER_NAMESPACE::__pool_max_bytes;
+		}
+
 	public:
-		constexpr allocator() noexcept;
+		constexpr allocator() noexcept {}
 
-		constexpr allocator(const allocator& other) noexcept;
+		constexpr allocator(const allocator& other) noexcept = default;
 
 		template <typename OtherValueT>
-		constexpr allocator(const allocator<OtherValueT>& other) noexcept;
+		constexpr allocator(const allocator<OtherValueT>&) noexcept {}
 
-		constexpr ~allocator();
+		__CONSTEXPR20 ~allocator() = default;
+
+		/**
+		 * @brief returns the largest supported allocation size
+		 * @brief 返回可分配的最大对象个数
+		*/
+		constexpr size_type max_size() const noexcept {
+			return static_cast<size_type>(-1) / sizeof(ValueT);
+		}
 
 		/**
 		 * @brief allocates uninitialized storage
 		 * @param n the number of objects to allocate storage for
 		 * @return Pointer to the first element of an array of n objects of type T whose elements have not been constructed yet.
 		*/
-		[[nodiscard]]
-		constexpr pointer allocate(size_type n);
+		__NODISCARD pointer allocate(size_type n) {
+			if (n > max_size()) {
+				throw ::std::bad_array_new_length();
+			}
+			::size_t bytes = n * sizeof(ValueT);
+			if (bytes == 0) {
+				bytes = 1;
+			}
+			if (__use_pool(bytes)) {
+				return static_cast<pointer>(__INNER_NAMESPACE::__size_class_pool::allocate(bytes));
+			}
+			return static_cast<pointer>(__INNER_NAMESPACE::__allocate_bytes(bytes, __alignment));
+		}
 
 		/**
 		 * @brief deallocates storage
 		 * @param ptr pointer obtained from allocate()
 		 * @param n number of objects earlier passed to allocate()
 		*/
-		constexpr void deallocate(pointer ptr, size_type n);
+		void deallocate(pointer ptr, size_type n) noexcept {
+			::size_t bytes = n * sizeof(ValueT);
+			if (bytes == 0) {
+				bytes = 1;
+			}
+			if (__use_pool(bytes)) {
+				__INNER_NAMESPACE::__size_class_pool::deallocate(ptr, bytes);
+				return;
+			}
+			__INNER_NAMESPACE::__deallocate_bytes(ptr, bytes, __alignment);
+		}
 
 		/**
-		 * @brief compares two allocator instances
-		 * @param lhs default allocators to compare
-		 * @param rhs default allocators to compare
-		 * @return true if two allocators are equivalent
+		 * @brief (non-standard feature) tries to extend the storage obtained from allocate(n) in place to hold new_n objects
+		 * @brief （非标准内容）尝试原地扩展由 allocate(n) 得到的存储，使之能容纳 new_n 个对象
+		 * @return 成功时返回 true，此后须以 new_n 调用 deallocate
 		*/
-		template <typename ValueT1, typename ValueT2>
-		friend constexpr bool operator==(const allocator<ValueT1>& lhs, const allocator<ValueT2>& rhs) noexcept;
+		bool expand(pointer, size_type n, size_type new_n) const noexcept {
+			return new_n <= max_size() && __alignment <= __INNER_NAMESPACE::__pool_align &&
+				__INNER_NAMESPACE::__size_class_pool::same_class(n * sizeof(ValueT), new_n * sizeof(ValueT));
+		}
+
+	};
+
+	/**
+	 * @brief compares two allocator instances
+	 * @param lhs default allocators to compare
+	 * @param rhs default allocators to compare
+	 * @return true if two allocators are equivalent
+	*/
+	template <typename ValueT1, typename ValueT2>
+	constexpr bool operator==(const allocator<ValueT1>&, const allocator<ValueT2>&) noexcept {
+		return true;
+	}
+
+	#if !__HAS_CPP20
+	/**
+	 * @brief compares two allocator instances
+	 * @param lhs default allocators to compare
+	 * @param rhs default allocators to compare
+	 * @return false, default allocators are always equivalent
+	*/
+	template <typename ValueT1, typename ValueT2>
+	constexpr bool operator!=(const allocator<ValueT1>&, const allocator<ValueT2>&) noexcept {
+		return false;
+	}
+	#endif // !__HAS_CPP20
+
+	#pragma endregion allocator
+
+	#pragma region pool_allocator
+
+	__INNER_BEGIN
+	// 线程缓存与中心内存池之间一次搬运的块数；缓存中某尺寸类的块数超过其两倍时归还一批
+	constexpr ::size_t __thread_cache_batch = 32;
+
+	/**
+	 * @brief (non-standard feature) per-thread cache of small blocks in front of __size_class_pool
+	 * @brief （非标准内容）位于 __size_class_pool 之前的线程私有小块缓存
+	 *
+	 * @note
+	 * 命中缓存时分配与释放均不加锁；缓存为空时从中心内存池批量取块，缓存过多时批量归还，每次搬运只加一次锁
+	 * 线程退出时缓存中的全部块归还中心内存池；此后该线程上的请求直接交给中心内存池
+	*/
+	class __thread_cache {
+	private:
+		struct __cache_list {
+			__pool_block* head = nullptr;
+			::size_t count = 0;
+		};
+
+		__cache_list __lists[__pool_class_count];
+
+		__thread_cache() = default;
+
+		~__thread_cache() {
+			for (::size_t i = 0; i < __pool_class_count; ++i) {
+				__cache_list& list = __lists[i];
+				if (list.head == nullptr) {
+					continue;
+				}
+				__pool_block* last = list.head;
+				while (last->next != nullptr) {
+					last = last->next;
+				}
+				__size_class_pool::deallocate_batch(list.head, last, __size_class_pool::class_bytes(i));
+			}
+			__torn_down() = true;
+		}
+
+		// 线程缓存是否已被析构；bool 可平凡析构，在线程的整个生命期内都可安全访问
+		static bool& __torn_down() noexcept {
+			static thread_local bool torn_down = false;
+			return torn_down;
+		}
+
+		static __thread_cache& __local() noexcept {
+			static thread_local __thread_cache cache;
+			return cache;
+		}
+
+		void* __allocate(::size_t bytes) {
+			__cache_list& list = __lists[__size_class_pool::class_index(bytes)];
+			if (list.head == nullptr) {
+				::size_t count = __thread_cache_batch;
+				list.head = __size_class_pool::allocate_batch(bytes, count);
+				list.count = count;
+			}
+			__pool_block* result = list.head;
+			list.head = result->next;
+			--list.count;
+			return result;
+		}
+
+		void __deallocate(void* ptr, ::size_t bytes) noexcept {
+			__cache_list& list = __lists[__size_class_pool::class_index(bytes)];
+			__pool_block* block = static_cast<__pool_block*>(ptr);
+			block->next = list.head;
+			list.head = block;
+			if (++list.count <= 2 * __thread_cache_batch) {
+				return;
+			}
+
+			__pool_block* first = list.head;
+			__pool_block* last = first;
+			for (::size_t i = 1; i < __thread_cache_batch; ++i) {
+				last = last->next;
+			}
+			list.head = last->next;
+			list.count -= __thread_cache_batch;
+			__size_class_pool::deallocate_batch(first, last, bytes);
+		}
+
+	public:
+		/**
+		 * @brief allocates a block of at least bytes bytes, bytes must be in (0, __pool_max_bytes]
+		 * @brief 分配至少 bytes 字节的块，要求 0 < bytes <= __pool_max_bytes
+		*/
+		static void* allocate(::size_t bytes) {
+			if (__torn_down()) {
+				return __size_class_pool::allocate(bytes);
+			}
+			return __local().__allocate(bytes);
+		}
+
+		/**
+		 * @brief returns a block obtained from allocate(bytes), possibly allocated by another thread
+		 * @brief 归还由 allocate(bytes) 得到的块，该块可以由其他线程分配
+		*/
+		static void deallocate(void* ptr, ::size_t bytes) noexcept {
+			if (__torn_down()) {
+				__size_class_pool::deallocate(ptr, bytes);
+				return;
+			}
+			__local().__deallocate(ptr, bytes);
+		}
+	};
+	__INNER_END
+
+	/**
+	 * @brief (non-standard feature) allocator backed by per-thread caches of fixed-size blocks
+	 * @brief （非标准内容）由线程私有的定长块缓存支撑的分配器
+	 * @tparam ValueT 分配的对象类型
+	 *
+	 * @note
+	 * 接口与 allocator 相同；小块请求先查线程缓存，缓存为空时从中心内存池批量补充，适合多线程下频繁分配释放结点的容器
+	 * 超出小块范围或超额对齐的请求与 allocator 相同，交给全局 operator new
+	 * 由任一 pool_allocator 分配的内存可以由任一 pool_allocator 在任一线程上释放
+	*/
+	template <typename ValueT>
+	struct pool_allocator {
+
+	public:
+		using value_type = ValueT;
+		using pointer = ValueT*;
+		using const_pointer = const ValueT*;
+		using reference = ValueT&;
+		using const_reference = const ValueT&;
+		using size_type = ::size_t;
+		using difference_type = ::ptrdiff_t;
+
+		template <typename OtherValueT>
+		struct rebind { using other = pool_allocator<OtherValueT>; };
+
+		/** @brief 所有实例均相等，容器移动赋值与交换时无需比较分配器 */
+		using is_always_equal = true_type;
+		using propagate_on_container_move_assignment = true_type;
+
+	private:
+		static constexpr ::size_t __alignment = alignment_of<ValueT>::value;
+
+		static constexpr bool __use_pool(::size_t bytes) noexcept {
+			return __alignment <= __INNER_NAMESPACE::__pool_align && bytes <= __INNER_NAMESPACE::__pool_max_bytes;
+		}
+
+	public:
+		constexpr pool_allocator() noexcept {}
+
+		constexpr pool_allocator(const pool_allocator& other) noexcept = default;
+
+		template <typename OtherValueT>
+		constexpr pool_allocator(const pool_allocator<OtherValueT>&) noexcept {}
+
+		__CONSTEXPR20 ~pool_allocator() = default;
+
+		/**
+		 * @brief returns the largest supported allocation size
+		 * @brief 返回可分配的最大对象个数
+		*/
+		constexpr size_type max_size() const noexcept {
+			return static_cast<size_type>(-1) / sizeof(ValueT);
+		}
+
+		/**
+		 * @brief allocates uninitialized storage
+		 * @param n the number of objects to allocate storage for
+		 * @return Pointer to the first element of an array of n objects of type T whose elements have not been constructed yet.
+		*/
+		__NODISCARD pointer allocate(size_type n) {
+			if (n > max_size()) {
+				throw ::std::bad_array_new_length();
+			}
+			::size_t bytes = n * sizeof(ValueT);
+			if (bytes == 0) {
+				bytes = 1;
+			}
+			if (__use_pool(bytes)) {
+				return static_cast<pointer>(__INNER_NAMESPACE::__thread_cache::allocate(bytes));
+			}
+			return static_cast<pointer>(__INNER_NAMESPACE::__allocate_bytes(bytes, __alignment));
+		}
+
+		/**
+		 * @brief deallocates storage
+		 * @param ptr pointer obtained from allocate()
+		 * @param n number of objects earlier passed to allocate()
+		*/
+		void deallocate(pointer ptr, size_type n) noexcept {
+			::size_t bytes = n * sizeof(ValueT);
+			if (bytes == 0) {
+				bytes = 1;
+			}
+			if (__use_pool(bytes)) {
+				__INNER_NAMESPACE::__thread_cache::deallocate(ptr, bytes);
+				return;
+			}
+			__INNER_NAMESPACE::__deallocate_bytes(ptr, bytes, __alignment);
+		}
+
+		/**
+		 * @brief (non-standard feature) tries to extend the storage obtained from allocate(n) in place to hold new_n objects
+		 * @brief （非标准内容）尝试原地扩展由 allocate(n) 得到的存储，使之能容纳 new_n 个对象
+		 * @return 成功时返回 true，此后须以 new_n 调用 deallocate
+		*/
+		bool expand(pointer, size_type n, size_type new_n) const noexcept {
+			return new_n <= max_size() && __alignment <= __INNER_NAMESPACE::__pool_align &&
+				__INNER_NAMESPACE::__size_class_pool::same_class(n * sizeof(ValueT), new_n * sizeof(ValueT));
+		}
 
 	};
-} // namespace My
 
+	/**
+	 * @brief compares two pool_allocator instances
+	 * @param lhs pool allocators to compare
+	 * @param rhs pool allocators to compare
+	 * @return true, all pool allocators share the same pools
+	*/
+	template <typename ValueT1, typename ValueT2>
+	constexpr bool operator==(const pool_allocator<ValueT1>&, const pool_allocator<ValueT2>&) noexcept {
+		return true;
+	}
+
+	#if !__HAS_CPP20
+	/**
+	 * @brief compares two pool_allocator instances
+	 * @param lhs pool allocators to compare
+	 * @param rhs pool allocators to compare
+	 * @return false, all pool allocators share the same pools
+	*/
+	template <typename ValueT1, typename ValueT2>
+	constexpr bool operator!=(const pool_allocator<ValueT1>&, const pool_allocator<ValueT2>&) noexcept {
+		return false;
+	}
+	#endif // !__HAS_CPP20
+
+	#pragma endregion pool_allocator
+
+	#pragma region slab_allocator
+
+	__INNER_BEGIN
+	// slab 的目标大小，未指定每个 slab 的槽数时，按一个 slab 恰好占满一页计算
+	constexpr ::size_t __slab_page_bytes = 4096;
+
+	constexpr ::size_t __slab_round_up(::size_t n, ::size_t align) noexcept {
+		return (n + align - 1) / align * align;
+	}
+
+	constexpr ::size_t __slab_round_pow2(::size_t n, ::size_t pow2 = 1) noexcept {
+		return pow2 >= n ? pow2 : __slab_round_pow2(n, pow2 * 2);
+	}
+
+	// slab 头部，位于 slab 的起始处，其后是若干等长的槽
+	struct __slab_header {
+		__slab_header* prev;
+		__slab_header* next;
+		__pool_block* free;		// 已释放的槽组成的链表
+		::size_t used;			// 已分配出去的槽数
+		::size_t carved;		// 已切分过的槽数，其后的槽从未被使用
+	};
+
+	/**
+	 * @brief (non-standard feature) slabs of equal-sized slots shared by all slab_allocator of the same slot layout
+	 * @brief （非标准内容）由等长槽组成的 slab 集合，槽的尺寸与对齐相同的 slab_allocator 共享同一组 slab
+	 * @tparam SlotBytes 槽的字节数
+	 * @tparam SlotAlign 槽的对齐
+	 * @tparam BlockCount 每个 slab 至少容纳的槽数，为 0 时一个 slab 占满一页
+	 * @tparam MaxEmptySlabs 保留的空 slab 数上限，超出时空 slab 立即归还系统
+	 *
+	 * @note
+	 * slab 按其自身大小（2 的幂）对齐，释放时将地址低位清零即可找到所属的 slab
+	 * 空闲槽内部存放链表指针，slab 中从未使用过的槽按需切分，新 slab 不会被整体触碰
+	 * 部分使用的 slab 组成链表，分配总是从其表头取槽；已满的 slab 不在任何链表中
+	*/
+	template <::size_t SlotBytes, ::size_t SlotAlign, ::size_t BlockCount, ::size_t MaxEmptySlabs>
+	class __slab_pool {
+	private:
+		static constexpr ::size_t __slots_offset = __slab_round_up(sizeof(__slab_header), SlotAlign);
+		static constexpr ::size_t __default_count =
+			__slab_page_bytes > __slots_offset + SlotBytes ? (__slab_page_bytes - __slots_offset) / SlotBytes : 1;
+
+	public:
+		static constexpr ::size_t slab_bytes =
+			__slab_round_pow2(__slots_offset + (BlockCount == 0 ? __default_count : BlockCount) * SlotBytes);
+		// 向上取整为 2 的幂后剩余的空间同样切分为槽
+		static constexpr ::size_t slab_capacity = (slab_bytes - __slots_offset) / SlotBytes;
+
+	private:
+		struct __state {
+			::std::mutex lock;
+			__slab_header* partial = nullptr;
+			__slab_header* empty = nullptr;
+			::size_t empty_count = 0;
+		};
+
+		// 永不析构：静态析构阶段仍可能有容器归还槽
+		static __state& __instance() noexcept {
+			static __immortal<__state> state;
+			return state.get();
+		}
+
+		static void __push(__slab_header*& list, __slab_header* slab) noexcept {
+			slab->prev = nullptr;
+			slab->next = list;
+			if (list != nullptr) {
+				list->prev = slab;
+			}
+			list = slab;
+		}
+
+		static void __unlink(__slab_header*& list, __slab_header* slab) noexcept {
+			if (slab->prev != nullptr) {
+				slab->prev->next = slab->next;
+			}
+			else {
+				list = slab->next;
+			}
+			if (slab->next != nullptr) {
+				slab->next->prev = slab->prev;
+			}
+		}
+
+		static __slab_header* __reset(__slab_header* slab) noexcept {
+			slab->free = nullptr;
+			slab->used = 0;
+			slab->carved = 0;
+			return slab;
+		}
+
+	public:
+		/**
+		 * @brief allocates one slot
+		 * @brief 分配一个槽
+		*/
+		static void* allocate() {
+			__state& state = __instance();
+			::std::lock_guard<::std::mutex> guard(state.lock);
+
+			__slab_header* slab = state.partial;
+			if (slab == nullptr) {
+				if (state.empty != nullptr) {
+					slab = state.empty;
+					__unlink(state.empty, slab);
+					--state.empty_count;
+				}
+				else {
+					slab = __reset(static_cast<__slab_header*>(__allocate_bytes(slab_bytes, slab_bytes)));
+				}
+				__push(state.partial, slab);
+			}
+
+			void* slot;
+			if (slab->free != nullptr) {
+				slot = slab->free;
+				slab->free = slab->free->next;
+			}
+			else {
+				slot = reinterpret_cast<char*>(slab) + __slots_offset + slab->carved++ * SlotBytes;
+			}
+			if (++slab->used == slab_capacity) {
+				__unlink(state.partial, slab);
+			}
+			return slot;
+		}
+
+		/**
+		 * @brief returns a slot obtained from allocate()
+		 * @brief 归还由 allocate() 得到的槽，slab 变空且空 slab 数已达上限时将其归还系统
+		*/
+		static void deallocate(void* ptr) noexcept {
+			__slab_header* slab = reinterpret_cast<__slab_header*>(
+				reinterpret_cast<::std::uintptr_t>(ptr) & ~static_cast<::std::uintptr_t>(slab_bytes - 1)
+			);
+			__pool_block* block = static_cast<__pool_block*>(ptr);
+			__state& state = __instance();
+			{
+				::std::lock_guard<::std::mutex> guard(state.lock);
+				bool was_full = slab->used == slab_capacity;
+				block->next = slab->free;
+				slab->free = block;
+
+				if (--slab->used != 0) {
+					if (was_full) {
+						__push(state.partial, slab);
+					}
+					return;
+				}
+				if (!was_full) {
+					__unlink(state.partial, slab);
+				}
+				if (state.empty_count < MaxEmptySlabs) {
+					__push(state.empty, __reset(slab));
+					++state.empty_count;
+					return;
+				}
+			}
+			__deallocate_bytes(slab, slab_bytes, slab_bytes);
+		}
+	};
+
+	// 槽至少能容纳一个链表指针
+	template <typename T>
+	struct __slab_slot {
+		static constexpr ::size_t align = alignment_of<T>::value > alignment_of<__pool_block>::value ?
+			alignment_of<T>::value : alignment_of<__pool_block>::value;
+		static constexpr ::size_t bytes = __slab_round_up(sizeof(T) > sizeof(__pool_block) ? sizeof(T) : sizeof(__pool_block), align);
+	};
+	__INNER_END
+
+	/**
+	 * @brief (non-standard feature) allocator carving page-sized slabs into slots of one object each
+	 * @brief （非标准内容）将整页大小的 slab 切分为等长的槽、每次分配一个对象的分配器
+	 * @tparam ValueT 分配的对象类型
+	 * @tparam BlockCount 每个 slab 至少容纳的对象数，为 0（默认）时一个 slab 占满一页
+	 * @tparam MaxEmptySlabs 保留的空 slab 数上限，超出时空 slab 立即归还系统
+	 *
+	 * @note
+	 * 接口与 allocator 相同，适合链表、树、哈希表等每次只分配一个结点的容器；rebind 时保留 BlockCount 与 MaxEmptySlabs
+	 * 单个对象的分配与释放为 O(1)，结点在 slab 中紧密排列；一次分配多个对象时交给全局 operator new
+	 * 槽的尺寸与对齐相同的 slab_allocator 共享同一组 slab，任一实例分配的内存可以由任一实例在任一线程上释放
+	*/
+	template <typename ValueT, ::size_t BlockCount = 0, ::size_t MaxEmptySlabs = 1>
+	struct slab_allocator {
+
+	public:
+		using value_type = ValueT;
+		using pointer = ValueT*;
+		using const_pointer = const ValueT*;
+		using reference = ValueT&;
+		using const_reference = const ValueT&;
+		using size_type = ::size_t;
+		using difference_type = ::ptrdiff_t;
+
+		template <typename OtherValueT>
+		struct rebind { using other = slab_allocator<OtherValueT, BlockCount, MaxEmptySlabs>; };
+
+		/** @brief 所有实例均相等，容器移动赋值与交换时无需比较分配器 */
+		using is_always_equal = true_type;
+		using propagate_on_container_move_assignment = true_type;
+
+	private:
+		static constexpr ::size_t __alignment = alignment_of<ValueT>::value;
+
+		using __pool = __INNER_NAMESPACE::__slab_pool<
+			__INNER_NAMESPACE::__slab_slot<ValueT>::bytes,
+			__INNER_NAMESPACE::__slab_slot<ValueT>::align,
+			BlockCount,
+			MaxEmptySlabs
+		>;
+
+	public:
+		constexpr slab_allocator() noexcept {}
+
+		constexpr slab_allocator(const slab_allocator& other) noexcept = default;
+
+		template <typename OtherValueT>
+		constexpr slab_allocator(const slab_allocator<OtherValueT, BlockCount, MaxEmptySlabs>&) noexcept {}
+
+		__CONSTEXPR20 ~slab_allocator() = default;
+
+		/**
+		 * @brief returns the largest supported allocation size
+		 * @brief 返回可分配的最大对象个数
+		*/
+		constexpr size_type max_size() const noexcept {
+			return static_cast<size_type>(-1) / sizeof(ValueT);
+		}
+
+		/**
+		 * @brief allocates uninitialized storage
+		 * @param n the number of objects to allocate storage for
+		 * @return Pointer to the first element of an array of n objects of type T whose elements have not been constructed yet.
+		*/
+		__NODISCARD pointer allocate(size_type n) {
+			if (n == 1) {
+				return static_cast<pointer>(__pool::allocate());
+			}
+			if (n > max_size()) {
+				throw ::std::bad_array_new_length();
+			}
+			::size_t bytes = n * sizeof(ValueT);
+			return static_cast<pointer>(__INNER_NAMESPACE::__allocate_bytes(bytes == 0 ? 1 : bytes, __alignment));
+		}
+
+		/**
+		 * @brief deallocates storage
+		 * @param ptr pointer obtained from allocate()
+		 * @param n number of objects earlier passed to allocate()
+		*/
+		void deallocate(pointer ptr, size_type n) noexcept {
+			if (n == 1) {
+				__pool::deallocate(ptr);
+				return;
+			}
+			::size_t bytes = n * sizeof(ValueT);
+			__INNER_NAMESPACE::__deallocate_bytes(ptr, bytes == 0 ? 1 : bytes, __alignment);
+		}
+
+		/**
+		 * @brief (non-standard feature) returns the number of objects in one slab
+		 * @brief （非标准内容）返回一个 slab 容纳的对象数
+		*/
+		static constexpr size_type slab_capacity() noexcept {
+			return __pool::slab_capacity;
+		}
+
+	};
+
+	/**
+	 * @brief compares two slab_allocator instances
+	 * @param lhs slab allocators to compare
+	 * @param rhs slab allocators to compare
+	 * @return true, all slab allocators share the same slabs
+	*/
+	template <typename ValueT1, typename ValueT2, ::size_t BlockCount, ::size_t MaxEmptySlabs>
+	constexpr bool operator==(const slab_allocator<ValueT1, BlockCount, MaxEmptySlabs>&, const slab_allocator<ValueT2, BlockCount, MaxEmptySlabs>&) noexcept {
+		return true;
+	}
+
+	#if !__HAS_CPP20
+	/**
+	 * @brief compares two slab_allocator instances
+	 * @param lhs slab allocators to compare
+	 * @param rhs slab allocators to compare
+	 * @return false, all slab allocators share the same slabs
+	*/
+	template <typename ValueT1, typename ValueT2, ::size_t BlockCount, ::size_t MaxEmptySlabs>
+	constexpr bool operator!=(const slab_allocator<ValueT1, BlockCount, MaxEmptySlabs>&, const slab_allocator<ValueT2, BlockCount, MaxEmptySlabs>&) noexcept {
+		return false;
+	}
+	#endif // !__HAS_CPP20
+
+	#pragma endregion slab_allocator
+
+	#pragma region tracking_allocator
+
+	/**
+	 * @brief (non-standard feature) allocation statistics of one tag, see tracking_allocator
+	 * @brief （非标准内容）某个标签的分配统计，见 tracking_allocator
+	*/
+	struct tracking_stats {
+		/** @brief 直方图的桶数，第 i 个桶统计字节数在 [2^i, 2^(i+1)) 内的分配，0 字节计入第 0 个桶 */
+		static constexpr ::size_t histogram_bins = sizeof(::size_t) * 8;
+
+		::size_t allocations = 0;
+		::size_t deallocations = 0;
+		::size_t bytes_allocated = 0;
+		::size_t bytes_deallocated = 0;
+		/** @brief 当前仍在使用的字节数，不受 reset 影响 */
+		::size_t bytes_in_use = 0;
+		/** @brief 自上次 reset 以来 bytes_in_use 的峰值 */
+		::size_t peak_bytes_in_use = 0;
+		::size_t size_histogram[histogram_bins] = {};
+	};
+
+	__INNER_BEGIN
+	// 线程私有的净字节数超过该值时并入全局计数并更新峰值，峰值的误差不超过 线程数 * 该值
+	constexpr long long __tracking_flush_bytes = 64 * 1024;
+
+	inline ::size_t __floor_log2(::size_t n) noexcept {
+		::size_t result = 0;
+		for (::size_t shift = sizeof(::size_t) * 4; shift != 0; shift >>= 1) {
+			if ((n >> shift) != 0) {
+				n >>= shift;
+				result += shift;
+			}
+		}
+		return result;
+	}
+
+	/**
+	 * @brief (non-standard feature) per-thread allocation counters of one tag
+	 * @brief （非标准内容）某个标签的线程私有分配计数
+	 *
+	 * @note
+	 * 只有所属线程写入，写入为 relaxed 的读后写，不需要原子读改写指令；其他线程在合并时只读
+	*/
+	struct __tracking_counters {
+		::std::atomic<::size_t> allocations{ 0 };
+		::std::atomic<::size_t> deallocations{ 0 };
+		::std::atomic<::size_t> bytes_allocated{ 0 };
+		::std::atomic<::size_t> bytes_deallocated{ 0 };
+		::std::atomic<::size_t> histogram[tracking_stats::histogram_bins];
+		// 尚未并入全局计数的净字节数，及上次并入以来其最大值
+		::std::atomic<long long> pending{ 0 };
+		::std::atomic<long long> pending_peak{ 0 };
+
+		__tracking_counters* prev = nullptr;
+		__tracking_counters* next = nullptr;
+
+		__tracking_counters() noexcept {
+			for (auto& bin : histogram) {
+				bin.store(0, ::std::memory_order_relaxed);
+			}
+		}
+
+		static void bump(::std::atomic<::size_t>& counter, ::size_t value) noexcept {
+			counter.store(counter.load(::std::memory_order_relaxed) + value, ::std::memory_order_relaxed);
+		}
+
+		// 将计数累加到 stats 中
+		void accumulate(tracking_stats& stats) const noexcept {
+			stats.allocations += allocations.load(::std::memory_order_relaxed);
+			stats.deallocations += deallocations.load(::std::memory_order_relaxed);
+			stats.bytes_allocated += bytes_allocated.load(::std::memory_order_relaxed);
+			stats.bytes_deallocated += bytes_deallocated.load(::std::memory_order_relaxed);
+			for (::size_t i = 0; i < tracking_stats::histogram_bins; ++i) {
+				stats.size_histogram[i] += histogram[i].load(::std::memory_order_relaxed);
+			}
+		}
+	};
+
+	/**
+	 * @brief (non-standard feature) registry of the per-thread counters of one tag
+	 * @brief （非标准内容）某个标签的全部线程私有计数的登记处
+	 *
+	 * @note
+	 * 记录时只写本线程的计数；读取时加锁遍历全部线程的计数并求和
+	 * 线程退出时其计数并入 __retired，此后该线程上的记录直接加锁写入 __retired
+	 * reset 不修改任何线程的计数，而是保存当前的和作为基线，读取时减去
+	*/
+	template <typename Tag>
+	class __tracking_registry {
+	private:
+		struct __state {
+			::std::mutex lock;
+			__tracking_counters* threads = nullptr;
+			__tracking_counters retired;
+			tracking_stats baseline;
+			::std::atomic<long long> in_use{ 0 };
+			::std::atomic<long long> peak{ 0 };
+		};
+
+		static __state& __instance() noexcept {
+			static __state state;
+			return state;
+		}
+
+		class __thread_slot {
+		public:
+			__tracking_counters counters;
+
+			__thread_slot() {
+				__state& state = __instance();
+				::std::lock_guard<::std::mutex> guard(state.lock);
+				counters.next = state.threads;
+				if (state.threads != nullptr) {
+					state.threads->prev = &counters;
+				}
+				state.threads = &counters;
+			}
+
+			~__thread_slot() {
+				__state& state = __instance();
+				__flush(state, counters.pending.exchange(0, ::std::memory_order_relaxed), counters.pending_peak.load(::std::memory_order_relaxed));
+				{
+					::std::lock_guard<::std::mutex> guard(state.lock);
+					__merge(state.retired, counters);
+					if (counters.prev != nullptr) {
+						counters.prev->next = counters.next;
+					}
+					else {
+						state.threads = counters.next;
+					}
+					if (counters.next != nullptr) {
+						counters.next->prev = counters.prev;
+					}
+				}
+				__torn_down() = true;
+			}
+		};
+
+		// 本线程的计数是否已被析构
+		static bool& __torn_down() noexcept {
+			static thread_local bool torn_down = false;
+			return torn_down;
+		}
+
+		static __tracking_counters& __local() {
+			static thread_local __thread_slot slot;
+			return slot.counters;
+		}
+
+		static void __merge(__tracking_counters& to, const __tracking_counters& from) noexcept {
+			__tracking_counters::bump(to.allocations, from.allocations.load(::std::memory_order_relaxed));
+			__tracking_counters::bump(to.deallocations, from.deallocations.load(::std::memory_order_relaxed));
+			__tracking_counters::bump(to.bytes_allocated, from.bytes_allocated.load(::std::memory_order_relaxed));
+			__tracking_counters::bump(to.bytes_deallocated, from.bytes_deallocated.load(::std::memory_order_relaxed));
+			for (::size_t i = 0; i < tracking_stats::histogram_bins; ++i) {
+				__tracking_counters::bump(to.histogram[i], from.histogram[i].load(::std::memory_order_relaxed));
+			}
+		}
+
+		static void __raise_peak(__state& state, long long candidate) noexcept {
+			long long peak = state.peak.load(::std::memory_order_relaxed);
+			while (candidate > peak && !state.peak.compare_exchange_weak(peak, candidate, ::std::memory_order_relaxed)) {}
+		}
+
+		// 将净字节数并入全局计数，并以并入前的全局计数加上本线程净字节数的最大值更新峰值
+		static void __flush(__state& state, long long delta, long long pending_peak) noexcept {
+			long long in_use = state.in_use.fetch_add(delta, ::std::memory_order_relaxed);
+			__raise_peak(state, in_use + (pending_peak > delta ? pending_peak : delta));
+		}
+
+		static void __record(__tracking_counters& counters, bool allocate, ::size_t bytes) noexcept {
+			if (allocate) {
+				__tracking_counters::bump(counters.allocations, 1);
+				__tracking_counters::bump(counters.bytes_allocated, bytes);
+				__tracking_counters::bump(counters.histogram[__floor_log2(bytes)], 1);
+			}
+			else {
+				__tracking_counters::bump(counters.deallocations, 1);
+				__tracking_counters::bump(counters.bytes_deallocated, bytes);
+			}
+		}
+
+		static void __record(bool allocate, ::size_t bytes) noexcept {
+			__state& state = __instance();
+			long long delta = allocate ? static_cast<long long>(bytes) : -static_cast<long long>(bytes);
+			if (__torn_down()) {
+				{
+					::std::lock_guard<::std::mutex> guard(state.lock);
+					__record(state.retired, allocate, bytes);
+				}
+				__flush(state, delta, 0);
+				return;
+			}
+
+			__tracking_counters& counters = __local();
+			__record(counters, allocate, bytes);
+			long long pending = counters.pending.load(::std::memory_order_relaxed) + delta;
+			long long pending_peak = counters.pending_peak.load(::std::memory_order_relaxed);
+			if (pending > pending_peak) {
+				pending_peak = pending;
+			}
+			if (pending >= __tracking_flush_bytes || pending <= -__tracking_flush_bytes) {
+				__flush(state, pending, pending_peak);
+				pending = 0;
+				pending_peak = 0;
+			}
+			counters.pending.store(pending, ::std::memory_order_relaxed);
+			counters.pending_peak.store(pending_peak, ::std::memory_order_relaxed);
+		}
+
+		// 当前的总计数（不减去基线）与使用中的字节数，调用方已持有锁
+		// peak_bound 为全局计数加上各线程净字节数的最大值，单线程时即为精确的峰值
+		static tracking_stats __total(__state& state, long long& in_use, long long& peak_bound) noexcept {
+			tracking_stats total;
+			state.retired.accumulate(total);
+			in_use = state.in_use.load(::std::memory_order_relaxed);
+			peak_bound = in_use;
+			for (__tracking_counters* counters = state.threads; counters != nullptr; counters = counters->next) {
+				counters->accumulate(total);
+				in_use += counters->pending.load(::std::memory_order_relaxed);
+				long long pending_peak = counters->pending_peak.load(::std::memory_order_relaxed);
+				peak_bound += pending_peak > 0 ? pending_peak : 0;
+			}
+			return total;
+		}
+
+	public:
+		static void record_allocate(::size_t bytes) noexcept {
+			__record(true, bytes);
+		}
+
+		static void record_deallocate(::size_t bytes) noexcept {
+			__record(false, bytes);
+		}
+
+		static tracking_stats snapshot() {
+			__state& state = __instance();
+			::std::lock_guard<::std::mutex> guard(state.lock);
+			long long in_use, peak_bound;
+			tracking_stats stats = __total(state, in_use, peak_bound);
+			const tracking_stats& base = state.baseline;
+
+			stats.allocations -= base.allocations;
+			stats.deallocations -= base.deallocations;
+			stats.bytes_allocated -= base.bytes_allocated;
+			stats.bytes_deallocated -= base.bytes_deallocated;
+			for (::size_t i = 0; i < tracking_stats::histogram_bins; ++i) {
+				stats.size_histogram[i] -= base.size_histogram[i];
+			}
+			long long peak = state.peak.load(::std::memory_order_relaxed);
+			if (peak_bound > peak) {
+				peak = peak_bound;
+			}
+			stats.bytes_in_use = in_use > 0 ? static_cast<::size_t>(in_use) : 0;
+			stats.peak_bytes_in_use = peak > 0 ? static_cast<::size_t>(peak) : 0;
+			return stats;
+		}
+
+		static void reset() {
+			__state& state = __instance();
+			::std::lock_guard<::std::mutex> guard(state.lock);
+			long long in_use, peak_bound;
+			state.baseline = __total(state, in_use, peak_bound);
+			state.peak.store(in_use, ::std::memory_order_relaxed);
+			// 与所属线程的写入竞争时，至多使峰值偏大
+			for (__tracking_counters* counters = state.threads; counters != nullptr; counters = counters->next) {
+				counters->pending_peak.store(counters->pending.load(::std::memory_order_relaxed), ::std::memory_order_relaxed);
+			}
+		}
+	};
+	__INNER_END
+
+	/**
+	 * @brief (non-standard feature) returns the allocation statistics of all tracking_allocator with the tag
+	 * @brief （非标准内容）返回所有以 Tag 为标签的 tracking_allocator 的分配统计
+	*/
+	template <typename Tag>
+	tracking_stats get_tracking_stats() {
+		return __INNER_NAMESPACE::__tracking_registry<Tag>::snapshot();
+	}
+
+	/**
+	 * @brief (non-standard feature) restarts the statistics of the tag, the bytes in use are kept
+	 * @brief （非标准内容）重新开始统计 Tag 的分配，当前仍在使用的字节数保留
+	*/
+	template <typename Tag>
+	void reset_tracking_stats() {
+		__INNER_NAMESPACE::__tracking_registry<Tag>::reset();
+	}
+
+	/**
+	 * @brief (non-standard feature) allocator adaptor recording the allocations of Alloc under the tag
+	 * @brief （非标准内容）以 Tag 为标签记录 Alloc 的分配次数、字节数、峰值与尺寸直方图的分配器适配器
+	 * @tparam Alloc 被包装的分配器
+	 * @tparam Tag 统计所归属的标签类型，通常为标识调用位置或容器用途的空类型
+	 *
+	 * @note
+	 * 记录只修改线程私有的计数，没有锁；净字节数每变化 64 KiB 才对全局计数做一次原子加，可以在生产环境中常开
+	 * 以 get_tracking_stats<Tag>() 读取统计，读取时合并各线程的计数
+	 * rebind 后的分配器仍记录在同一标签下，因此容器结点的分配也会被统计
+	*/
+	template <typename Alloc, typename Tag = void>
+	class tracking_allocator {
+	private:
+		using __traits = allocator_traits<Alloc>;
+		using __registry = __INNER_NAMESPACE::__tracking_registry<Tag>;
+
+		Alloc __alloc;
+
+		template <typename, typename>
+		friend class tracking_allocator;
+
+	public:
+		using value_type = typename __traits::value_type;
+		using pointer = typename __traits::pointer;
+		using const_pointer = typename __traits::const_pointer;
+		using void_pointer = typename __traits::void_pointer;
+		using const_void_pointer = typename __traits::const_void_pointer;
+		using size_type = typename __traits::size_type;
+		using difference_type = typename __traits::difference_type;
+
+		template <typename OtherValueT>
+		struct rebind { using other = tracking_allocator<typename __traits::template rebind_alloc<OtherValueT>, Tag>; };
+
+		using propagate_on_container_copy_assignment = typename __traits::propagate_on_container_copy_assignment;
+		using propagate_on_container_move_assignment = typename __traits::propagate_on_container_move_assignment;
+		using propagate_on_container_swap = typename __traits::propagate_on_container_swap;
+		using is_always_equal = typename __traits::is_always_equal;
+
+		tracking_allocator() = default;
+
+		tracking_allocator(const Alloc& alloc) noexcept: __alloc(alloc) {}
+
+		template <typename OtherAlloc>
+		tracking_allocator(const tracking_allocator<OtherAlloc, Tag>& other) noexcept: __alloc(other.__alloc) {}
+
+		/**
+		 * @brief returns the wrapped allocator
+		 * @brief 返回被包装的分配器
+		*/
+		const Alloc& upstream() const noexcept {
+			return __alloc;
+		}
+
+		size_type max_size() const noexcept {
+			return __traits::max_size(__alloc);
+		}
+
+		__NODISCARD pointer allocate(size_type n) {
+			pointer result = __traits::allocate(__alloc, n);
+			__registry::record_allocate(n * sizeof(value_type));
+			return result;
+		}
+
+		void deallocate(pointer ptr, size_type n) {
+			__registry::record_deallocate(n * sizeof(value_type));
+			__traits::deallocate(__alloc, ptr, n);
+		}
+
+		template <typename T, typename... Args>
+		void construct(T* ptr, Args&&... args) {
+			__traits::construct(__alloc, ptr, __MY_NAMESPACE::forward<Args>(args)...);
+		}
+
+		template <typename T>
+		void destroy(T* ptr) {
+			__traits::destroy(__alloc, ptr);
+		}
+
+		tracking_allocator select_on_container_copy_construction() const {
+			return tracking_allocator(__traits::select_on_container_copy_construction(__alloc));
+		}
+	};
+
+	/**
+	 * @brief compares two tracking_allocator instances
+	 * @return true if the wrapped allocators are equal
+	*/
+	template <typename Alloc1, typename Alloc2, typename Tag>
+	bool operator==(const tracking_allocator<Alloc1, Tag>& lhs, const tracking_allocator<Alloc2, Tag>& rhs) noexcept {
+		return lhs.upstream() == rhs.upstream();
+	}
+
+	#if !__HAS_CPP20
+	/**
+	 * @brief compares two tracking_allocator instances
+	 * @return !(lhs == rhs)
+	*/
+	template <typename Alloc1, typename Alloc2, typename Tag>
+	bool operator!=(const tracking_allocator<Alloc1, Tag>& lhs, const tracking_allocator<Alloc2, Tag>& rhs) noexcept {
+		return !(lhs == rhs);
+	}
+	#endif // !__HAS_CPP20
+
+	#pragma endregion tracking_allocator
+
+	#pragma region inline_arena
+
+	/**
+	 * @brief (non-standard feature) fixed-size buffer owned by the caller, usually placed on the stack
+	 * @brief （非标准内容）由调用方持有（通常位于栈上）的定长缓冲区，按移动指针的方式分配
+	 * @tparam N 缓冲区的字节数
+	 * @tparam Align 每次分配的对齐，须为 2 的幂
+	 *
+	 * @note
+	 * 只有最近一次分配的内存被释放时才真正回收（后进先出），其余的释放在 reset 或 arena 销毁时一并回收
+	 * 不可复制，且必须比所有使用它的分配器与容器存活得更久；不是线程安全的
+	*/
+	template <::size_t N, ::size_t Align = alignof(::max_align_t)>
+	class inline_arena {
+	private:
+		static_assert(Align != 0 && (Align & (Align - 1)) == 0, "Align must be a power of two");
+
+		alignas(Align) unsigned char __buffer[N];
+		unsigned char* __ptr;
+
+		static constexpr ::size_t __round_up(::size_t bytes) noexcept {
+			return (bytes + (Align - 1)) & ~(Align - 1);
+		}
+
+	public:
+		static constexpr ::size_t size = N;
+		static constexpr ::size_t alignment = Align;
+
+		inline_arena() noexcept: __ptr(__buffer) {}
+
+		inline_arena(const inline_arena&) = delete;
+		inline_arena& operator=(const inline_arena&) = delete;
+
+		/**
+		 * @brief allocates bytes bytes from the buffer
+		 * @brief 从缓冲区中分配 bytes 字节，剩余空间不足时返回 nullptr
+		*/
+		void* allocate(::size_t bytes) noexcept {
+			::size_t rounded = __round_up(bytes);
+			if (rounded < bytes || rounded > static_cast<::size_t>(__buffer + N - __ptr)) {
+				return nullptr;
+			}
+			void* result = __ptr;
+			__ptr += rounded;
+			return result;
+		}
+
+		/**
+		 * @brief returns memory obtained from allocate(bytes), reclaimed only if it is the last allocation
+		 * @brief 归还由 allocate(bytes) 得到的内存，只有它是最近一次分配时才回收
+		*/
+		void deallocate(void* ptr, ::size_t bytes) noexcept {
+			unsigned char* p = static_cast<unsigned char*>(ptr);
+			if (p + __round_up(bytes) == __ptr) {
+				__ptr = p;
+			}
+		}
+
+		/**
+		 * @brief extends the last allocation to new_bytes bytes in place
+		 * @brief 将最近一次分配的内存原地扩展为 new_bytes 字节，不是最近一次分配或剩余空间不足时返回 false
+		*/
+		bool expand(void* ptr, ::size_t bytes, ::size_t new_bytes) noexcept {
+			unsigned char* p = static_cast<unsigned char*>(ptr);
+			::size_t rounded = __round_up(new_bytes);
+			if (p + __round_up(bytes) != __ptr || rounded < new_bytes || rounded > static_cast<::size_t>(__buffer + N - p)) {
+				return false;
+			}
+			__ptr = p + rounded;
+			return true;
+		}
+
+		/**
+		 * @brief checks whether ptr points into the buffer
+		 * @brief 检查 ptr 是否指向缓冲区内部
+		*/
+		bool owns(const void* ptr) const noexcept {
+			::std::uintptr_t addr = reinterpret_cast<::std::uintptr_t>(ptr);
+			::std::uintptr_t begin = reinterpret_cast<::std::uintptr_t>(__buffer);
+			return addr >= begin && addr < begin + N;
+		}
+
+		/**
+		 * @brief returns the number of bytes currently used
+		 * @brief 返回已使用的字节数
+		*/
+		::size_t used() const noexcept {
+			return static_cast<::size_t>(__ptr - __buffer);
+		}
+
+		/**
+		 * @brief makes the whole buffer available again, all memory allocated from it must not be used any more
+		 * @brief 回收整个缓冲区，此前分配的内存都不得再使用
+		*/
+		void reset() noexcept {
+			__ptr = __buffer;
+		}
+	};
+
+	/**
+	 * @brief (non-standard feature) allocator serving allocations from an inline_arena, overflowing to allocator
+	 * @brief （非标准内容）从 inline_arena 中分配、空间不足时转而使用 allocator 的分配器
+	 * @tparam ValueT 分配的对象类型
+	 * @tparam N inline_arena 的字节数
+	 * @tparam Align inline_arena 的对齐
+	 *
+	 * @note
+	 * 适合函数内部几乎总能放进几百字节的临时容器：分配不经过堆，也不会产生跨线程的释放
+	 * rebind 后的分配器指向同一个 arena，两个分配器相等当且仅当它们使用同一个 arena
+	*/
+	template <typename ValueT, ::size_t N, ::size_t Align = alignof(::max_align_t)>
+	class inline_allocator {
+	public:
+		using value_type = ValueT;
+		using pointer = ValueT*;
+		using const_pointer = const ValueT*;
+		using reference = ValueT&;
+		using const_reference = const ValueT&;
+		using size_type = ::size_t;
+		using difference_type = ::ptrdiff_t;
+		using arena_type = inline_arena<N, Align>;
+
+		template <typename OtherValueT>
+		struct rebind { using other = inline_allocator<OtherValueT, N, Align>; };
+
+	private:
+		static_assert(alignment_of<ValueT>::value <= Align, "the alignment of ValueT exceeds the alignment of the arena");
+
+		arena_type* __arena;
+
+		template <typename, ::size_t, ::size_t>
+		friend class inline_allocator;
+
+	public:
+		inline_allocator(arena_type& arena) noexcept: __arena(__MY_NAMESPACE::addressof(arena)) {}
+
+		inline_allocator(const inline_allocator& other) noexcept = default;
+
+		template <typename OtherValueT>
+		inline_allocator(const inline_allocator<OtherValueT, N, Align>& other) noexcept: __arena(other.__arena) {}
+
+		inline_allocator& operator=(const inline_allocator&) = delete;
+
+		/**
+		 * @brief returns the arena in use
+		 * @brief 返回所用的 arena
+		*/
+		arena_type& arena() const noexcept {
+			return *__arena;
+		}
+
+		constexpr size_type max_size() const noexcept {
+			return static_cast<size_type>(-1) / sizeof(ValueT);
+		}
+
+		/**
+		 * @brief allocates from the arena, or from allocator if the arena is exhausted
+		 * @brief 优先从 arena 分配，剩余空间不足时由 allocator 分配
+		*/
+		__NODISCARD pointer allocate(size_type n) {
+			if (n <= max_size()) {
+				if (void* result = __arena->allocate(n * sizeof(ValueT))) {
+					return static_cast<pointer>(result);
+				}
+			}
+			return allocator<ValueT>().allocate(n);
+		}
+
+		/**
+		 * @brief deallocates storage to the arena or to allocator, depending on where it came from
+		 * @brief 根据内存的来源归还给 arena 或 allocator
+		*/
+		void deallocate(pointer ptr, size_type n) noexcept {
+			if (__arena->owns(ptr)) {
+				__arena->deallocate(ptr, n * sizeof(ValueT));
+				return;
+			}
+			allocator<ValueT>().deallocate(ptr, n);
+		}
+
+		/**
+		 * @brief (non-standard feature) tries to extend the storage obtained from allocate(n) in place to hold new_n objects
+		 * @brief （非标准内容）尝试原地扩展由 allocate(n) 得到的存储，arena 中最近一次分配的内存可以直接向后扩展
+		*/
+		bool expand(pointer ptr, size_type n, size_type new_n) noexcept {
+			if (__arena->owns(ptr)) {
+				return new_n <= max_size() && __arena->expand(ptr, n * sizeof(ValueT), new_n * sizeof(ValueT));
+			}
+			return allocator<ValueT>().expand(ptr, n, new_n);
+		}
+	};
+
+	/**
+	 * @brief compares two inline_allocator instances
+	 * @return true if they use the same arena
+	*/
+	template <typename ValueT1, typename ValueT2, ::size_t N, ::size_t Align>
+	bool operator==(const inline_allocator<ValueT1, N, Align>& lhs, const inline_allocator<ValueT2, N, Align>& rhs) noexcept {
+		return &lhs.arena() == &rhs.arena();
+	}
+
+	#if !__HAS_CPP20
+	/**
+	 * @brief compares two inline_allocator instances
+	 * @return !(lhs == rhs)
+	*/
+	template <typename ValueT1, typename ValueT2, ::size_t N, ::size_t Align>
+	bool operator!=(const inline_allocator<ValueT1, N, Align>& lhs, const inline_allocator<ValueT2, N, Align>& rhs) noexcept {
+		return !(lhs == rhs);
+	}
+	#endif // !__HAS_CPP20
+
+	#pragma endregion inline_arena
+
+	#pragma region memory_resource
+
+	namespace pmr {
+
+		/**
+		 * @brief an abstract interface for classes that encapsulate memory resources
+		 * @brief 封装内存资源的类的抽象接口
+		*/
+		class memory_resource {
+		public:
+			memory_resource() = default;
+			memory_resource(const memory_resource&) = default;
+			virtual ~memory_resource() = default;
+
+			memory_resource& operator=(const memory_resource&) = default;
+
+			/**
+			 * @brief allocates memory
+			 * @brief 分配至少 bytes 字节、按 alignment 对齐的内存
+			 * @param bytes 需要分配的字节数
+			 * @param alignment 对齐，必须是 2 的幂
+			*/
+			__NODISCARD void* allocate(::size_t bytes, ::size_t alignment = alignof(::max_align_t)) {
+				return do_allocate(bytes, alignment);
+			}
+
+			/**
+			 * @brief deallocates memory
+			 * @brief 归还由 allocate(bytes, alignment) 得到的内存
+			*/
+			void deallocate(void* ptr, ::size_t bytes, ::size_t alignment = alignof(::max_align_t)) {
+				do_deallocate(ptr, bytes, alignment);
+			}
+
+			/**
+			 * @brief compare for equality with another memory_resource
+			 * @brief 判断由本资源分配的内存能否由 other 释放，反之亦然
+			*/
+			bool is_equal(const memory_resource& other) const noexcept {
+				return do_is_equal(other);
+			}
+
+		private:
+			virtual void* do_allocate(::size_t bytes, ::size_t alignment) = 0;
+			virtual void do_deallocate(void* ptr, ::size_t bytes, ::size_t alignment) = 0;
+			virtual bool do_is_equal(const memory_resource& other) const noexcept = 0;
+		};
+
+		/**
+		 * @brief compare two memory_resources
+		 * @return lhs 与 rhs 是同一对象，或 lhs.is_equal(rhs)
+		*/
+		inline bool operator==(const memory_resource& lhs, const memory_resource& rhs) noexcept {
+			return &lhs == &rhs || lhs.is_equal(rhs);
+		}
+
+		#if !__HAS_CPP20
+		/**
+		 * @brief compare two memory_resources
+		 * @return !(lhs == rhs)
+		*/
+		inline bool operator!=(const memory_resource& lhs, const memory_resource& rhs) noexcept {
+			return !(lhs == rhs);
+		}
+		#endif // !__HAS_CPP20
+
+		__INNER_BEGIN
+		class __new_delete_resource final: public memory_resource {
+		private:
+			void* do_allocate(::size_t bytes, ::size_t alignment) override {
+				return __MY_NAMESPACE::__INNER_NAMESPACE::__allocate_bytes(bytes, alignment);
+			}
+
+			void do_deallocate(void* ptr, ::size_t bytes, ::size_t alignment) override {
+				__MY_NAMESPACE::__INNER_NAMESPACE::__deallocate_bytes(ptr, bytes, alignment);
+			}
+
+			bool do_is_equal(const memory_resource& other) const noexcept override {
+				return this == &other;
+			}
+		};
+
+		class __null_memory_resource final: public memory_resource {
+		private:
+			void* do_allocate(::size_t, ::size_t) override {
+				throw ::std::bad_alloc();
+			}
+
+			void do_deallocate(void*, ::size_t, ::size_t) override {}
+
+			bool do_is_equal(const memory_resource& other) const noexcept override {
+				return this == &other;
+			}
+		};
+
+		inline ::size_t __align_up(::size_t value, ::size_t alignment) noexcept {
+			return (value + alignment - 1) & ~(alignment - 1);
+		}
+		__INNER_END
+
+		/**
+		 * @brief returns a static program-wide memory_resource that uses the global operator new and operator delete
+		 * @brief 返回使用全局 operator new 与 operator delete 的程序级内存资源
+		*/
+		inline memory_resource* new_delete_resource() noexcept {
+			static __INNER_NAMESPACE::__new_delete_resource resource;
+			return &resource;
+		}
+
+		/**
+		 * @brief returns a static memory_resource that performs no allocation
+		 * @brief 返回不进行任何分配的内存资源，其 allocate 总是抛出 std::bad_alloc
+		*/
+		inline memory_resource* null_memory_resource() noexcept {
+			static __INNER_NAMESPACE::__null_memory_resource resource;
+			return &resource;
+		}
+
+		__INNER_BEGIN
+		inline ::std::atomic<memory_resource*>& __default_resource() noexcept {
+			static ::std::atomic<memory_resource*> resource(new_delete_resource());
+			return resource;
+		}
+		__INNER_END
+
+		/**
+		 * @brief gets the default memory_resource
+		 * @brief 获取默认内存资源，初始为 new_delete_resource()
+		*/
+		inline memory_resource* get_default_resource() noexcept {
+			return __INNER_NAMESPACE::__default_resource().load(::std::memory_order_acquire);
+		}
+
+		/**
+		 * @brief sets the default memory_resource
+		 * @brief 设置默认内存资源，传入空指针时恢复为 new_delete_resource()
+		 * @return 先前的默认内存资源
+		*/
+		inline memory_resource* set_default_resource(memory_resource* resource) noexcept {
+			if (resource == nullptr) {
+				resource = new_delete_resource();
+			}
+			return __INNER_NAMESPACE::__default_resource().exchange(resource, ::std::memory_order_acq_rel);
+		}
+
+		/**
+		 * @brief an allocator that supports run-time polymorphism based on the memory_resource it is constructed with
+		 * @brief 以构造时给定的 memory_resource 实现运行时多态的分配器
+		 * @tparam ValueT 分配的对象类型
+		*/
+		template <typename ValueT>
+		class polymorphic_allocator {
+		public:
+			using value_type = ValueT;
+			using pointer = ValueT*;
+			using const_pointer = const ValueT*;
+			using reference = ValueT&;
+			using const_reference = const ValueT&;
+			using size_type = ::size_t;
+			using difference_type = ::ptrdiff_t;
+
+		private:
+			memory_resource* __resource;
+
+		public:
+			polymorphic_allocator() noexcept: __resource(get_default_resource()) {}
+
+			polymorphic_allocator(memory_resource* resource) noexcept: __resource(resource) {}
+
+			polymorphic_allocator(const polymorphic_allocator& other) = default;
+
+			template <typename OtherValueT>
+			polymorphic_allocator(const polymorphic_allocator<OtherValueT>& other) noexcept: __resource(other.resource()) {}
+
+			polymorphic_allocator& operator=(const polymorphic_allocator&) = delete;
+
+			/**
+			 * @brief allocates uninitialized storage from the underlying resource
+			 * @param n the number of objects to allocate storage for
+			*/
+			__NODISCARD pointer allocate(size_type n) {
+				if (n > static_cast<size_type>(-1) / sizeof(ValueT)) {
+					throw ::std::bad_array_new_length();
+				}
+				return static_cast<pointer>(__resource->allocate(n * sizeof(ValueT), alignof(ValueT)));
+			}
+
+			/**
+			 * @brief deallocates storage to the underlying resource
+			 * @param ptr pointer obtained from allocate()
+			 * @param n number of objects earlier passed to allocate()
+			*/
+			void deallocate(pointer ptr, size_type n) {
+				__resource->deallocate(ptr, n * sizeof(ValueT), alignof(ValueT));
+			}
+
+			/**
+			 * @brief create a new polymorphic_allocator for use by a container's copy constructor
+			 * @brief 容器被复制时不传播内存资源，副本使用默认内存资源
+			*/
+			polymorphic_allocator select_on_container_copy_construction() const {
+				return polymorphic_allocator();
+			}
+
+			/**
+			 * @brief returns a pointer to the underlying memory resource
+			 * @brief 返回所用的内存资源
+			*/
+			memory_resource* resource() const noexcept {
+				return __resource;
+			}
+		};
+
+		/**
+		 * @brief compares two polymorphic_allocators
+		 * @return *lhs.resource() == *rhs.resource()
+		*/
+		template <typename ValueT1, typename ValueT2>
+		bool operator==(const polymorphic_allocator<ValueT1>& lhs, const polymorphic_allocator<ValueT2>& rhs) noexcept {
+			return *lhs.resource() == *rhs.resource();
+		}
+
+		#if !__HAS_CPP20
+		/**
+		 * @brief compares two polymorphic_allocators
+		 * @return !(lhs == rhs)
+		*/
+		template <typename ValueT1, typename ValueT2>
+		bool operator!=(const polymorphic_allocator<ValueT1>& lhs, const polymorphic_allocator<ValueT2>& rhs) noexcept {
+			return !(lhs == rhs);
+		}
+		#endif // !__HAS_CPP20
+
+		/**
+		 * @brief a special-purpose memory_resource that releases the allocated memory only when the resource is destroyed
+		 * @brief 只在资源被销毁（或调用 release）时才释放内存的专用内存资源
+		 *
+		 * @note
+		 * 分配只是在当前缓冲区中移动指针；缓冲区耗尽时从上游资源取得一块更大的缓冲区（每次翻倍）
+		 * deallocate 不做任何事，所有内存在 release 或析构时一次性归还上游
+		 * bytes_allocated 与 peak_bytes_allocated 是非标准内容，用于估计合适的初始缓冲区大小
+		*/
+		class monotonic_buffer_resource: public memory_resource {
+		private:
+			struct __chunk_header {
+				__chunk_header* next;
+				::size_t bytes;
+				::size_t alignment;
+			};
+
+			static constexpr ::size_t __default_initial_size = 1024;
+
+			memory_resource* __upstream;
+			void* __initial_buffer;
+			::size_t __initial_size;
+
+			char* __current;
+			::size_t __space;
+			::size_t __next_chunk_size;
+			__chunk_header* __chunks;
+
+			::size_t __bytes_allocated;
+			::size_t __peak_bytes;
+
+			void* __try_bump(::size_t bytes, ::size_t alignment) noexcept {
+				if (__current == nullptr) {
+					return nullptr;
+				}
+				::std::uintptr_t addr = reinterpret_cast<::std::uintptr_t>(__current);
+				::size_t padding = __INNER_NAMESPACE::__align_up(addr, alignment) - addr;
+				if (padding > __space || bytes > __space - padding) {
+					return nullptr;
+				}
+				char* result = __current + padding;
+				__current = result + bytes;
+				__space -= padding + bytes;
+				return result;
+			}
+
+			void __new_chunk(::size_t bytes, ::size_t alignment) {
+				::size_t chunk_alignment = alignment > alignof(__chunk_header) ? alignment : alignof(__chunk_header);
+				::size_t needed = sizeof(__chunk_header) + alignment + bytes;
+				::size_t chunk_size = __next_chunk_size > needed ? __next_chunk_size : needed;
+
+				__chunk_header* chunk = static_cast<__chunk_header*>(__upstream->allocate(chunk_size, chunk_alignment));
+				chunk->next = __chunks;
+				chunk->bytes = chunk_size;
+				chunk->alignment = chunk_alignment;
+				__chunks = chunk;
+
+				__current = reinterpret_cast<char*>(chunk + 1);
+				__space = chunk_size - sizeof(__chunk_header);
+				if (chunk_size <= static_cast<::size_t>(-1) / 2) {
+					__next_chunk_size = chunk_size * 2;
+				}
+			}
+
+		public:
+			monotonic_buffer_resource(): monotonic_buffer_resource(get_default_resource()) {}
+
+			explicit monotonic_buffer_resource(memory_resource* upstream)
+				: monotonic_buffer_resource(__default_initial_size, upstream) {}
+
+			explicit monotonic_buffer_resource(::size_t initial_size)
+				: monotonic_buffer_resource(initial_size, get_default_resource()) {}
+
+			monotonic_buffer_resource(::size_t initial_size, memory_resource* upstream)
+				: __upstream(upstream), __initial_buffer(nullptr), __initial_size(0),
+				__current(nullptr), __space(0), __next_chunk_size(initial_size > 0 ? initial_size : 1), __chunks(nullptr),
+				__bytes_allocated(0), __peak_bytes(0) {}
+
+			monotonic_buffer_resource(void* buffer, ::size_t buffer_size)
+				: monotonic_buffer_resource(buffer, buffer_size, get_default_resource()) {}
+
+			monotonic_buffer_resource(void* buffer, ::size_t buffer_size, memory_resource* upstream)
+				: __upstream(upstream), __initial_buffer(buffer), __initial_size(buffer_size),
+				__current(static_cast<char*>(buffer)), __space(buffer_size),
+				__next_chunk_size(buffer_size > 0 ? buffer_size * 2 : __default_initial_size), __chunks(nullptr),
+				__bytes_allocated(0), __peak_bytes(0) {}
+
+			monotonic_buffer_resource(const monotonic_buffer_resource&) = delete;
+			monotonic_buffer_resource& operator=(const monotonic_buffer_resource&) = delete;
+
+			~monotonic_buffer_resource() override {
+				release();
+			}
+
+			/**
+			 * @brief release all allocated memory
+			 * @brief 将所有从上游取得的内存归还上游，并重新从初始缓冲区开始分配
+			*/
+			void release() noexcept {
+				while (__chunks != nullptr) {
+					__chunk_header* next = __chunks->next;
+					__upstream->deallocate(__chunks, __chunks->bytes, __chunks->alignment);
+					__chunks = next;
+				}
+				__current = static_cast<char*>(__initial_buffer);
+				__space = __initial_size;
+				__bytes_allocated = 0;
+			}
+
+			/**
+			 * @brief returns a pointer to the upstream memory resource
+			 * @brief 返回上游内存资源
+			*/
+			memory_resource* upstream_resource() const noexcept {
+				return __upstream;
+			}
+
+			/**
+			 * @brief (non-standard feature) bytes handed out since construction or the last release()
+			 * @brief （非标准内容）自构造或上次 release 以来分配出的字节数
+			*/
+			::size_t bytes_allocated() const noexcept {
+				return __bytes_allocated;
+			}
+
+			/**
+			 * @brief (non-standard feature) the largest value bytes_allocated() has ever reached
+			 * @brief （非标准内容）bytes_allocated() 曾达到的最大值
+			*/
+			::size_t peak_bytes_allocated() const noexcept {
+				return __peak_bytes;
+			}
+
+		protected:
+			void* do_allocate(::size_t bytes, ::size_t alignment) override {
+				void* result = __try_bump(bytes, alignment);
+				if (result == nullptr) {
+					__new_chunk(bytes, alignment);
+					result = __try_bump(bytes, alignment);
+				}
+				__bytes_allocated += bytes;
+				if (__bytes_allocated > __peak_bytes) {
+					__peak_bytes = __bytes_allocated;
+				}
+				return result;
+			}
+
+			void do_deallocate(void*, ::size_t, ::size_t) override {}
+
+			bool do_is_equal(const memory_resource& other) const noexcept override {
+				return this == &other;
+			}
+		};
+
+		/**
+		 * @brief a set of constructor options for pool resources
+		 * @brief 池资源的构造选项，值为 0 时使用默认值
+		*/
+		struct pool_options {
+			/** @brief 每次向上游补充时，一块内存中最多包含的块数 */
+			::size_t max_blocks_per_chunk = 0;
+			/** @brief 由池提供的最大块尺寸，更大的请求直接交给上游 */
+			::size_t largest_required_pool_block = 0;
+		};
+
+		__INNER_BEGIN
+		/**
+		 * @brief (non-standard feature) the common implementation of the pool resources
+		 * @brief （非标准内容）池资源的公共实现，本身不加锁
+		 *
+		 * @note
+		 * 以 2 的幂划分块尺寸（8 字节到 32 KiB），每个尺寸拥有一条空闲链表
+		 * 空闲链表为空时从上游取得一块内存并切分，块数从约 4 KiB 对应的数量开始逐次翻倍，直到 max_blocks_per_chunk
+		 * 超过 largest_required_pool_block 或需要超额对齐的请求直接交给上游，并记录在链表中以便 release
+		*/
+		class __pool_resource_impl {
+		private:
+			struct __chunk_header {
+				__chunk_header* next;
+				::size_t bytes;
+			};
+
+			struct __oversize_header {
+				__oversize_header* prev;
+				__oversize_header* next;
+				::size_t bytes;
+				::size_t alignment;
+			};
+
+			struct __pool {
+				__MY_NAMESPACE::__INNER_NAMESPACE::__pool_block* free;
+				::size_t next_blocks;
+			};
+
+			static constexpr ::size_t __min_block = sizeof(void*) > 8 ? sizeof(void*) : 8;
+			static constexpr ::size_t __max_pool_count = 13;
+			static constexpr ::size_t __max_block = __min_block << (__max_pool_count - 1);
+			static constexpr ::size_t __default_largest_block = 4096;
+			static constexpr ::size_t __default_max_blocks = 1024;
+			static constexpr ::size_t __chunk_alignment = __MY_NAMESPACE::__INNER_NAMESPACE::__default_new_alignment;
+			static constexpr ::size_t __chunk_header_size = (sizeof(__chunk_header) + __chunk_alignment - 1) & ~(__chunk_alignment - 1);
+
+			memory_resource* __upstream;
+			pool_options __options;
+			__pool __pools[__max_pool_count];
+			__chunk_header* __chunks;
+			__oversize_header* __oversized;
+
+			::size_t __bytes_allocated;
+			::size_t __peak_bytes;
+
+			static ::size_t __oversize_offset(::size_t alignment) noexcept {
+				return __align_up(sizeof(__oversize_header), alignment);
+			}
+
+			void __reset_pools() noexcept {
+				for (::size_t i = 0; i < __max_pool_count; ++i) {
+					::size_t blocks = __MY_NAMESPACE::__INNER_NAMESPACE::__pool_chunk_bytes / (__min_block << i);
+					if (blocks == 0) {
+						blocks = 1;
+					}
+					__pools[i].free = nullptr;
+					__pools[i].next_blocks = blocks < __options.max_blocks_per_chunk ? blocks : __options.max_blocks_per_chunk;
+				}
+			}
+
+			void __refill(__pool& pool, ::size_t block_bytes) {
+				using __MY_NAMESPACE::__INNER_NAMESPACE::__pool_block;
+
+				::size_t blocks = pool.next_blocks;
+				::size_t chunk_bytes = __chunk_header_size + blocks * block_bytes;
+				char* raw = static_cast<char*>(__upstream->allocate(chunk_bytes, __chunk_alignment));
+				__chunk_header* chunk = reinterpret_cast<__chunk_header*>(raw);
+				chunk->next = __chunks;
+				chunk->bytes = chunk_bytes;
+				__chunks = chunk;
+
+				char* first = raw + __chunk_header_size;
+				for (::size_t i = 0; i < blocks; ++i) {
+					__pool_block* block = reinterpret_cast<__pool_block*>(first + i * block_bytes);
+					block->next = pool.free;
+					pool.free = block;
+				}
+
+				if (blocks * 2 <= __options.max_blocks_per_chunk) {
+					pool.next_blocks = blocks * 2;
+				}
+				else {
+					pool.next_blocks = __options.max_blocks_per_chunk;
+				}
+			}
+
+			void __account(::size_t bytes) noexcept {
+				__bytes_allocated += bytes;
+				if (__bytes_allocated > __peak_bytes) {
+					__peak_bytes = __bytes_allocated;
+				}
+			}
+
+		public:
+			__pool_resource_impl(const pool_options& options, memory_resource* upstream)
+				: __upstream(upstream), __options(options), __chunks(nullptr), __oversized(nullptr),
+				__bytes_allocated(0), __peak_bytes(0) {
+				if (__options.max_blocks_per_chunk == 0) {
+					__options.max_blocks_per_chunk = __default_max_blocks;
+				}
+				if (__options.largest_required_pool_block == 0) {
+					__options.largest_required_pool_block = __default_largest_block;
+				}
+				else if (__options.largest_required_pool_block > __max_block) {
+					__options.largest_required_pool_block = __max_block;
+				}
+				__reset_pools();
+			}
+
+			__pool_resource_impl(const __pool_resource_impl&) = delete;
+			__pool_resource_impl& operator=(const __pool_resource_impl&) = delete;
+
+			~__pool_resource_impl() {
+				release();
+			}
+
+			void release() noexcept {
+				while (__chunks != nullptr) {
+					__chunk_header* next = __chunks->next;
+					__upstream->deallocate(__chunks, __chunks->bytes, __chunk_alignment);
+					__chunks = next;
+				}
+				while (__oversized != nullptr) {
+					__oversize_header* next = __oversized->next;
+					::size_t offset = __oversize_offset(__oversized->alignment);
+					__upstream->deallocate(__oversized, offset + __oversized->bytes, __oversized->alignment);
+					__oversized = next;
+				}
+				__reset_pools();
+				__bytes_allocated = 0;
+			}
+
+			memory_resource* upstream_resource() const noexcept {
+				return __upstream;
+			}
+
+			pool_options options() const noexcept {
+				return __options;
+			}
+
+			::size_t bytes_allocated() const noexcept {
+				return __bytes_allocated;
+			}
+
+			::size_t peak_bytes_allocated() const noexcept {
+				return __peak_bytes;
+			}
+
+			void* allocate(::size_t bytes, ::size_t alignment) {
+				::size_t block_bytes = __min_block;
+				::size_t index = 0;
+				while (block_bytes < bytes || block_bytes < alignment) {
+					block_bytes <<= 1;
+					++index;
+					if (block_bytes > __options.largest_required_pool_block) {
+						break;
+					}
+				}
+
+				if (block_bytes > __options.largest_required_pool_block || alignment > __chunk_alignment) {
+					// 大块请求：在用户内存之前放置链表结点
+					::size_t header_alignment = alignment > alignof(__oversize_header) ? alignment : alignof(__oversize_header);
+					::size_t offset = __oversize_offset(header_alignment);
+					char* raw = static_cast<char*>(__upstream->allocate(offset + bytes, header_alignment));
+					__oversize_header* header = reinterpret_cast<__oversize_header*>(raw);
+					header->prev = nullptr;
+					header->next = __oversized;
+					header->bytes = bytes;
+					header->alignment = header_alignment;
+					if (__oversized != nullptr) {
+						__oversized->prev = header;
+					}
+					__oversized = header;
+					__account(bytes);
+					return raw + offset;
+				}
+
+				__pool& pool = __pools[index];
+				if (pool.free == nullptr) {
+					__refill(pool, block_bytes);
+				}
+				void* result = pool.free;
+				pool.free = pool.free->next;
+				__account(bytes);
+				return result;
+			}
+
+			void deallocate(void* ptr, ::size_t bytes, ::size_t alignment) noexcept {
+				using __MY_NAMESPACE::__INNER_NAMESPACE::__pool_block;
+
+				::size_t block_bytes = __min_block;
+				::size_t index = 0;
+				while (block_bytes < bytes || block_bytes < alignment) {
+					block_bytes <<= 1;
+					++index;
+					if (block_bytes > __options.largest_required_pool_block) {
+						break;
+					}
+				}
+				__bytes_allocated -= bytes;
+
+				if (block_bytes > __options.largest_required_pool_block || alignment > __chunk_alignment) {
+					::size_t header_alignment = alignment > alignof(__oversize_header) ? alignment : alignof(__oversize_header);
+					::size_t offset = __oversize_offset(header_alignment);
+					__oversize_header* header = reinterpret_cast<__oversize_header*>(static_cast<char*>(ptr) - offset);
+					if (header->prev != nullptr) {
+						header->prev->next = header->next;
+					}
+					else {
+						__oversized = header->next;
+					}
+					if (header->next != nullptr) {
+						header->next->prev = header->prev;
+					}
+					__upstream->deallocate(header, offset + bytes, header_alignment);
+					return;
+				}
+
+				__pool_block* block = static_cast<__pool_block*>(ptr);
+				block->next = __pools[index].free;
+				__pools[index].free = block;
+			}
+		};
+		__INNER_END
+
+		/**
+		 * @brief a thread-unsafe memory_resource for managing allocations in pools of different block sizes
+		 * @brief 以不同块尺寸的池管理分配的内存资源，非线程安全
+		 *
+		 * @note
+		 * 释放的块回到对应尺寸的空闲链表并被复用，所有内存在 release 或析构时一次性归还上游
+		 * bytes_allocated 与 peak_bytes_allocated 是非标准内容，分别表示当前与历史最多的未释放字节数
+		*/
+		class unsynchronized_pool_resource: public memory_resource {
+		private:
+			__INNER_NAMESPACE::__pool_resource_impl __impl;
+
+		public:
+			unsynchronized_pool_resource(): unsynchronized_pool_resource(pool_options(), get_default_resource()) {}
+
+			explicit unsynchronized_pool_resource(memory_resource* upstream)
+				: unsynchronized_pool_resource(pool_options(), upstream) {}
+
+			explicit unsynchronized_pool_resource(const pool_options& options)
+				: unsynchronized_pool_resource(options, get_default_resource()) {}
+
+			unsynchronized_pool_resource(const pool_options& options, memory_resource* upstream)
+				: __impl(options, upstream) {}
+
+			unsynchronized_pool_resource(const unsynchronized_pool_resource&) = delete;
+			unsynchronized_pool_resource& operator=(const unsynchronized_pool_resource&) = delete;
+
+			~unsynchronized_pool_resource() override = default;
+
+			/**
+			 * @brief release all allocated memory
+			 * @brief 将所有内存归还上游
+			*/
+			void release() noexcept {
+				__impl.release();
+			}
+
+			/**
+			 * @brief returns a pointer to the upstream memory resource
+			 * @brief 返回上游内存资源
+			*/
+			memory_resource* upstream_resource() const noexcept {
+				return __impl.upstream_resource();
+			}
+
+			/**
+			 * @brief returns the options that control the pooling behavior of this resource
+			 * @brief 返回实际生效的池选项
+			*/
+			pool_options options() const noexcept {
+				return __impl.options();
+			}
+
+			/**
+			 * @brief (non-standard feature) bytes currently allocated and not yet deallocated
+			 * @brief （非标准内容）当前已分配且尚未释放的字节数
+			*/
+			::size_t bytes_allocated() const noexcept {
+				return __impl.bytes_allocated();
+			}
+
+			/**
+			 * @brief (non-standard feature) the largest value bytes_allocated() has ever reached
+			 * @brief （非标准内容）bytes_allocated() 曾达到的最大值
+			*/
+			::size_t peak_bytes_allocated() const noexcept {
+				return __impl.peak_bytes_allocated();
+			}
+
+		protected:
+			void* do_allocate(::size_t bytes, ::size_t alignment) override {
+				return __impl.allocate(bytes, alignment);
+			}
+
+			void do_deallocate(void* ptr, ::size_t bytes, ::size_t alignment) override {
+				__impl.deallocate(ptr, bytes, alignment);
+			}
+
+			bool do_is_equal(const memory_resource& other) const noexcept override {
+				return this == &other;
+			}
+		};
+
+		/**
+		 * @brief a thread-safe memory_resource for managing allocations in pools of different block sizes
+		 * @brief 以不同块尺寸的池管理分配的内存资源，线程安全
+		 *
+		 * @note
+		 * 与 unsynchronized_pool_resource 相同，但每次操作都持有一把互斥锁
+		*/
+		class synchronized_pool_resource: public memory_resource {
+		private:
+			__INNER_NAMESPACE::__pool_resource_impl __impl;
+			mutable ::std::mutex __lock;
+
+		public:
+			synchronized_pool_resource(): synchronized_pool_resource(pool_options(), get_default_resource()) {}
+
+			explicit synchronized_pool_resource(memory_resource* upstream)
+				: synchronized_pool_resource(pool_options(), upstream) {}
+
+			explicit synchronized_pool_resource(const pool_options& options)
+				: synchronized_pool_resource(options, get_default_resource()) {}
+
+			synchronized_pool_resource(const pool_options& options, memory_resource* upstream)
+				: __impl(options, upstream) {}
+
+			synchronized_pool_resource(const synchronized_pool_resource&) = delete;
+			synchronized_pool_resource& operator=(const synchronized_pool_resource&) = delete;
+
+			~synchronized_pool_resource() override = default;
+
+			/**
+			 * @brief release all allocated memory
+			 * @brief 将所有内存归还上游
+			*/
+			void release() noexcept {
+				::std::lock_guard<::std::mutex> guard(__lock);
+				__impl.release();
+			}
+
+			/**
+			 * @brief returns a pointer to the upstream memory resource
+			 * @brief 返回上游内存资源
+			*/
+			memory_resource* upstream_resource() const noexcept {
+				return __impl.upstream_resource();
+			}
+
+			/**
+			 * @brief returns the options that control the pooling behavior of this resource
+			 * @brief 返回实际生效的池选项
+			*/
+			pool_options options() const noexcept {
+				return __impl.options();
+			}
+
+			/**
+			 * @brief (non-standard feature) bytes currently allocated and not yet deallocated
+			 * @brief （非标准内容）当前已分配且尚未释放的字节数
+			*/
+			::size_t bytes_allocated() const noexcept {
+				::std::lock_guard<::std::mutex> guard(__lock);
+				return __impl.bytes_allocated();
+			}
+
+			/**
+			 * @brief (non-standard feature) the largest value bytes_allocated() has ever reached
+			 * @brief （非标准内容）bytes_allocated() 曾达到的最大值
+			*/
+			::size_t peak_bytes_allocated() const noexcept {
+				::std::lock_guard<::std::mutex> guard(__lock);
+				return __impl.peak_bytes_allocated();
+			}
+
+		protected:
+			void* do_allocate(::size_t bytes, ::size_t alignment) override {
+				::std::lock_guard<::std::mutex> guard(__lock);
+				return __impl.allocate(bytes, alignment);
+			}
+
+			void do_deallocate(void* ptr, ::size_t bytes, ::size_t alignment) override {
+				::std::lock_guard<::std::mutex> guard(__lock);
+				__impl.deallocate(ptr, bytes, alignment);
+			}
+
+			bool do_is_equal(const memory_resource& other) const noexcept override {
+				return this == &other;
+			}
+		};
+
+	} // namespace __MY_NAMESPACE::pmr
+
+	#pragma endregion memory_resource
+
+	#pragma region default_delete
+
+	/**
+	 * @brief default deleter for unique_ptr
+	 * @brief unique_ptr 的默认删除器，以 delete 销毁对象
+	 * @tparam T 被删除对象的类型
+	*/
+	template <typename T>
+	struct default_delete {
+		constexpr default_delete() noexcept = default;
+
+		template <typename U, typename = typename enable_if<is_convertible<U*, T*>::value>::type>
+		__CONSTEXPR20 default_delete(const default_delete<U>&) noexcept {}
+
+		__CONSTEXPR20 void operator()(T* ptr) const noexcept {
+			static_assert(sizeof(T) > 0, "can't delete an incomplete type");
+			delete ptr;
+		}
+	};
+
+	/**
+	 * @brief default deleter for unique_ptr, array version
+	 * @brief unique_ptr 的默认删除器，以 delete[] 销毁数组
+	 * @tparam T 数组元素的类型
+	*/
+	template <typename T>
+	struct default_delete<T[]> {
+		constexpr default_delete() noexcept = default;
+
+		template <typename U, typename = typename enable_if<is_convertible<U(*)[], T(*)[]>::value>::type>
+		__CONSTEXPR20 default_delete(const default_delete<U[]>&) noexcept {}
+
+		template <typename U, typename = typename enable_if<is_convertible<U(*)[], T(*)[]>::value>::type>
+		__CONSTEXPR20 void operator()(U* ptr) const noexcept {
+			static_assert(sizeof(U) > 0, "can't delete an incomplete type");
+			delete[] ptr;
+		}
+	};
+
+	#pragma endregion default_delete
+
+	#pragma region unique_ptr
+
+	__INNER_BEGIN
+	// 删除器提供 pointer 时使用之，否则使用 T*
+	template <typename T, typename Deleter, typename = void>
+	struct __unique_ptr_pointer { using type = T*; };
+	template <typename T, typename Deleter>
+	struct __unique_ptr_pointer<T, Deleter, __void_t<typename remove_reference<Deleter>::type::pointer>> {
+		using type = typename remove_reference<Deleter>::type::pointer;
+	};
+	__INNER_END
+
+	/**
+	 * @brief smart pointer with unique object ownership semantics
+	 * @brief 独占所指对象所有权的智能指针，离开作用域时以删除器销毁对象
+	 * @tparam T 所管理对象的类型
+	 * @tparam Deleter 删除器类型
+	 *
+	 * @note
+	 * 空且非 final 的删除器（如 default_delete）以空基类优化存储，此时 sizeof(unique_ptr<T>) == sizeof(T*)
+	*/
+	template <typename T, typename Deleter = default_delete<T>>
+	class unique_ptr {
+	public:
+		using pointer = typename __INNER_NAMESPACE::__unique_ptr_pointer<T, Deleter>::type;
+		using element_type = T;
+		using deleter_type = Deleter;
+
+	private:
+		compressed_pair<pointer, Deleter> __storage;
+
+		template <typename, typename>
+		friend class unique_ptr;
+
+	public:
+		template <typename D = Deleter, typename = typename enable_if<
+			!is_pointer<D>::value && is_default_constructible<D>::value
+		>::type>
+		constexpr unique_ptr() noexcept: __storage() {}
+
+		template <typename D = Deleter, typename = typename enable_if<
+			!is_pointer<D>::value && is_default_constructible<D>::value
+		>::type>
+		constexpr unique_ptr(::std::nullptr_t) noexcept: __storage() {}
+
+		template <typename D = Deleter, typename = typename enable_if<
+			!is_pointer<D>::value && is_default_constructible<D>::value
+		>::type>
+		__CONSTEXPR20 explicit unique_ptr(pointer ptr) noexcept: __storage(ptr, D()) {}
+
+		template <typename D = Deleter, typename = typename enable_if<
+			!is_reference<D>::value
+		>::type>
+		__CONSTEXPR20 unique_ptr(pointer ptr, const Deleter& deleter) noexcept: __storage(ptr, deleter) {}
+
+		template <typename D = Deleter, typename = typename enable_if<
+			!is_reference<D>::value
+		>::type>
+		__CONSTEXPR20 unique_ptr(pointer ptr, Deleter&& deleter) noexcept: __storage(ptr, __MY_NAMESPACE::move(deleter)) {}
+
+		// 删除器为引用类型时，只接受左值
+		template <typename D = Deleter, typename = typename enable_if<
+			is_reference<D>::value
+		>::type>
+		__CONSTEXPR20 unique_ptr(pointer ptr, D deleter) noexcept: __storage(ptr, deleter) {}
+
+		__CONSTEXPR20 unique_ptr(unique_ptr&& other) noexcept
+			: __storage(other.release(), __MY_NAMESPACE::forward<Deleter>(other.get_deleter())) {}
+
+		template <typename U, typename E, typename = typename enable_if<
+			!is_array<U>::value &&
+			is_convertible<typename unique_ptr<U, E>::pointer, pointer>::value &&
+			(is_reference<Deleter>::value ? is_same<E, Deleter>::value : is_convertible<E, Deleter>::value)
+		>::type>
+		__CONSTEXPR20 unique_ptr(unique_ptr<U, E>&& other) noexcept
+			: __storage(other.release(), __MY_NAMESPACE::forward<E>(other.get_deleter())) {}
+
+		unique_ptr(const unique_ptr&) = delete;
+		unique_ptr& operator=(const unique_ptr&) = delete;
+
+		__CONSTEXPR20 ~unique_ptr() noexcept {
+			if (__storage.first() != pointer()) {
+				__storage.second()(__storage.first());
+			}
+		}
+
+		__CONSTEXPR20 unique_ptr& operator=(unique_ptr&& other) noexcept {
+			reset(other.release());
+			__storage.second() = __MY_NAMESPACE::forward<Deleter>(other.get_deleter());
+			return *this;
+		}
+
+		template <typename U, typename E, typename = typename enable_if<
+			!is_array<U>::value &&
+			is_convertible<typename unique_ptr<U, E>::pointer, pointer>::value &&
+			is_assignable<Deleter&, E&&>::value
+		>::type>
+		__CONSTEXPR20 unique_ptr& operator=(unique_ptr<U, E>&& other) noexcept {
+			reset(other.release());
+			__storage.second() = __MY_NAMESPACE::forward<E>(other.get_deleter());
+			return *this;
+		}
+
+		__CONSTEXPR20 unique_ptr& operator=(::std::nullptr_t) noexcept {
+			reset();
+			return *this;
+		}
+
+		/**
+		 * @brief returns a pointer to the managed object and releases the ownership
+		 * @brief 放弃所管理对象的所有权并返回其指针
+		*/
+		__CONSTEXPR20 pointer release() noexcept {
+			pointer ptr = __storage.first();
+			__storage.first() = pointer();
+			return ptr;
+		}
+
+		/**
+		 * @brief replaces the managed object
+		 * @brief 替换所管理的对象，原对象（若存在）以删除器销毁
+		*/
+		__CONSTEXPR20 void reset(pointer ptr = pointer()) noexcept {
+			pointer old = __storage.first();
+			__storage.first() = ptr;
+			if (old != pointer()) {
+				__storage.second()(old);
+			}
+		}
+
+		/**
+		 * @brief swaps the managed objects
+		 * @brief 交换所管理的对象与删除器
+		*/
+		__CONSTEXPR20 void swap(unique_ptr& other) noexcept {
+			__storage.swap(other.__storage);
+		}
+
+		/**
+		 * @brief returns a pointer to the managed object
+		 * @brief 返回所管理对象的指针
+		*/
+		__NODISCARD constexpr pointer get() const noexcept {
+			return __storage.first();
+		}
+
+		/**
+		 * @brief returns the deleter that is used for destruction of the managed object
+		 * @brief 返回所用的删除器
+		*/
+		__NODISCARD __CONSTEXPR14 Deleter& get_deleter() noexcept {
+			return __storage.second();
+		}
+
+		__NODISCARD constexpr const Deleter& get_deleter() const noexcept {
+			return __storage.second();
+		}
+
+		/**
+		 * @brief checks if there is an associated managed object
+		 * @brief 检查是否管理着对象
+		*/
+		constexpr explicit operator bool() const noexcept {
+			return __storage.first() != pointer();
+		}
+
+		/**
+		 * @brief dereferences pointer to the managed object
+		 * @brief 解引用所管理对象的指针
+		*/
+		__CONSTEXPR20 typename add_lvalue_reference<T>::type operator*() const noexcept(noexcept(*declval<pointer>())) {
+			return *__storage.first();
+		}
+
+		__CONSTEXPR20 pointer operator->() const noexcept {
+			return __storage.first();
+		}
+	};
+
+	/**
+	 * @brief smart pointer with unique object ownership semantics, array version
+	 * @brief 独占所指数组所有权的智能指针
+	 * @tparam T 数组元素的类型
+	 * @tparam Deleter 删除器类型
+	*/
+	template <typename T, typename Deleter>
+	class unique_ptr<T[], Deleter> {
+	public:
+		using pointer = typename __INNER_NAMESPACE::__unique_ptr_pointer<T, Deleter>::type;
+		using element_type = T;
+		using deleter_type = Deleter;
+
+	private:
+		compressed_pair<pointer, Deleter> __storage;
+
+		template <typename, typename>
+		friend class unique_ptr;
+
+		// 只接受 pointer 本身，或在 pointer 为 T* 时可以限定转换为 T* 的数组指针
+		template <typename U>
+		struct __is_acceptable_pointer: integral_constant<
+			bool,
+			is_same<U, pointer>::value ||
+			is_same<U, ::std::nullptr_t>::value ||
+			(is_same<pointer, element_type*>::value && is_pointer<U>::value &&
+				is_convertible<typename remove_pointer<U>::type(*)[], element_type(*)[]>::value)
+		> {};
+
+	public:
+		template <typename D = Deleter, typename = typename enable_if<
+			!is_pointer<D>::value && is_default_constructible<D>::value
+		>::type>
+		constexpr unique_ptr() noexcept: __storage() {}
+
+		template <typename D = Deleter, typename = typename enable_if<
+			!is_pointer<D>::value && is_default_constructible<D>::value
+		>::type>
+		constexpr unique_ptr(::std::nullptr_t) noexcept: __storage() {}
+
+		template <typename U, typename D = Deleter, typename = typename enable_if<
+			!is_pointer<D>::value && is_default_constructible<D>::value && __is_acceptable_pointer<U>::value
+		>::type>
+		__CONSTEXPR20 explicit unique_ptr(U ptr) noexcept: __storage(ptr, D()) {}
+
+		template <typename U, typename D = Deleter, typename = typename enable_if<
+			!is_reference<D>::value && __is_acceptable_pointer<U>::value
+		>::type>
+		__CONSTEXPR20 unique_ptr(U ptr, const Deleter& deleter) noexcept: __storage(ptr, deleter) {}
+
+		template <typename U, typename D = Deleter, typename = typename enable_if<
+			!is_reference<D>::value && __is_acceptable_pointer<U>::value
+		>::type>
+		__CONSTEXPR20 unique_ptr(U ptr, Deleter&& deleter) noexcept: __storage(ptr, __MY_NAMESPACE::move(deleter)) {}
+
+		__CONSTEXPR20 unique_ptr(unique_ptr&& other) noexcept
+			: __storage(other.release(), __MY_NAMESPACE::forward<Deleter>(other.get_deleter())) {}
+
+		unique_ptr(const unique_ptr&) = delete;
+		unique_ptr& operator=(const unique_ptr&) = delete;
+
+		__CONSTEXPR20 ~unique_ptr() noexcept {
+			if (__storage.first() != pointer()) {
+				__storage.second()(__storage.first());
+			}
+		}
+
+		__CONSTEXPR20 unique_ptr& operator=(unique_ptr&& other) noexcept {
+			reset(other.release());
+			__storage.second() = __MY_NAMESPACE::forward<Deleter>(other.get_deleter());
+			return *this;
+		}
+
+		__CONSTEXPR20 unique_ptr& operator=(::std::nullptr_t) noexcept {
+			reset();
+			return *this;
+		}
+
+		/**
+		 * @brief returns a pointer to the managed array and releases the ownership
+		 * @brief 放弃所管理数组的所有权并返回其指针
+		*/
+		__CONSTEXPR20 pointer release() noexcept {
+			pointer ptr = __storage.first();
+			__storage.first() = pointer();
+			return ptr;
+		}
+
+		/**
+		 * @brief replaces the managed array
+		 * @brief 替换所管理的数组，原数组（若存在）以删除器销毁
+		*/
+		template <typename U, typename = typename enable_if<__is_acceptable_pointer<U>::value>::type>
+		__CONSTEXPR20 void reset(U ptr) noexcept {
+			pointer old = __storage.first();
+			__storage.first() = ptr;
+			if (old != pointer()) {
+				__storage.second()(old);
+			}
+		}
+
+		__CONSTEXPR20 void reset(::std::nullptr_t = nullptr) noexcept {
+			reset(pointer());
+		}
+
+		/**
+		 * @brief swaps the managed arrays
+		 * @brief 交换所管理的数组与删除器
+		*/
+		__CONSTEXPR20 void swap(unique_ptr& other) noexcept {
+			__storage.swap(other.__storage);
+		}
+
+		__NODISCARD constexpr pointer get() const noexcept {
+			return __storage.first();
+		}
+
+		__NODISCARD __CONSTEXPR14 Deleter& get_deleter() noexcept {
+			return __storage.second();
+		}
+
+		__NODISCARD constexpr const Deleter& get_deleter() const noexcept {
+			return __storage.second();
+		}
+
+		constexpr explicit operator bool() const noexcept {
+			return __storage.first() != pointer();
+		}
+
+		/**
+		 * @brief provides indexed access to the managed array
+		 * @brief 访问所管理数组的第 i 个元素
+		*/
+		__CONSTEXPR20 T& operator[](::size_t i) const noexcept {
+			return __storage.first()[i];
+		}
+	};
+
+	/**
+	 * @brief specializes the swap algorithm for unique_ptr
+	 * @brief 交换两个 unique_ptr
+	*/
+	template <typename T, typename Deleter>
+	__CONSTEXPR20 void swap(unique_ptr<T, Deleter>& lhs, unique_ptr<T, Deleter>& rhs) noexcept {
+		lhs.swap(rhs);
+	}
+
+	// 指针与删除器都可平凡重定位时，unique_ptr 可平凡重定位
+	template <typename T, typename Deleter>
+	struct is_trivially_relocatable<unique_ptr<T, Deleter>>: integral_constant<
+		bool,
+		is_trivially_relocatable<typename unique_ptr<T, Deleter>::pointer>::value &&
+		is_trivially_relocatable<Deleter>::value
+	> {};
+
+	template <typename T1, typename D1, typename T2, typename D2>
+	__CONSTEXPR20 bool operator==(const unique_ptr<T1, D1>& lhs, const unique_ptr<T2, D2>& rhs) noexcept {
+		return lhs.get() == rhs.get();
+	}
+
+	template <typename T, typename D>
+	__CONSTEXPR20 bool operator==(const unique_ptr<T, D>& lhs, ::std::nullptr_t) noexcept {
+		return !lhs;
+	}
+
+	#if !__HAS_CPP20
+	template <typename T, typename D>
+	bool operator==(::std::nullptr_t, const unique_ptr<T, D>& rhs) noexcept {
+		return !rhs;
+	}
+
+	template <typename T1, typename D1, typename T2, typename D2>
+	bool operator!=(const unique_ptr<T1, D1>& lhs, const unique_ptr<T2, D2>& rhs) noexcept {
+		return lhs.get() != rhs.get();
+	}
+
+	template <typename T, typename D>
+	bool operator!=(const unique_ptr<T, D>& lhs, ::std::nullptr_t) noexcept {
+		return static_cast<bool>(lhs);
+	}
+
+	template <typename T, typename D>
+	bool operator!=(::std::nullptr_t, const unique_ptr<T, D>& rhs) noexcept {
+		return static_cast<bool>(rhs);
+	}
+	#endif // !__HAS_CPP20
+
+	template <typename T1, typename D1, typename T2, typename D2>
+	bool operator<(const unique_ptr<T1, D1>& lhs, const unique_ptr<T2, D2>& rhs) noexcept {
+		return lhs.get() < rhs.get();
+	}
+
+	/**
+	 * @brief creates a unique pointer that manages a new object
+	 * @brief 以 args 构造一个新对象，并返回管理它的 unique_ptr
+	*/
+	template <typename T, typename... Args>
+	__CONSTEXPR20 typename enable_if<!is_array<T>::value, unique_ptr<T>>::type make_unique(Args&&... args) {
+		return unique_ptr<T>(new T(__MY_NAMESPACE::forward<Args>(args)...));
+	}
+
+	/**
+	 * @brief creates a unique pointer that manages a new array
+	 * @brief 创建 n 个值初始化的元素组成的数组，并返回管理它的 unique_ptr
+	*/
+	template <typename T>
+	__CONSTEXPR20 typename enable_if<is_array<T>::value && extent<T>::value == 0, unique_ptr<T>>::type make_unique(::size_t n) {
+		return unique_ptr<T>(new typename remove_extent<T>::type[n]());
+	}
+
+	template <typename T, typename... Args>
+	typename enable_if<extent<T>::value != 0>::type make_unique(Args&&...) = delete;
+
+	/**
+	 * @brief creates a unique pointer that manages a new default-initialized object
+	 * @brief 创建默认初始化的新对象（平凡类型不会被清零），并返回管理它的 unique_ptr
+	*/
+	template <typename T>
+	__CONSTEXPR20 typename enable_if<!is_array<T>::value, unique_ptr<T>>::type make_unique_for_overwrite() {
+		return unique_ptr<T>(new T);
+	}
+
+	/**
+	 * @brief creates a unique pointer that manages a new default-initialized array
+	 * @brief 创建 n 个默认初始化的元素组成的数组（平凡类型不会被清零），并返回管理它的 unique_ptr
+	 * @brief 适合随后会被整体覆盖的大数组，省去一次清零
+	*/
+	template <typename T>
+	__CONSTEXPR20 typename enable_if<is_array<T>::value && extent<T>::value == 0, unique_ptr<T>>::type make_unique_for_overwrite(::size_t n) {
+		return unique_ptr<T>(new typename remove_extent<T>::type[n]);
+	}
+
+	template <typename T, typename... Args>
+	typename enable_if<extent<T>::value != 0>::type make_unique_for_overwrite(Args&&...) = delete;
+
+	#pragma endregion unique_ptr
+
+	#pragma region shared_ptr
+
+	/**
+	 * @brief (non-standard feature) reference count policy using atomic operations
+	 * @brief （非标准内容）以原子操作维护引用计数的策略，计数对象可被多个线程共享
+	*/
+	struct atomic_ref_count_policy {
+		using count_type = ::std::atomic<long>;
+
+		static long load(const count_type& count) noexcept {
+			return count.load(::std::memory_order_relaxed);
+		}
+
+		static void increment(count_type& count) noexcept {
+			count.fetch_add(1, ::std::memory_order_relaxed);
+		}
+
+		// 减至 0 时返回 true，acq_rel 保证其他线程此前的访问都先于销毁发生
+		static bool decrement(count_type& count) noexcept {
+			return count.fetch_sub(1, ::std::memory_order_acq_rel) == 1;
+		}
+
+		// 计数非 0 时加 1 并返回 true，用于 weak_ptr::lock
+		static bool increment_if_nonzero(count_type& count) noexcept {
+			long current = count.load(::std::memory_order_relaxed);
+			while (current != 0) {
+				if (count.compare_exchange_weak(current, current + 1, ::std::memory_order_acq_rel, ::std::memory_order_relaxed)) {
+					return true;
+				}
+			}
+			return false;
+		}
+	};
+
+	/**
+	 * @brief (non-standard feature) reference count policy using plain integer operations
+	 * @brief （非标准内容）以普通整数运算维护引用计数的策略，没有原子操作的开销，计数对象只能在单个线程中使用
+	*/
+	struct local_ref_count_policy {
+		using count_type = long;
+
+		static long load(const count_type& count) noexcept {
+			return count;
+		}
+
+		static void increment(count_type& count) noexcept {
+			++count;
+		}
+
+		static bool decrement(count_type& count) noexcept {
+			return --count == 0;
+		}
+
+		static bool increment_if_nonzero(count_type& count) noexcept {
+			if (count == 0) {
+				return false;
+			}
+			++count;
+			return true;
+		}
+	};
+
+	/**
+	 * @brief exception thrown when constructing a shared_ptr from an expired weak_ptr
+	 * @brief 以已过期的 weak_ptr 构造 shared_ptr 时抛出的异常
+	*/
+	class bad_weak_ptr: public ::std::exception {
+	public:
+		const char* what() const noexcept override {
+			return "bad_weak_ptr";
+		}
+	};
+
+	template <typename T, typename Policy = atomic_ref_count_policy>
+	class shared_ptr;
+
+	template <typename T, typename Policy = atomic_ref_count_policy>
+	class weak_ptr;
+
+	__INNER_BEGIN
+	/**
+	 * @brief (non-standard feature) base of the control blocks of shared_ptr
+	 * @brief （非标准内容）shared_ptr 控制块的基类
+	 *
+	 * @note
+	 * 所有 shared_ptr 共同持有 1 个弱引用，强引用归零时销毁对象并释放这 1 个弱引用，弱引用归零时释放控制块
+	*/
+	template <typename Policy>
+	class __shared_count_base {
+	private:
+		typename Policy::count_type __uses;
+		typename Policy::count_type __weaks;
+
+		// 销毁所管理的对象
+		virtual void dispose() noexcept = 0;
+		// 销毁并释放控制块自身
+		virtual void destroy() noexcept = 0;
+
+	protected:
+		__shared_count_base() noexcept: __uses(1), __weaks(1) {}
+		virtual ~__shared_count_base() = default;
+
+	public:
+		__shared_count_base(const __shared_count_base&) = delete;
+		__shared_count_base& operator=(const __shared_count_base&) = delete;
+
+		void add_shared() noexcept {
+			Policy::increment(__uses);
+		}
+
+		bool add_shared_nonzero() noexcept {
+			return Policy::increment_if_nonzero(__uses);
+		}
+
+		void release_shared() noexcept {
+			if (Policy::decrement(__uses)) {
+				dispose();
+				release_weak();
+			}
+		}
+
+		void add_weak() noexcept {
+			Policy::increment(__weaks);
+		}
+
+		void release_weak() noexcept {
+			if (Policy::decrement(__weaks)) {
+				destroy();
+			}
+		}
+
+		long use_count() const noexcept {
+			return Policy::load(__uses);
+		}
+	};
+
+	/**
+	 * @brief (non-standard feature) control block owning a separately allocated object and its deleter
+	 * @brief （非标准内容）管理独立分配的对象的控制块，保存指针、删除器与分配器
+	*/
+	template <typename Pointer, typename Deleter, typename Alloc, typename Policy>
+	class __shared_count_pointer final: public __shared_count_base<Policy> {
+	private:
+		using __block_alloc = typename allocator_traits<Alloc>::template rebind_alloc<__shared_count_pointer>;
+		using __block_traits = allocator_traits<__block_alloc>;
+
+		// 无状态的删除器与分配器均不占用空间
+		compressed_pair<Pointer, compressed_pair<Deleter, __block_alloc>> __storage;
+
+		void dispose() noexcept override {
+			__storage.second().first()(__storage.first());
+		}
+
+		void destroy() noexcept override {
+			__block_alloc alloc(__MY_NAMESPACE::move(__storage.second().second()));
+			this->~__shared_count_pointer();
+			__block_traits::deallocate(alloc, this, 1);
+		}
+
+	public:
+		__shared_count_pointer(Pointer ptr, Deleter&& deleter, const __block_alloc& alloc) noexcept
+			: __storage(ptr, compressed_pair<Deleter, __block_alloc>(__MY_NAMESPACE::move(deleter), alloc)) {}
+
+		/**
+		 * @brief allocates the control block, ptr is deleted if the allocation fails
+		 * @brief 分配控制块，分配失败时以删除器销毁 ptr
+		*/
+		static __shared_count_base<Policy>* create(Pointer ptr, Deleter deleter, const Alloc& alloc) {
+			__block_alloc block_alloc(alloc);
+			__shared_count_pointer* block;
+			try {
+				block = __block_traits::allocate(block_alloc, 1);
+			}
+			catch (...) {
+				deleter(ptr);
+				throw;
+			}
+			return ::new (static_cast<void*>(block)) __shared_count_pointer(ptr, __MY_NAMESPACE::move(deleter), block_alloc);
+		}
+	};
+
+	/**
+	 * @brief (non-standard feature) control block holding the object in place
+	 * @brief （非标准内容）将对象与引用计数放在同一次分配中的控制块，用于 make_shared 与 allocate_shared
+	*/
+	template <typename T, typename Alloc, typename Policy>
+	class __shared_count_inplace final: public __shared_count_base<Policy> {
+	private:
+		using __value_type = typename remove_cv<T>::type;
+		using __value_alloc = typename allocator_traits<Alloc>::template rebind_alloc<__value_type>;
+		using __block_alloc = typename allocator_traits<Alloc>::template rebind_alloc<__shared_count_inplace>;
+		using __block_traits = allocator_traits<__block_alloc>;
+
+		__block_alloc __alloc;
+		alignas(__value_type) unsigned char __storage[sizeof(__value_type)];
+
+		void dispose() noexcept override {
+			__value_alloc alloc(__alloc);
+			allocator_traits<__value_alloc>::destroy(alloc, get());
+		}
+
+		void destroy() noexcept override {
+			__block_alloc alloc(__MY_NAMESPACE::move(__alloc));
+			this->~__shared_count_inplace();
+			__block_traits::deallocate(alloc, this, 1);
+		}
+
+		template <typename... Args>
+		__shared_count_inplace(const __block_alloc& alloc, Args&&... args): __alloc(alloc) {
+			__value_alloc value_alloc(__alloc);
+			allocator_traits<__value_alloc>::construct(value_alloc, get(), __MY_NAMESPACE::forward<Args>(args)...);
+		}
+
+	public:
+		__value_type* get() noexcept {
+			return reinterpret_cast<__value_type*>(__storage);
+		}
+
+		/**
+		 * @brief allocates the control block and constructs the object in it
+		 * @brief 一次分配出控制块，并在其中构造对象
+		*/
+		template <typename... Args>
+		static __shared_count_inplace* create(const Alloc& alloc, Args&&... args) {
+			__block_alloc block_alloc(alloc);
+			__shared_count_inplace* block = __block_traits::allocate(block_alloc, 1);
+			try {
+				return ::new (static_cast<void*>(block)) __shared_count_inplace(block_alloc, __MY_NAMESPACE::forward<Args>(args)...);
+			}
+			catch (...) {
+				__block_traits::deallocate(block_alloc, block, 1);
+				throw;
+			}
+		}
+	};
+
+	// 以引用方式保存删除器，用于由删除器为引用类型的 unique_ptr 构造 shared_ptr
+	template <typename Deleter>
+	struct __shared_deleter_ref {
+		Deleter* deleter;
+
+		template <typename Pointer>
+		void operator()(Pointer ptr) const {
+			(*deleter)(ptr);
+		}
+	};
+
+	// Y* 能否被 shared_ptr<T> 接管
+	template <typename Y, typename T>
+	struct __sp_pointer_compatible: is_convertible<Y*, T*> {};
+	template <typename Y, typename U>
+	struct __sp_pointer_compatible<Y, U[]>: is_convertible<Y(*)[], U(*)[]> {};
+	template <typename Y, typename U, ::size_t N>
+	struct __sp_pointer_compatible<Y, U[N]>: is_convertible<Y(*)[N], U(*)[N]> {};
+
+	// shared_ptr<Y> 能否转换为 shared_ptr<T>
+	template <typename Y, typename T>
+	struct __sp_compatible: is_convertible<Y*, T*> {};
+
+	// 接管 Y* 时使用的默认删除器
+	template <typename Y, typename T>
+	using __sp_default_delete = typename conditional<is_array<T>::value, default_delete<Y[]>, default_delete<Y>>::type;
+
+	// 区分接管控制块的私有构造函数与接受删除器的构造函数
+	struct __shared_adopt_tag {};
+
+	template <typename T, typename Policy, typename Alloc, typename... Args>
+	shared_ptr<T, Policy> __allocate_shared(const Alloc& alloc, Args&&... args);
+	__INNER_END
+
+	/**
+	 * @brief smart pointer with shared object ownership semantics
+	 * @brief 共享所指对象所有权的智能指针，最后一个拥有者销毁时销毁对象
+	 * @tparam T 所管理对象的类型
+	 * @tparam Policy （非标准内容）引用计数策略，默认为原子计数；只在单线程中使用时可用 local_ref_count_policy 免去原子操作
+	*/
+	template <typename T, typename Policy>
+	class shared_ptr {
+	public:
+		using element_type = typename remove_extent<T>::type;
+		using weak_type = weak_ptr<T, Policy>;
+		using policy_type = Policy;
+
+	private:
+		using __control = __INNER_NAMESPACE::__shared_count_base<Policy>;
+
+		element_type* __ptr;
+		__control* __ctrl;
+
+		template <typename, typename>
+		friend class shared_ptr;
+
+		template <typename, typename>
+		friend class weak_ptr;
+
+		template <typename U, typename P, typename Alloc, typename... Args>
+		friend shared_ptr<U, P> __INNER_NAMESPACE::__allocate_shared(const Alloc&, Args&&...);
+
+		// 接管已经计入 1 个强引用的控制块
+		shared_ptr(__INNER_NAMESPACE::__shared_adopt_tag, element_type* ptr, __control* ctrl) noexcept: __ptr(ptr), __ctrl(ctrl) {}
+
+	public:
+		constexpr shared_ptr() noexcept: __ptr(nullptr), __ctrl(nullptr) {}
+
+		constexpr shared_ptr(::std::nullptr_t) noexcept: __ptr(nullptr), __ctrl(nullptr) {}
+
+		template <typename Y, typename = typename enable_if<__INNER_NAMESPACE::__sp_pointer_compatible<Y, T>::value>::type>
+		explicit shared_ptr(Y* ptr)
+			: __ptr(ptr), __ctrl(__INNER_NAMESPACE::__shared_count_pointer<
+				Y*, __INNER_NAMESPACE::__sp_default_delete<Y, T>, allocator<Y>, Policy
+			>::create(ptr, __INNER_NAMESPACE::__sp_default_delete<Y, T>(), allocator<Y>())) {}
+
+		template <typename Y, typename Deleter, typename = typename enable_if<__INNER_NAMESPACE::__sp_pointer_compatible<Y, T>::value>::type>
+		shared_ptr(Y* ptr, Deleter deleter)
+			: __ptr(ptr), __ctrl(__INNER_NAMESPACE::__shared_count_pointer<
+				Y*, Deleter, allocator<Y>, Policy
+			>::create(ptr, __MY_NAMESPACE::move(deleter), allocator<Y>())) {}
+
+		template <typename Y, typename Deleter, typename Alloc, typename = typename enable_if<__INNER_NAMESPACE::__sp_pointer_compatible<Y, T>::value>::type>
+		shared_ptr(Y* ptr, Deleter deleter, Alloc alloc)
+			: __ptr(ptr), __ctrl(__INNER_NAMESPACE::__shared_count_pointer<
+				Y*, Deleter, Alloc, Policy
+			>::create(ptr, __MY_NAMESPACE::move(deleter), alloc)) {}
+
+		template <typename Deleter>
+		shared_ptr(::std::nullptr_t, Deleter deleter)
+			: __ptr(nullptr), __ctrl(__INNER_NAMESPACE::__shared_count_pointer<
+				::std::nullptr_t, Deleter, allocator<char>, Policy
+			>::create(nullptr, __MY_NAMESPACE::move(deleter), allocator<char>())) {}
+
+		template <typename Deleter, typename Alloc>
+		shared_ptr(::std::nullptr_t, Deleter deleter, Alloc alloc)
+			: __ptr(nullptr), __ctrl(__INNER_NAMESPACE::__shared_count_pointer<
+				::std::nullptr_t, Deleter, Alloc, Policy
+			>::create(nullptr, __MY_NAMESPACE::move(deleter), alloc)) {}
+
+		/**
+		 * @brief aliasing constructor, shares ownership with other but points to ptr
+		 * @brief 别名构造函数，与 other 共享所有权，但指向 ptr
+		*/
+		template <typename Y>
+		shared_ptr(const shared_ptr<Y, Policy>& other, element_type* ptr) noexcept: __ptr(ptr), __ctrl(other.__ctrl) {
+			if (__ctrl != nullptr) {
+				__ctrl->add_shared();
+			}
+		}
+
+		template <typename Y>
+		shared_ptr(shared_ptr<Y, Policy>&& other, element_type* ptr) noexcept: __ptr(ptr), __ctrl(other.__ctrl) {
+			other.__ptr = nullptr;
+			other.__ctrl = nullptr;
+		}
+
+		shared_ptr(const shared_ptr& other) noexcept: __ptr(other.__ptr), __ctrl(other.__ctrl) {
+			if (__ctrl != nullptr) {
+				__ctrl->add_shared();
+			}
+		}
+
+		template <typename Y, typename = typename enable_if<__INNER_NAMESPACE::__sp_compatible<Y, T>::value>::type>
+		shared_ptr(const shared_ptr<Y, Policy>& other) noexcept: __ptr(other.__ptr), __ctrl(other.__ctrl) {
+			if (__ctrl != nullptr) {
+				__ctrl->add_shared();
+			}
+		}
+
+		shared_ptr(shared_ptr&& other) noexcept: __ptr(other.__ptr), __ctrl(other.__ctrl) {
+			other.__ptr = nullptr;
+			other.__ctrl = nullptr;
+		}
+
+		template <typename Y, typename = typename enable_if<__INNER_NAMESPACE::__sp_compatible<Y, T>::value>::type>
+		shared_ptr(shared_ptr<Y, Policy>&& other) noexcept: __ptr(other.__ptr), __ctrl(other.__ctrl) {
+			other.__ptr = nullptr;
+			other.__ctrl = nullptr;
+		}
+
+		/**
+		 * @brief shares ownership with a weak_ptr, throws bad_weak_ptr if it has expired
+		 * @brief 与 weak_ptr 共享所有权，其已过期时抛出 bad_weak_ptr
+		*/
+		template <typename Y, typename = typename enable_if<__INNER_NAMESPACE::__sp_compatible<Y, T>::value>::type>
+		explicit shared_ptr(const weak_ptr<Y, Policy>& other): __ptr(other.__ptr), __ctrl(other.__ctrl) {
+			if (__ctrl == nullptr || !__ctrl->add_shared_nonzero()) {
+				throw bad_weak_ptr();
+			}
+		}
+
+		template <typename Y, typename Deleter, typename = typename enable_if<
+			__INNER_NAMESPACE::__sp_compatible<Y, T>::value &&
+			is_convertible<typename unique_ptr<Y, Deleter>::pointer, element_type*>::value
+		>::type>
+		shared_ptr(unique_ptr<Y, Deleter>&& other): __ptr(other.get()), __ctrl(nullptr) {
+			if (__ptr != nullptr) {
+				using __deleter = typename conditional<
+					is_reference<Deleter>::value,
+					__INNER_NAMESPACE::__shared_deleter_ref<typename remove_reference<Deleter>::type>,
+					Deleter
+				>::type;
+				__ctrl = __INNER_NAMESPACE::__shared_count_pointer<
+					typename unique_ptr<Y, Deleter>::pointer, __deleter, allocator<Y>, Policy
+				>::create(other.get(), __make_deleter(other.get_deleter(), is_reference<Deleter>()), allocator<Y>());
+				other.release();
+			}
+		}
+
+		~shared_ptr() noexcept {
+			if (__ctrl != nullptr) {
+				__ctrl->release_shared();
+			}
+		}
+
+		shared_ptr& operator=(const shared_ptr& other) noexcept {
+			shared_ptr(other).swap(*this);
+			return *this;
+		}
+
+		template <typename Y>
+		shared_ptr& operator=(const shared_ptr<Y, Policy>& other) noexcept {
+			shared_ptr(other).swap(*this);
+			return *this;
+		}
+
+		shared_ptr& operator=(shared_ptr&& other) noexcept {
+			shared_ptr(__MY_NAMESPACE::move(other)).swap(*this);
+			return *this;
+		}
+
+		template <typename Y>
+		shared_ptr& operator=(shared_ptr<Y, Policy>&& other) noexcept {
+			shared_ptr(__MY_NAMESPACE::move(other)).swap(*this);
+			return *this;
+		}
+
+		template <typename Y, typename Deleter>
+		shared_ptr& operator=(unique_ptr<Y, Deleter>&& other) {
+			shared_ptr(__MY_NAMESPACE::move(other)).swap(*this);
+			return *this;
+		}
+
+		/**
+		 * @brief replaces the managed object
+		 * @brief 替换所管理的对象
+		*/
+		void reset() noexcept {
+			shared_ptr().swap(*this);
+		}
+
+		template <typename Y>
+		void reset(Y* ptr) {
+			shared_ptr(ptr).swap(*this);
+		}
+
+		template <typename Y, typename Deleter>
+		void reset(Y* ptr, Deleter deleter) {
+			shared_ptr(ptr, __MY_NAMESPACE::move(deleter)).swap(*this);
+		}
+
+		template <typename Y, typename Deleter, typename Alloc>
+		void reset(Y* ptr, Deleter deleter, Alloc alloc) {
+			shared_ptr(ptr, __MY_NAMESPACE::move(deleter), __MY_NAMESPACE::move(alloc)).swap(*this);
+		}
+
+		void swap(shared_ptr& other) noexcept {
+			__MY_NAMESPACE::swap(__ptr, other.__ptr);
+			__MY_NAMESPACE::swap(__ctrl, other.__ctrl);
+		}
+
+		__NODISCARD element_type* get() const noexcept {
+			return __ptr;
+		}
+
+		typename add_lvalue_reference<element_type>::type operator*() const noexcept {
+			return *__ptr;
+		}
+
+		element_type* operator->() const noexcept {
+			return __ptr;
+		}
+
+		template <typename U = T, typename = typename enable_if<is_array<U>::value>::type>
+		typename remove_extent<U>::type& operator[](::ptrdiff_t i) const noexcept {
+			return __ptr[i];
+		}
+
+		/**
+		 * @brief returns the number of shared_ptr objects referring to the same managed object
+		 * @brief 返回共享同一对象的 shared_ptr 数量
+		*/
+		__NODISCARD long use_count() const noexcept {
+			return __ctrl != nullptr ? __ctrl->use_count() : 0;
+		}
+
+		explicit operator bool() const noexcept {
+			return __ptr != nullptr;
+		}
+
+		/**
+		 * @brief provides owner-based ordering of shared pointers
+		 * @brief 按控制块而非所指对象排序
+		*/
+		template <typename Y>
+		bool owner_before(const shared_ptr<Y, Policy>& other) const noexcept {
+			return __ctrl < other.__ctrl;
+		}
+
+		template <typename Y>
+		bool owner_before(const weak_ptr<Y, Policy>& other) const noexcept {
+			return __ctrl < other.__ctrl;
+		}
+
+	private:
+		template <typename Deleter>
+		static Deleter&& __make_deleter(Deleter& deleter, false_type) noexcept {
+			return __MY_NAMESPACE::move(deleter);
+		}
+
+		template <typename Deleter>
+		static __INNER_NAMESPACE::__shared_deleter_ref<Deleter> __make_deleter(Deleter& deleter, true_type) noexcept {
+			return { __MY_NAMESPACE::addressof(deleter) };
+		}
+	};
+
+	/**
+	 * @brief weak reference to an object managed by shared_ptr
+	 * @brief 对 shared_ptr 所管理对象的弱引用，不延长对象的生存期
+	 * @tparam T 所引用对象的类型
+	 * @tparam Policy （非标准内容）引用计数策略，与对应的 shared_ptr 一致
+	*/
+	template <typename T, typename Policy>
+	class weak_ptr {
+	public:
+		using element_type = typename remove_extent<T>::type;
+
+	private:
+		using __control = __INNER_NAMESPACE::__shared_count_base<Policy>;
+
+		element_type* __ptr;
+		__control* __ctrl;
+
+		template <typename, typename>
+		friend class shared_ptr;
+
+		template <typename, typename>
+		friend class weak_ptr;
+
+	public:
+		constexpr weak_ptr() noexcept: __ptr(nullptr), __ctrl(nullptr) {}
+
+		weak_ptr(const weak_ptr& other) noexcept: __ptr(other.__ptr), __ctrl(other.__ctrl) {
+			if (__ctrl != nullptr) {
+				__ctrl->add_weak();
+			}
+		}
+
+		// 对象可能已被销毁，经虚基类转换指针并不安全，因此先 lock
+		template <typename Y, typename = typename enable_if<__INNER_NAMESPACE::__sp_compatible<Y, T>::value>::type>
+		weak_ptr(const weak_ptr<Y, Policy>& other) noexcept: __ptr(other.lock().get()), __ctrl(other.__ctrl) {
+			if (__ctrl != nullptr) {
+				__ctrl->add_weak();
+			}
+		}
+
+		template <typename Y, typename = typename enable_if<__INNER_NAMESPACE::__sp_compatible<Y, T>::value>::type>
+		weak_ptr(const shared_ptr<Y, Policy>& other) noexcept: __ptr(other.__ptr), __ctrl(other.__ctrl) {
+			if (__ctrl != nullptr) {
+				__ctrl->add_weak();
+			}
+		}
+
+		weak_ptr(weak_ptr&& other) noexcept: __ptr(other.__ptr), __ctrl(other.__ctrl) {
+			other.__ptr = nullptr;
+			other.__ctrl = nullptr;
+		}
+
+		template <typename Y, typename = typename enable_if<__INNER_NAMESPACE::__sp_compatible<Y, T>::value>::type>
+		weak_ptr(weak_ptr<Y, Policy>&& other) noexcept: __ptr(other.lock().get()), __ctrl(other.__ctrl) {
+			other.__ptr = nullptr;
+			other.__ctrl = nullptr;
+		}
+
+		~weak_ptr() noexcept {
+			if (__ctrl != nullptr) {
+				__ctrl->release_weak();
+			}
+		}
+
+		weak_ptr& operator=(const weak_ptr& other) noexcept {
+			weak_ptr(other).swap(*this);
+			return *this;
+		}
+
+		template <typename Y>
+		weak_ptr& operator=(const weak_ptr<Y, Policy>& other) noexcept {
+			weak_ptr(other).swap(*this);
+			return *this;
+		}
+
+		template <typename Y>
+		weak_ptr& operator=(const shared_ptr<Y, Policy>& other) noexcept {
+			weak_ptr(other).swap(*this);
+			return *this;
+		}
+
+		weak_ptr& operator=(weak_ptr&& other) noexcept {
+			weak_ptr(__MY_NAMESPACE::move(other)).swap(*this);
+			return *this;
+		}
+
+		template <typename Y>
+		weak_ptr& operator=(weak_ptr<Y, Policy>&& other) noexcept {
+			weak_ptr(__MY_NAMESPACE::move(other)).swap(*this);
+			return *this;
+		}
+
+		void reset() noexcept {
+			weak_ptr().swap(*this);
+		}
+
+		void swap(weak_ptr& other) noexcept {
+			__MY_NAMESPACE::swap(__ptr, other.__ptr);
+			__MY_NAMESPACE::swap(__ctrl, other.__ctrl);
+		}
+
+		__NODISCARD long use_count() const noexcept {
+			return __ctrl != nullptr ? __ctrl->use_count() : 0;
+		}
+
+		/**
+		 * @brief checks whether the referenced object was already deleted
+		 * @brief 检查所引用的对象是否已被销毁
+		*/
+		__NODISCARD bool expired() const noexcept {
+			return use_count() == 0;
+		}
+
+		/**
+		 * @brief creates a shared_ptr that manages the referenced object
+		 * @brief 获取共享所引用对象所有权的 shared_ptr，对象已被销毁时返回空的 shared_ptr
+		*/
+		__NODISCARD shared_ptr<T, Policy> lock() const noexcept {
+			if (__ctrl != nullptr && __ctrl->add_shared_nonzero()) {
+				return shared_ptr<T, Policy>(__INNER_NAMESPACE::__shared_adopt_tag(), __ptr, __ctrl);
+			}
+			return shared_ptr<T, Policy>();
+		}
+
+		template <typename Y>
+		bool owner_before(const shared_ptr<Y, Policy>& other) const noexcept {
+			return __ctrl < other.__ctrl;
+		}
+
+		template <typename Y>
+		bool owner_before(const weak_ptr<Y, Policy>& other) const noexcept {
+			return __ctrl < other.__ctrl;
+		}
+	};
+
+	/**
+	 * @brief (non-standard feature) shared_ptr whose reference count is not atomic
+	 * @brief （非标准内容）引用计数不使用原子操作的 shared_ptr，只能在单个线程中使用
+	*/
+	template <typename T>
+	using local_shared_ptr = shared_ptr<T, local_ref_count_policy>;
+
+	/**
+	 * @brief (non-standard feature) weak_ptr whose reference count is not atomic
+	 * @brief （非标准内容）引用计数不使用原子操作的 weak_ptr，只能在单个线程中使用
+	*/
+	template <typename T>
+	using local_weak_ptr = weak_ptr<T, local_ref_count_policy>;
+
+	template <typename T, typename Policy>
+	void swap(shared_ptr<T, Policy>& lhs, shared_ptr<T, Policy>& rhs) noexcept {
+		lhs.swap(rhs);
+	}
+
+	template <typename T, typename Policy>
+	void swap(weak_ptr<T, Policy>& lhs, weak_ptr<T, Policy>& rhs) noexcept {
+		lhs.swap(rhs);
+	}
+
+	// 控制块不记录 shared_ptr 与 weak_ptr 自身的地址，二者均可按字节搬移
+	template <typename T, typename Policy>
+	struct is_trivially_relocatable<shared_ptr<T, Policy>>: true_type {};
+
+	template <typename T, typename Policy>
+	struct is_trivially_relocatable<weak_ptr<T, Policy>>: true_type {};
+
+	template <typename T, typename U, typename Policy>
+	bool operator==(const shared_ptr<T, Policy>& lhs, const shared_ptr<U, Policy>& rhs) noexcept {
+		return lhs.get() == rhs.get();
+	}
+
+	template <typename T, typename Policy>
+	bool operator==(const shared_ptr<T, Policy>& lhs, ::std::nullptr_t) noexcept {
+		return !lhs;
+	}
+
+	#if !__HAS_CPP20
+	template <typename T, typename Policy>
+	bool operator==(::std::nullptr_t, const shared_ptr<T, Policy>& rhs) noexcept {
+		return !rhs;
+	}
+
+	template <typename T, typename U, typename Policy>
+	bool operator!=(const shared_ptr<T, Policy>& lhs, const shared_ptr<U, Policy>& rhs) noexcept {
+		return lhs.get() != rhs.get();
+	}
+
+	template <typename T, typename Policy>
+	bool operator!=(const shared_ptr<T, Policy>& lhs, ::std::nullptr_t) noexcept {
+		return static_cast<bool>(lhs);
+	}
+
+	template <typename T, typename Policy>
+	bool operator!=(::std::nullptr_t, const shared_ptr<T, Policy>& rhs) noexcept {
+		return static_cast<bool>(rhs);
+	}
+	#endif // !__HAS_CPP20
+
+	template <typename T, typename U, typename Policy>
+	bool operator<(const shared_ptr<T, Policy>& lhs, const shared_ptr<U, Policy>& rhs) noexcept {
+		return lhs.get() < rhs.get();
+	}
+
+	#pragma region pointer casts
+	/**
+	 * @brief creates a shared_ptr sharing ownership with ptr, whose pointer is obtained by static_cast
+	 * @brief 以 static_cast 转换所指对象的类型，与 ptr 共享所有权
+	*/
+	template <typename T, typename U, typename Policy>
+	shared_ptr<T, Policy> static_pointer_cast(const shared_ptr<U, Policy>& ptr) noexcept {
+		return shared_ptr<T, Policy>(ptr, static_cast<typename shared_ptr<T, Policy>::element_type*>(ptr.get()));
+	}
+
+	/**
+	 * @brief creates a shared_ptr sharing ownership with ptr, whose pointer is obtained by const_cast
+	 * @brief 以 const_cast 转换所指对象的类型，与 ptr 共享所有权
+	*/
+	template <typename T, typename U, typename Policy>
+	shared_ptr<T, Policy> const_pointer_cast(const shared_ptr<U, Policy>& ptr) noexcept {
+		return shared_ptr<T, Policy>(ptr, const_cast<typename shared_ptr<T, Policy>::element_type*>(ptr.get()));
+	}
+
+	/**
+	 * @brief creates a shared_ptr sharing ownership with ptr, whose pointer is obtained by reinterpret_cast
+	 * @brief 以 reinterpret_cast 转换所指对象的类型，与 ptr 共享所有权
+	*/
+	template <typename T, typename U, typename Policy>
+	shared_ptr<T, Policy> reinterpret_pointer_cast(const shared_ptr<U, Policy>& ptr) noexcept {
+		return shared_ptr<T, Policy>(ptr, reinterpret_cast<typename shared_ptr<T, Policy>::element_type*>(ptr.get()));
+	}
+
+	/**
+	 * @brief creates a shared_ptr sharing ownership with ptr, whose pointer is obtained by dynamic_cast
+	 * @brief 以 dynamic_cast 转换所指对象的类型，转换失败时返回空的 shared_ptr
+	*/
+	template <typename T, typename U, typename Policy>
+	shared_ptr<T, Policy> dynamic_pointer_cast(const shared_ptr<U, Policy>& ptr) noexcept {
+		using element_type = typename shared_ptr<T, Policy>::element_type;
+		if (element_type* p = dynamic_cast<element_type*>(ptr.get())) {
+			return shared_ptr<T, Policy>(ptr, p);
+		}
+		return shared_ptr<T, Policy>();
+	}
+	#pragma endregion pointer casts
+
+	#pragma region make_shared
+	__INNER_BEGIN
+	template <typename T, typename Policy, typename Alloc, typename... Args>
+	shared_ptr<T, Policy> __allocate_shared(const Alloc& alloc, Args&&... args) {
+		using __block = __shared_count_inplace<T, Alloc, Policy>;
+		__block* block = __block::create(alloc, __MY_NAMESPACE::forward<Args>(args)...);
+		return shared_ptr<T, Policy>(__shared_adopt_tag(), block->get(), block);
+	}
+	__INNER_END
+
+	/**
+	 * @brief creates a shared pointer that manages a new object allocated using an allocator
+	 * @brief 以 alloc 一次分配出对象与控制块，以 args 构造对象，并返回管理它的 shared_ptr
+	*/
+	template <typename T, typename Alloc, typename... Args>
+	typename enable_if<!is_array<T>::value, shared_ptr<T>>::type allocate_shared(const Alloc& alloc, Args&&... args) {
+		return __INNER_NAMESPACE::__allocate_shared<T, atomic_ref_count_policy>(alloc, __MY_NAMESPACE::forward<Args>(args)...);
+	}
+
+	/**
+	 * @brief creates a shared pointer that manages a new object
+	 * @brief 一次分配出对象与控制块，以 args 构造对象，并返回管理它的 shared_ptr
+	*/
+	template <typename T, typename... Args>
+	typename enable_if<!is_array<T>::value, shared_ptr<T>>::type make_shared(Args&&... args) {
+		return __INNER_NAMESPACE::__allocate_shared<T, atomic_ref_count_policy>(allocator<T>(), __MY_NAMESPACE::forward<Args>(args)...);
+	}
+
+	/**
+	 * @brief (non-standard feature) allocate_shared for local_shared_ptr
+	 * @brief （非标准内容）创建 local_shared_ptr 的 allocate_shared
+	*/
+	template <typename T, typename Alloc, typename... Args>
+	typename enable_if<!is_array<T>::value, local_shared_ptr<T>>::type allocate_local_shared(const Alloc& alloc, Args&&... args) {
+		return __INNER_NAMESPACE::__allocate_shared<T, local_ref_count_policy>(alloc, __MY_NAMESPACE::forward<Args>(args)...);
+	}
+
+	/**
+	 * @brief (non-standard feature) make_shared for local_shared_ptr
+	 * @brief （非标准内容）创建 local_shared_ptr 的 make_shared
+	*/
+	template <typename T, typename... Args>
+	typename enable_if<!is_array<T>::value, local_shared_ptr<T>>::type make_local_shared(Args&&... args) {
+		return __INNER_NAMESPACE::__allocate_shared<T, local_ref_count_policy>(allocator<T>(), __MY_NAMESPACE::forward<Args>(args)...);
+	}
+	#pragma endregion make_shared
+
+	#pragma endregion shared_ptr
+
+	#pragma region intrusive_ptr
+
+	__INNER_BEGIN
+	// intrusive_ref_counter 的公共基类，用于以 is_base_of 识别内置的计数钩子
+	class __intrusive_ref_counter_base {};
+
+	// 是否通过 ADL 提供了 intrusive_ptr_add_ref 与 intrusive_ptr_release
+	template <typename T, typename = void>
+	struct __has_intrusive_hooks: false_type {};
+	template <typename T>
+	struct __has_intrusive_hooks<T, __void_t<
+		decltype(intrusive_ptr_add_ref(declval<T*>())),
+		decltype(intrusive_ptr_release(declval<T*>()))
+	>>: true_type {};
+	__INNER_END
+
+	/**
+	 * @brief (non-standard feature) CRTP base that embeds a reference count into Derived
+	 * @brief （非标准内容）将引用计数嵌入 Derived 对象中的 CRTP 基类，供 intrusive_ptr 使用
+	 * @tparam Derived 派生类，计数归零时以 delete 销毁 Derived 对象
+	 * @tparam Policy 引用计数策略，默认为原子计数；只在单线程中使用时可用 local_ref_count_policy
+	 *
+	 * @note
+	 * 复制对象时不复制计数，新对象的计数从 0 开始
+	*/
+	template <typename Derived, typename Policy = atomic_ref_count_policy>
+	class intrusive_ref_counter: public __INNER_NAMESPACE::__intrusive_ref_counter_base {
+	private:
+		mutable typename Policy::count_type __count;
+
+	protected:
+		intrusive_ref_counter() noexcept: __count(0) {}
+		intrusive_ref_counter(const intrusive_ref_counter&) noexcept: __count(0) {}
+		~intrusive_ref_counter() = default;
+
+		intrusive_ref_counter& operator=(const intrusive_ref_counter&) noexcept {
+			return *this;
+		}
+
+	public:
+		/**
+		 * @brief returns the current reference count
+		 * @brief 返回当前的引用计数
+		*/
+		__NODISCARD long use_count() const noexcept {
+			return Policy::load(__count);
+		}
+
+		void __intrusive_add_ref() const noexcept {
+			Policy::increment(__count);
+		}
+
+		void __intrusive_release() const noexcept {
+			if (Policy::decrement(__count)) {
+				delete static_cast<const Derived*>(this);
+			}
+		}
+	};
+
+	/**
+	 * @brief (non-standard feature) smart pointer to an object carrying its own reference count
+	 * @brief （非标准内容）指向自带引用计数的对象的智能指针，只占一个指针的大小，也不需要额外分配控制块
+	 * @tparam T 所指对象的类型，需派生自 intrusive_ref_counter，
+	 * 或可通过 ADL 找到 intrusive_ptr_add_ref(T*) 与 intrusive_ptr_release(T*)
+	*/
+	template <typename T>
+	class intrusive_ptr {
+	public:
+		using element_type = T;
+
+	private:
+		T* __ptr;
+
+		template <typename>
+		friend class intrusive_ptr;
+
+		// 派生自 intrusive_ref_counter 时使用内置的钩子，否则使用 ADL 找到的函数
+		using __builtin_hooks = is_base_of<__INNER_NAMESPACE::__intrusive_ref_counter_base, typename remove_cv<T>::type>;
+
+		static void __add_ref(T* ptr, true_type) noexcept {
+			ptr->__intrusive_add_ref();
+		}
+
+		static void __add_ref(T* ptr, false_type) {
+			intrusive_ptr_add_ref(ptr);
+		}
+
+		static void __release(T* ptr, true_type) noexcept {
+			ptr->__intrusive_release();
+		}
+
+		static void __release(T* ptr, false_type) {
+			intrusive_ptr_release(ptr);
+		}
+
+		static void __add_ref(T* ptr) {
+			static_assert(__builtin_hooks::value || __INNER_NAMESPACE::__has_intrusive_hooks<T>::value,
+				"T must derive from intrusive_ref_counter or provide intrusive_ptr_add_ref and intrusive_ptr_release");
+			__add_ref(ptr, __builtin_hooks());
+		}
+
+		static void __release(T* ptr) {
+			__release(ptr, __builtin_hooks());
+		}
+
+	public:
+		constexpr intrusive_ptr() noexcept: __ptr(nullptr) {}
+
+		/**
+		 * @brief takes ptr, increasing its reference count if add_ref is true
+		 * @brief 接管 ptr，add_ref 为 true 时增加其引用计数
+		*/
+		intrusive_ptr(T* ptr, bool add_ref = true): __ptr(ptr) {
+			if (__ptr != nullptr && add_ref) {
+				__add_ref(__ptr);
+			}
+		}
+
+		intrusive_ptr(const intrusive_ptr& other): __ptr(other.__ptr) {
+			if (__ptr != nullptr) {
+				__add_ref(__ptr);
+			}
+		}
+
+		template <typename U, typename = typename enable_if<is_convertible<U*, T*>::value>::type>
+		intrusive_ptr(const intrusive_ptr<U>& other): __ptr(other.__ptr) {
+			if (__ptr != nullptr) {
+				__add_ref(__ptr);
+			}
+		}
+
+		intrusive_ptr(intrusive_ptr&& other) noexcept: __ptr(other.__ptr) {
+			other.__ptr = nullptr;
+		}
+
+		template <typename U, typename = typename enable_if<is_convertible<U*, T*>::value>::type>
+		intrusive_ptr(intrusive_ptr<U>&& other) noexcept: __ptr(other.__ptr) {
+			other.__ptr = nullptr;
+		}
+
+		~intrusive_ptr() {
+			if (__ptr != nullptr) {
+				__release(__ptr);
+			}
+		}
+
+		intrusive_ptr& operator=(const intrusive_ptr& other) {
+			intrusive_ptr(other).swap(*this);
+			return *this;
+		}
+
+		template <typename U>
+		intrusive_ptr& operator=(const intrusive_ptr<U>& other) {
+			intrusive_ptr(other).swap(*this);
+			return *this;
+		}
+
+		intrusive_ptr& operator=(intrusive_ptr&& other) noexcept {
+			intrusive_ptr(__MY_NAMESPACE::move(other)).swap(*this);
+			return *this;
+		}
+
+		template <typename U>
+		intrusive_ptr& operator=(intrusive_ptr<U>&& other) noexcept {
+			intrusive_ptr(__MY_NAMESPACE::move(other)).swap(*this);
+			return *this;
+		}
+
+		intrusive_ptr& operator=(T* ptr) {
+			intrusive_ptr(ptr).swap(*this);
+			return *this;
+		}
+
+		/**
+		 * @brief replaces the pointed-to object
+		 * @brief 替换所指的对象，add_ref 为 true 时增加新对象的引用计数
+		*/
+		void reset() {
+			intrusive_ptr().swap(*this);
+		}
+
+		void reset(T* ptr, bool add_ref = true) {
+			intrusive_ptr(ptr, add_ref).swap(*this);
+		}
+
+		/**
+		 * @brief returns the pointer and gives up the reference without decreasing the count
+		 * @brief 放弃所持有的引用并返回指针，不减少引用计数
+		*/
+		T* detach() noexcept {
+			T* ptr = __ptr;
+			__ptr = nullptr;
+			return ptr;
+		}
+
+		void swap(intrusive_ptr& other) noexcept {
+			__MY_NAMESPACE::swap(__ptr, other.__ptr);
+		}
+
+		__NODISCARD T* get() const noexcept {
+			return __ptr;
+		}
+
+		T& operator*() const noexcept {
+			return *__ptr;
+		}
+
+		T* operator->() const noexcept {
+			return __ptr;
+		}
+
+		explicit operator bool() const noexcept {
+			return __ptr != nullptr;
+		}
+	};
+
+	template <typename T>
+	void swap(intrusive_ptr<T>& lhs, intrusive_ptr<T>& rhs) noexcept {
+		lhs.swap(rhs);
+	}
+
+	template <typename T>
+	struct is_trivially_relocatable<intrusive_ptr<T>>: true_type {};
+
+	template <typename T, typename U>
+	bool operator==(const intrusive_ptr<T>& lhs, const intrusive_ptr<U>& rhs) noexcept {
+		return lhs.get() == rhs.get();
+	}
+
+	template <typename T, typename U>
+	bool operator==(const intrusive_ptr<T>& lhs, U* rhs) noexcept {
+		return lhs.get() == rhs;
+	}
+
+	template <typename T>
+	bool operator==(const intrusive_ptr<T>& lhs, ::std::nullptr_t) noexcept {
+		return !lhs;
+	}
+
+	#if !__HAS_CPP20
+	template <typename T, typename U>
+	bool operator==(T* lhs, const intrusive_ptr<U>& rhs) noexcept {
+		return lhs == rhs.get();
+	}
+
+	template <typename T>
+	bool operator==(::std::nullptr_t, const intrusive_ptr<T>& rhs) noexcept {
+		return !rhs;
+	}
+
+	template <typename T, typename U>
+	bool operator!=(const intrusive_ptr<T>& lhs, const intrusive_ptr<U>& rhs) noexcept {
+		return lhs.get() != rhs.get();
+	}
+
+	template <typename T, typename U>
+	bool operator!=(const intrusive_ptr<T>& lhs, U* rhs) noexcept {
+		return lhs.get() != rhs;
+	}
+
+	template <typename T, typename U>
+	bool operator!=(T* lhs, const intrusive_ptr<U>& rhs) noexcept {
+		return lhs != rhs.get();
+	}
+
+	template <typename T>
+	bool operator!=(const intrusive_ptr<T>& lhs, ::std::nullptr_t) noexcept {
+		return static_cast<bool>(lhs);
+	}
+
+	template <typename T>
+	bool operator!=(::std::nullptr_t, const intrusive_ptr<T>& rhs) noexcept {
+		return static_cast<bool>(rhs);
+	}
+	#endif // !__HAS_CPP20
+
+	template <typename T, typename U>
+	bool operator<(const intrusive_ptr<T>& lhs, const intrusive_ptr<U>& rhs) noexcept {
+		return lhs.get() < rhs.get();
+	}
+
+	template <typename T, typename U>
+	intrusive_ptr<T> static_pointer_cast(const intrusive_ptr<U>& ptr) {
+		return intrusive_ptr<T>(static_cast<T*>(ptr.get()));
+	}
+
+	template <typename T, typename U>
+	intrusive_ptr<T> const_pointer_cast(const intrusive_ptr<U>& ptr) {
+		return intrusive_ptr<T>(const_cast<T*>(ptr.get()));
+	}
+
+	template <typename T, typename U>
+	intrusive_ptr<T> dynamic_pointer_cast(const intrusive_ptr<U>& ptr) {
+		return intrusive_ptr<T>(dynamic_cast<T*>(ptr.get()));
+	}
+
+	#pragma endregion intrusive_ptr
 
+} // namespace __MY_NAMESPACE
+#endif // __HAS_CPP11
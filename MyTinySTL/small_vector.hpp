@@ -0,0 +1,433 @@
+﻿#pragma once
+#include "core.h"
+
+#if __HAS_CPP11
+#include "vector.hpp"
+
+namespace __MY_NAMESPACE {
+
+	#pragma region small_vector
+	template <typename T, ::size_t N, typename Alloc>
+	class small_vector;
+
+	__INNER_BEGIN
+	/**
+	 * @brief (non-standard feature) inline storage of small_vector
+	 * @brief （非标准内容）small_vector 的内联存储，N 为 0 时为空类，经由空基类优化不占空间
+	*/
+	template <typename T, ::size_t N>
+	class __small_vector_buffer {
+	private:
+		alignas(T) unsigned char __bytes[N * sizeof(T)];
+
+	protected:
+		T* __inline_data() noexcept { return reinterpret_cast<T*>(__bytes); }
+		const T* __inline_data() const noexcept { return reinterpret_cast<const T*>(__bytes); }
+	};
+
+	template <typename T>
+	class __small_vector_buffer<T, 0> {
+	protected:
+		T* __inline_data() noexcept { return nullptr; }
+		const T* __inline_data() const noexcept { return nullptr; }
+	};
+	__INNER_END
+
+	/**
+	 * @brief (non-standard feature) dynamic contiguous array that keeps up to N elements inside the object
+	 * @brief （非标准内容）在对象内部存放至多 N 个元素的动态连续数组，超出后才改用分配器分配的存储
+	 * @tparam T 元素类型
+	 * @tparam N 内联容量，为 0 时与 vector 等价
+	 * @tparam Alloc 分配器类型，pointer 须为 T*
+	 *
+	 * @note
+	 * 接口与 vector 相同；不超过 N 个元素时不进行任何分配，shrink_to_fit 在元素个数不超过 N 时回到内联存储
+	 * 使用堆存储时容量总是大于 N，因此 is_inline() 为 false 时 capacity() > N
+	 * 移动构造与移动赋值可以在内联容量不同的 small_vector 之间进行：源对象的堆存储大于 N 时直接接管，否则逐个重定位元素，
+	 * 满足 is_trivially_relocatable 的元素以 memcpy 整体搬移；完成后源对象为空
+	 * 元素位于内联存储时，移动与交换会使指向元素的迭代器失效
+	*/
+	template <typename T, ::size_t N, typename Alloc = allocator<T>>
+	class small_vector
+		: private __INNER_NAMESPACE::__small_vector_buffer<T, N>,
+		  public __INNER_NAMESPACE::__vector_base<T, Alloc, small_vector<T, N, Alloc>> {
+	private:
+		template <typename, ::size_t, typename>
+		friend class small_vector;
+		friend class __INNER_NAMESPACE::__vector_base<T, Alloc, small_vector>;
+
+		using __buffer = __INNER_NAMESPACE::__small_vector_buffer<T, N>;
+		using __base = __INNER_NAMESPACE::__vector_base<T, Alloc, small_vector>;
+		using __alloc_traits = allocator_traits<Alloc>;
+		using __growth = vector_growth_factor<T>;
+		using __bitwise = typename __INNER_NAMESPACE::__vector_relocates_bitwise<T, Alloc>::type;
+		using __plain = typename __INNER_NAMESPACE::__alloc_is_plain<Alloc, T>::type;
+		// 将元素从内联存储搬到别处时不会抛出异常
+		using __nothrow_relocate = integral_constant<
+			bool,
+			__bitwise::value || (__plain::value && is_nothrow_move_constructible<T>::value)
+		>;
+
+	public:
+		using value_type = T;
+		using allocator_type = Alloc;
+		using size_type = typename __alloc_traits::size_type;
+		using difference_type = typename __alloc_traits::difference_type;
+		using reference = T&;
+		using const_reference = const T&;
+		using pointer = typename __alloc_traits::pointer;
+		using const_pointer = typename __alloc_traits::const_pointer;
+		using iterator = T*;
+		using const_iterator = const T*;
+		using reverse_iterator = ::std::reverse_iterator<iterator>;
+		using const_reverse_iterator = ::std::reverse_iterator<const_iterator>;
+
+		static constexpr size_type inline_capacity = N;
+
+		static_assert(is_same<typename Alloc::value_type, T>::value, "small_vector requires Alloc::value_type to be T");
+		static_assert(is_same<pointer, T*>::value, "small_vector requires an allocator whose pointer type is T*");
+		static_assert(
+			__growth::denominator != 0 && __growth::numerator > __growth::denominator,
+			"vector_growth_factor must be greater than 1"
+		);
+
+	private:
+		using __base::__first;
+		using __base::__last;
+		using __base::__cap;
+		using __base::__alloc;
+		using __base::__destroy_range;
+		using __base::__deallocate;
+		using __base::__init_allocate;
+		using __base::__release;
+		using __base::__adopt;
+		using __base::__swap_storage;
+		using __base::__reallocate;
+		using __base::__relocate_with_gap;
+		using __base::__move_relocate;
+		using __base::__fill_uninitialized;
+		using __base::__value_construct_uninitialized;
+		using __base::__init_range;
+		using __base::__copy_assign_alloc;
+		using __base::__move_assign_alloc;
+		using __base::__swap_alloc;
+
+		#pragma region storage hooks
+		T* __local() noexcept { return __buffer::__inline_data(); }
+		const T* __local() const noexcept { return __buffer::__inline_data(); }
+
+		// 内联存储不经过分配器
+		bool __is_allocated(const T* ptr) const noexcept { return ptr != __local(); }
+
+		// 改用空的内联存储，不析构元素也不释放存储
+		void __reset() noexcept {
+			__first = __last = __local();
+			__cap() = __local() + N;
+		}
+
+		static const char* __length_message() noexcept { return "small_vector too long"; }
+		static const char* __range_message() noexcept { return "small_vector index out of range"; }
+		#pragma endregion storage hooks
+
+		/**
+		 * @brief takes over the elements of other, which is left empty
+		 * @brief 接管 other 的元素，调用前本容器须为空且位于内联存储，完成后 other 为空
+		 *
+		 * @note
+		 * other 的堆存储大于 N 时直接接管；否则逐个重定位其元素，超出 N 个时先分配堆存储
+		 * M < N 时 other 的堆存储可能不大于 N，此时元素搬入内联存储并释放 other 的堆存储，以保持堆存储的容量总是大于 N
+		*/
+		template <::size_t M>
+		void __steal(small_vector<T, M, Alloc>& other) {
+			if (!other.is_inline() && other.capacity() > N) {
+				__first = other.__first;
+				__last = other.__last;
+				__cap() = other.__cap();
+				other.__reset();
+				return;
+			}
+			__init_allocate(other.size());
+			try {
+				__last = __move_relocate(other.__first, other.__last, __first);
+			}
+			catch (...) {
+				__release();
+				throw;
+			}
+			other.__last = other.__first;
+			other.__release();
+		}
+
+		template <::size_t M>
+		void __move_assign(small_vector<T, M, Alloc>& other, true_type) {
+			__release();
+			__move_assign_alloc(other.__alloc(), typename __alloc_traits::propagate_on_container_move_assignment());
+			__steal(other);
+		}
+
+		template <::size_t M>
+		void __move_assign(small_vector<T, M, Alloc>& other, false_type) {
+			if (__alloc() == other.__alloc()) {
+				__move_assign(other, true_type());
+				return;
+			}
+			this->assign(::std::make_move_iterator(other.begin()), ::std::make_move_iterator(other.end()));
+		}
+
+		// 两者都位于内联存储：交换共同长度的部分，较长一方多出的元素重定位到另一方
+		void __swap_inline(small_vector& other) {
+			small_vector& shorter = this->size() < other.size() ? *this : other;
+			small_vector& longer = this->size() < other.size() ? other : *this;
+			const size_type common = shorter.size();
+			for (size_type i = 0; i != common; ++i) {
+				__INNER_NAMESPACE::__swap_adl(__first[i], other.__first[i]);
+			}
+			shorter.__last = __move_relocate(longer.__first + common, longer.__last, shorter.__last);
+			longer.__last = longer.__first + common;
+		}
+
+		// 一方位于堆存储：内联一方的元素重定位到堆一方的内联存储，再把堆存储交给内联一方
+		void __swap_mixed(small_vector& heap, small_vector& local) {
+			T* const heap_first = heap.__first;
+			T* const heap_last = heap.__last;
+			T* const heap_cap = heap.__cap();
+			heap.__reset();
+			try {
+				heap.__last = __move_relocate(local.__first, local.__last, heap.__first);
+			}
+			catch (...) {
+				heap.__first = heap_first;
+				heap.__last = heap_last;
+				heap.__cap() = heap_cap;
+				throw;
+			}
+			local.__first = heap_first;
+			local.__last = heap_last;
+			local.__cap() = heap_cap;
+		}
+
+	public:
+		small_vector() noexcept(noexcept(Alloc())): small_vector(Alloc()) {}
+
+		// 内联存储保持未初始化，不值初始化基类以免清零；基类初始化完成后才指向内联存储
+		explicit small_vector(const Alloc& alloc) noexcept: __base(nullptr, nullptr, alloc) {
+			__reset();
+		}
+
+		explicit small_vector(size_type count, const Alloc& alloc = Alloc()): small_vector(alloc) {
+			__init_allocate(count);
+			try {
+				__last = __value_construct_uninitialized(__first, count);
+			}
+			catch (...) {
+				__release();
+				throw;
+			}
+		}
+
+		small_vector(size_type count, const T& value, const Alloc& alloc = Alloc()): small_vector(alloc) {
+			__init_allocate(count);
+			try {
+				__last = __fill_uninitialized(__first, count, value);
+			}
+			catch (...) {
+				__release();
+				throw;
+			}
+		}
+
+		template <typename InputIt, typename = typename enable_if<__INNER_NAMESPACE::__is_input_iterator<InputIt>::value>::type>
+		small_vector(InputIt first, InputIt last, const Alloc& alloc = Alloc()): small_vector(alloc) {
+			__init_range(first, last, __INNER_NAMESPACE::__is_forward_iterator<InputIt>());
+		}
+
+		small_vector(::std::initializer_list<T> init, const Alloc& alloc = Alloc()): small_vector(init.begin(), init.end(), alloc) {}
+
+		small_vector(const small_vector& other):
+			small_vector(other.__first, other.__last, __alloc_traits::select_on_container_copy_construction(other.__alloc())) {}
+
+		template <::size_t M>
+		small_vector(const small_vector<T, M, Alloc>& other):
+			small_vector(other.__first, other.__last, __alloc_traits::select_on_container_copy_construction(other.__alloc())) {}
+
+		small_vector(const small_vector& other, const Alloc& alloc): small_vector(other.__first, other.__last, alloc) {}
+
+		small_vector(small_vector&& other) noexcept(__nothrow_relocate::value): small_vector(__MY_NAMESPACE::move(other.__alloc())) {
+			__steal(other);
+		}
+
+		/**
+		 * @brief move constructs from a small_vector with a different inline capacity
+		 * @brief 从内联容量为 M 的 small_vector 移动构造：接管其大于 N 的堆存储，或重定位其元素，完成后 other 为空
+		*/
+		template <::size_t M>
+		small_vector(small_vector<T, M, Alloc>&& other) noexcept(M <= N && __nothrow_relocate::value)
+			: small_vector(__MY_NAMESPACE::move(other.__alloc())) {
+			__steal(other);
+		}
+
+		small_vector(small_vector&& other, const Alloc& alloc): small_vector(alloc) {
+			if (__alloc_traits::is_always_equal::value || __alloc() == other.__alloc()) {
+				__steal(other);
+				return;
+			}
+			__init_range(::std::make_move_iterator(other.begin()), ::std::make_move_iterator(other.end()), true_type());
+		}
+
+		~small_vector() {
+			__destroy_range(__first, __last);
+			__deallocate(__first, this->capacity());
+		}
+
+		small_vector& operator=(const small_vector& other) {
+			if (this != __MY_NAMESPACE::addressof(other)) {
+				__copy_assign_alloc(other.__alloc(), typename __alloc_traits::propagate_on_container_copy_assignment());
+				this->assign(other.__first, other.__last);
+			}
+			return *this;
+		}
+
+		template <::size_t M>
+		small_vector& operator=(const small_vector<T, M, Alloc>& other) {
+			__copy_assign_alloc(other.__alloc(), typename __alloc_traits::propagate_on_container_copy_assignment());
+			this->assign(other.__first, other.__last);
+			return *this;
+		}
+
+		small_vector& operator=(small_vector&& other) noexcept(
+			(__alloc_traits::propagate_on_container_move_assignment::value || __alloc_traits::is_always_equal::value) &&
+			__nothrow_relocate::value
+		) {
+			if (this != __MY_NAMESPACE::addressof(other)) {
+				__move_assign(other, integral_constant<bool,
+					__alloc_traits::propagate_on_container_move_assignment::value || __alloc_traits::is_always_equal::value
+				>());
+			}
+			return *this;
+		}
+
+		template <::size_t M>
+		small_vector& operator=(small_vector<T, M, Alloc>&& other) {
+			__move_assign(other, integral_constant<bool,
+				__alloc_traits::propagate_on_container_move_assignment::value || __alloc_traits::is_always_equal::value
+			>());
+			return *this;
+		}
+
+		small_vector& operator=(::std::initializer_list<T> init) {
+			this->assign(init.begin(), init.end());
+			return *this;
+		}
+
+		/**
+		 * @brief (non-standard feature) checks whether the elements are stored inside the object
+		 * @brief （非标准内容）检查元素是否位于对象内部的内联存储
+		*/
+		bool is_inline() const noexcept { return __first == __local(); }
+
+		/**
+		 * @brief reduces the capacity to fit the elements, moving them back inline when they fit
+		 * @brief 将容量缩减到与元素个数相同；元素个数不超过 N 时搬回内联存储并释放堆存储
+		*/
+		void shrink_to_fit() {
+			if (is_inline() || __last == __cap()) {
+				return;
+			}
+			const size_type size = this->size();
+			if (size > N) {
+				__reallocate(size);
+				return;
+			}
+			__relocate_with_gap(__local(), size, 0);
+			__adopt(__local(), size, N);
+		}
+
+		/**
+		 * @brief swaps the contents
+		 * @brief 交换两个 small_vector 的内容：都使用堆存储时只交换指针，否则需要重定位内联存储中的元素
+		*/
+		void swap(small_vector& other) noexcept(__nothrow_relocate::value && is_nothrow_swappable<T>::value) {
+			if (this == __MY_NAMESPACE::addressof(other)) {
+				return;
+			}
+			__swap_alloc(other.__alloc(), typename __alloc_traits::propagate_on_container_swap());
+			const bool this_inline = is_inline();
+			const bool other_inline = other.is_inline();
+			if (!this_inline && !other_inline) {
+				__swap_storage(other);
+			}
+			else if (this_inline && other_inline) {
+				__swap_inline(other);
+			}
+			else if (this_inline) {
+				__swap_mixed(other, *this);
+			}
+			else {
+				__swap_mixed(*this, other);
+			}
+		}
+	};
+
+	#if !__HAS_CPP17
+	template <typename T, ::size_t N, typename Alloc>
+	constexpr typename small_vector<T, N, Alloc>::size_type small_vector<T, N, Alloc>::inline_capacity;
+	#endif // !__HAS_CPP17
+
+	template <typename T, ::size_t N, typename Alloc>
+	void swap(small_vector<T, N, Alloc>& lhs, small_vector<T, N, Alloc>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+		lhs.swap(rhs);
+	}
+
+	// 元素位于内联存储时 small_vector 持有指向自身的指针，只有 N 为 0 时可平凡重定位
+	template <typename T, ::size_t N, typename Alloc>
+	struct is_trivially_relocatable<small_vector<T, N, Alloc>>: integral_constant<
+		bool,
+		N == 0 && is_trivially_relocatable<Alloc>::value
+	> {};
+
+	/**
+	 * @brief lexicographically compares the values in the small_vector, the inline capacities may differ
+	 * @brief 按字典序比较两个 small_vector，二者的内联容量可以不同，可按位比较的元素使用 memcmp
+	*/
+	template <typename T, ::size_t N, ::size_t M, typename Alloc>
+	__NODISCARD bool operator==(const small_vector<T, N, Alloc>& lhs, const small_vector<T, M, Alloc>& rhs) {
+		return __INNER_NAMESPACE::__contiguous_equal(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+	}
+
+	#if __HAS_CPP20
+	template <typename T, ::size_t N, ::size_t M, typename Alloc>
+	__NODISCARD __INNER_NAMESPACE::__synth_three_way_result<const T, const T> operator<=>(
+		const small_vector<T, N, Alloc>& lhs, const small_vector<T, M, Alloc>& rhs
+	) {
+		return __INNER_NAMESPACE::__contiguous_three_way(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+	}
+	#else // ^^^ __HAS_CPP20 / vvv !__HAS_CPP20
+	template <typename T, ::size_t N, ::size_t M, typename Alloc>
+	__NODISCARD bool operator!=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, M, Alloc>& rhs) {
+		return !(lhs == rhs);
+	}
+
+	template <typename T, ::size_t N, ::size_t M, typename Alloc>
+	__NODISCARD bool operator<(const small_vector<T, N, Alloc>& lhs, const small_vector<T, M, Alloc>& rhs) {
+		return __INNER_NAMESPACE::__contiguous_less(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+	}
+
+	template <typename T, ::size_t N, ::size_t M, typename Alloc>
+	__NODISCARD bool operator>(const small_vector<T, N, Alloc>& lhs, const small_vector<T, M, Alloc>& rhs) {
+		return rhs < lhs;
+	}
+
+	template <typename T, ::size_t N, ::size_t M, typename Alloc>
+	__NODISCARD bool operator<=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, M, Alloc>& rhs) {
+		return !(rhs < lhs);
+	}
+
+	template <typename T, ::size_t N, ::size_t M, typename Alloc>
+	__NODISCARD bool operator>=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, M, Alloc>& rhs) {
+		return !(lhs < rhs);
+	}
+	#endif // __HAS_CPP20
+	#pragma endregion small_vector
+
+} // namespace __MY_NAMESPACE
+#endif // __HAS_CPP11
@@ -0,0 +1,565 @@
+﻿#pragma once
+#include "core.h"
+
+#if __HAS_CPP14
+#include <initializer_list>
+#include <stdexcept>
+#include "type_traits.hpp"
+#include "utility.hpp"
+#include "memory.hpp"
+#include "tuple.hpp"
+
+namespace __MY_NAMESPACE {
+
+	#pragma region soa_vector
+	/**
+	 * @brief (non-standard feature) view of a contiguous sequence of objects
+	 * @brief （非标准内容）连续对象序列的视图，soa_vector 以之表示一列
+	*/
+	template <typename T>
+	class column_span {
+	public:
+		using element_type = T;
+		using value_type = typename remove_cv<T>::type;
+		using size_type = ::size_t;
+		using difference_type = ::ptrdiff_t;
+		using pointer = T*;
+		using reference = T&;
+		using iterator = T*;
+
+	private:
+		T* __data;
+		size_type __size;
+
+	public:
+		constexpr column_span() noexcept: __data(nullptr), __size(0) {}
+		constexpr column_span(T* data, size_type size) noexcept: __data(data), __size(size) {}
+
+		__NODISCARD constexpr T* data() const noexcept { return __data; }
+		__NODISCARD constexpr size_type size() const noexcept { return __size; }
+		__NODISCARD constexpr bool empty() const noexcept { return __size == 0; }
+
+		__NODISCARD constexpr iterator begin() const noexcept { return __data; }
+		__NODISCARD constexpr iterator end() const noexcept { return __data + __size; }
+
+		__NODISCARD constexpr T& operator[](size_type index) const noexcept { return __data[index]; }
+		__NODISCARD constexpr T& front() const noexcept { return __data[0]; }
+		__NODISCARD constexpr T& back() const noexcept { return __data[__size - 1]; }
+	};
+
+	template <typename... Types>
+	class soa_vector;
+
+	__INNER_BEGIN
+	template <::size_t... Values>
+	constexpr ::size_t __soa_max() noexcept {
+		constexpr ::size_t values[] = { Values..., 1 };
+		::size_t result = 1;
+		for (::size_t value: values) {
+			result = value > result ? value : result;
+		}
+		return result;
+	}
+
+	// 分配的最小单位，对齐满足所有列
+	template <::size_t Align>
+	struct alignas(Align) __soa_block {
+		unsigned char bytes[Align];
+	};
+
+	/**
+	 * @brief (non-standard feature) row iterator of soa_vector
+	 * @brief （非标准内容）soa_vector 的行迭代器，解引用得到各列元素引用组成的 tuple
+	*/
+	template <typename Vector, typename Reference>
+	class __soa_iterator {
+	private:
+		template <typename, typename>
+		friend class __soa_iterator;
+
+		Vector* __vec;
+		::size_t __index;
+
+	public:
+		using iterator_category = ::std::random_access_iterator_tag;
+		using value_type = typename remove_const<Vector>::type::value_type;
+		using difference_type = ::ptrdiff_t;
+		using reference = Reference;
+		using pointer = void;
+
+		constexpr __soa_iterator() noexcept: __vec(nullptr), __index(0) {}
+		constexpr __soa_iterator(Vector* vec, ::size_t index) noexcept: __vec(vec), __index(index) {}
+
+		// 可变迭代器可以转换为只读迭代器
+		template <typename OtherVector, typename OtherReference, typename = typename enable_if<
+			is_convertible<OtherVector*, Vector*>::value
+		>::type>
+		constexpr __soa_iterator(const __soa_iterator<OtherVector, OtherReference>& other) noexcept
+			: __vec(other.__vec), __index(other.__index) {}
+
+		__NODISCARD reference operator*() const { return (*__vec)[__index]; }
+		__NODISCARD reference operator[](difference_type offset) const { return (*__vec)[__index + offset]; }
+
+		__soa_iterator& operator++() noexcept { ++__index; return *this; }
+		__soa_iterator operator++(int) noexcept { __soa_iterator temp = *this; ++__index; return temp; }
+		__soa_iterator& operator--() noexcept { --__index; return *this; }
+		__soa_iterator operator--(int) noexcept { __soa_iterator temp = *this; --__index; return temp; }
+
+		__soa_iterator& operator+=(difference_type offset) noexcept { __index += offset; return *this; }
+		__soa_iterator& operator-=(difference_type offset) noexcept { __index -= offset; return *this; }
+
+		__NODISCARD friend __soa_iterator operator+(__soa_iterator it, difference_type offset) noexcept { return it += offset; }
+		__NODISCARD friend __soa_iterator operator+(difference_type offset, __soa_iterator it) noexcept { return it += offset; }
+		__NODISCARD friend __soa_iterator operator-(__soa_iterator it, difference_type offset) noexcept { return it -= offset; }
+
+		__NODISCARD friend difference_type operator-(const __soa_iterator& lhs, const __soa_iterator& rhs) noexcept {
+			return static_cast<difference_type>(lhs.__index) - static_cast<difference_type>(rhs.__index);
+		}
+
+		__NODISCARD friend bool operator==(const __soa_iterator& lhs, const __soa_iterator& rhs) noexcept { return lhs.__index == rhs.__index; }
+		__NODISCARD friend bool operator!=(const __soa_iterator& lhs, const __soa_iterator& rhs) noexcept { return lhs.__index != rhs.__index; }
+		__NODISCARD friend bool operator<(const __soa_iterator& lhs, const __soa_iterator& rhs) noexcept { return lhs.__index < rhs.__index; }
+		__NODISCARD friend bool operator>(const __soa_iterator& lhs, const __soa_iterator& rhs) noexcept { return lhs.__index > rhs.__index; }
+		__NODISCARD friend bool operator<=(const __soa_iterator& lhs, const __soa_iterator& rhs) noexcept { return lhs.__index <= rhs.__index; }
+		__NODISCARD friend bool operator>=(const __soa_iterator& lhs, const __soa_iterator& rhs) noexcept { return lhs.__index >= rhs.__index; }
+	};
+	__INNER_END
+
+	/**
+	 * @brief (non-standard feature) sequence container that stores each field of tuple<Types...> in its own array
+	 * @brief （非标准内容）结构数组容器：逻辑上存储 tuple<Types...> 序列，而每个字段各自存储在一段连续数组中
+	 * @tparam ...Types 各列的元素类型
+	 *
+	 * @note
+	 * 所有列位于同一次分配中，依次排列，每列的起始地址按其元素类型对齐；只扫描一两个字段时不必读入整行
+	 * column<I>() 返回第 I 列的 column_span；operator[] 与迭代器得到由各列元素引用组成的 tuple<Types&...>
+	 * push_back、emplace_back 同时增长所有列，扩容时各列以 move_if_noexcept 的语义搬移到新的分配中
+	*/
+	template <typename... Types>
+	class soa_vector {
+		static_assert(sizeof...(Types) > 0, "soa_vector requires at least one column");
+
+	public:
+		using value_type = tuple<Types...>;
+		using reference = tuple<Types&...>;
+		using const_reference = tuple<const Types&...>;
+		using size_type = ::size_t;
+		using difference_type = ::ptrdiff_t;
+		using iterator = __INNER_NAMESPACE::__soa_iterator<soa_vector, reference>;
+		using const_iterator = __INNER_NAMESPACE::__soa_iterator<const soa_vector, const_reference>;
+
+		template <::size_t I>
+		using column_type = typename type_at<I, type_list<Types...>>::type;
+
+	private:
+		using __block = __INNER_NAMESPACE::__soa_block<__INNER_NAMESPACE::__soa_max<alignof(Types)...>()>;
+		using __block_alloc = allocator<__block>;
+		using __block_traits = allocator_traits<__block_alloc>;
+		using __indices = index_sequence_for<Types...>;
+
+		tuple<Types*...> __columns;
+		size_type __size;
+		size_type __capacity;
+
+		// 容量为 capacity 时所需的块数，各列的起始偏移写入 offsets
+		static size_type __layout(size_type capacity, size_type* offsets) {
+			constexpr size_type sizes[] = { sizeof(Types)... };
+			constexpr size_type aligns[] = { alignof(Types)... };
+			size_type offset = 0;
+			for (size_type i = 0; i != sizeof...(Types); ++i) {
+				offset = (offset + aligns[i] - 1) & ~(aligns[i] - 1);
+				offsets[i] = offset;
+				if (capacity > (static_cast<size_type>(-1) - offset) / sizes[i]) {
+					throw ::std::length_error("soa_vector too long");
+				}
+				offset += capacity * sizes[i];
+			}
+			return (offset + sizeof(__block) - 1) / sizeof(__block);
+		}
+
+		template <::size_t... Is>
+		static tuple<Types*...> __allocate(size_type capacity, index_sequence<Is...>) {
+			size_type offsets[sizeof...(Types)];
+			const size_type blocks = __layout(capacity, offsets);
+			__block_alloc alloc;
+			unsigned char* base = reinterpret_cast<unsigned char*>(__block_traits::allocate(alloc, blocks));
+			return tuple<Types*...>(reinterpret_cast<Types*>(base + offsets[Is])...);
+		}
+
+		static void __deallocate(const tuple<Types*...>& columns, size_type capacity) noexcept {
+			if (capacity == 0) {
+				return;
+			}
+			size_type offsets[sizeof...(Types)];
+			const size_type blocks = __layout(capacity, offsets);
+			__block_alloc alloc;
+			// 第一列位于分配的起始处
+			__block_traits::deallocate(alloc, reinterpret_cast<__block*>(__MY_NAMESPACE::get<0>(columns)), blocks);
+		}
+
+		// 析构 [first, last) 行中的前 count 列
+		template <::size_t... Is>
+		static void __destroy_rows(
+			const tuple<Types*...>& columns, size_type first, size_type last, size_type count, index_sequence<Is...>
+		) noexcept {
+			(void)::std::initializer_list<int>{ 0, (
+				Is < count ? __MY_NAMESPACE::destroy(__MY_NAMESPACE::get<Is>(columns) + first, __MY_NAMESPACE::get<Is>(columns) + last) : void(), 0
+			)... };
+		}
+
+		static void __destroy_rows(const tuple<Types*...>& columns, size_type first, size_type last) noexcept {
+			__destroy_rows(columns, first, last, sizeof...(Types), __indices());
+		}
+
+		// 在 index 行逐列构造元素，某一列抛出异常时析构该行已构造的列
+		template <::size_t... Is, typename... Args>
+		static void __construct_row(const tuple<Types*...>& columns, size_type index, index_sequence<Is...>, Args&&... args) {
+			size_type constructed = 0;
+			try {
+				(void)::std::initializer_list<int>{ 0, (
+					__MY_NAMESPACE::construct_at(__MY_NAMESPACE::get<Is>(columns) + index, __MY_NAMESPACE::forward<Args>(args)), ++constructed, 0
+				)... };
+			}
+			catch (...) {
+				__destroy_rows(columns, index, index + 1, constructed, __indices());
+				throw;
+			}
+		}
+
+		template <::size_t... Is>
+		static void __value_construct_row(const tuple<Types*...>& columns, size_type index, index_sequence<Is...>) {
+			size_type constructed = 0;
+			try {
+				(void)::std::initializer_list<int>{ 0, (
+					::new (static_cast<void*>(__MY_NAMESPACE::get<Is>(columns) + index)) column_type<Is>(), ++constructed, 0
+				)... };
+			}
+			catch (...) {
+				__destroy_rows(columns, index, index + 1, constructed, __indices());
+				throw;
+			}
+		}
+
+		// 该列在搬移时是否需要复制：不能不抛出异常地移动构造且可以复制构造时复制
+		template <::size_t I, bool Move>
+		struct __copy_on_transfer: integral_constant<
+			bool,
+			!Move || (!is_nothrow_move_constructible<column_type<I>>::value && is_copy_constructible<column_type<I>>::value)
+		> {};
+
+		/**
+		 * @brief moves (Move = true) or copies rows [0, count) of every column into columns
+		 * @brief 将各列的 [0, count) 搬移（Move 为 true）或复制到 columns 中，异常时析构已构造的列
+		 *
+		 * @note
+		 * 需要复制的列先处理，全部成功后再移动其余的列，因此任何一列抛出异常时原容器都保持不变
+		*/
+		template <bool Move, typename Source, ::size_t... Is>
+		static void __transfer(Source& source, const tuple<Types*...>& columns, size_type count, index_sequence<Is...>) {
+			bool constructed[sizeof...(Types)] = {};
+			try {
+				(void)::std::initializer_list<int>{ 0, (
+					constructed[Is] = __transfer_column<Is>(
+						source, __MY_NAMESPACE::get<Is>(columns), count, true_type(), __copy_on_transfer<Is, Move>()
+					), 0
+				)... };
+				(void)::std::initializer_list<int>{ 0, (
+					constructed[Is] = constructed[Is] || __transfer_column<Is>(
+						source, __MY_NAMESPACE::get<Is>(columns), count, false_type(), integral_constant<bool, !__copy_on_transfer<Is, Move>::value>()
+					), 0
+				)... };
+			}
+			catch (...) {
+				(void)::std::initializer_list<int>{ 0, (
+					constructed[Is] ? __MY_NAMESPACE::destroy(__MY_NAMESPACE::get<Is>(columns), __MY_NAMESPACE::get<Is>(columns) + count) : void(), 0
+				)... };
+				throw;
+			}
+		}
+
+		// 复制（true_type）或移动（false_type）一列，不属于本轮的列不做处理
+		template <::size_t I, typename Source, typename Copy>
+		static bool __transfer_column(Source&, column_type<I>*, size_type, Copy, false_type) noexcept {
+			return false;
+		}
+
+		template <::size_t I, typename Source>
+		static bool __transfer_column(Source& source, column_type<I>* target, size_type count, true_type, true_type) {
+			__MY_NAMESPACE::uninitialized_copy(source.template data<I>(), source.template data<I>() + count, target);
+			return true;
+		}
+
+		template <::size_t I, typename Source>
+		static bool __transfer_column(Source& source, column_type<I>* target, size_type count, false_type, true_type) {
+			__MY_NAMESPACE::uninitialized_move(source.template data<I>(), source.template data<I>() + count, target);
+			return true;
+		}
+
+		// 搬移到容量为 capacity 的新分配中；construct 在搬移之前于新分配的 __size 行构造新元素，
+		// 因此实参可以引用容器中已有的元素
+		template <typename Construct>
+		void __reallocate(size_type capacity, Construct construct) {
+			tuple<Types*...> columns = __allocate(capacity, __indices());
+			try {
+				construct(columns);
+				try {
+					__transfer<true>(*this, columns, __size, __indices());
+				}
+				catch (...) {
+					__destroy_rows(columns, __size, __size + 1);
+					throw;
+				}
+			}
+			catch (...) {
+				__deallocate(columns, capacity);
+				throw;
+			}
+			__destroy_rows(__columns, 0, __size);
+			__deallocate(__columns, __capacity);
+			__columns = columns;
+			__capacity = capacity;
+		}
+
+		struct __construct_nothing {
+			void operator()(const tuple<Types*...>&) const noexcept {}
+		};
+
+		void __reallocate(size_type capacity) {
+			__reallocate(capacity, __construct_nothing());
+		}
+
+		template <typename... Args>
+		struct __construct_back {
+			size_type index;
+			tuple<Args&&...> args;
+
+			void operator()(const tuple<Types*...>& columns) const {
+				__apply(columns, __indices());
+			}
+
+			template <::size_t... Is>
+			void __apply(const tuple<Types*...>& columns, index_sequence<Is...>) const {
+				__construct_row(columns, index, __indices(), __MY_NAMESPACE::forward<Args>(__MY_NAMESPACE::get<Is>(args))...);
+			}
+		};
+
+		size_type __grown_capacity() const noexcept {
+			return __capacity == 0 ? 8 : __capacity * 2;
+		}
+
+		template <::size_t... Is>
+		reference __row(size_type index, index_sequence<Is...>) noexcept {
+			return reference(data<Is>()[index]...);
+		}
+
+		template <::size_t... Is>
+		const_reference __row(size_type index, index_sequence<Is...>) const noexcept {
+			return const_reference(data<Is>()[index]...);
+		}
+
+	public:
+		soa_vector() noexcept: __columns(), __size(0), __capacity(0) {}
+
+		explicit soa_vector(size_type count): soa_vector() {
+			resize(count);
+		}
+
+		soa_vector(const soa_vector& other): soa_vector() {
+			if (other.__size == 0) {
+				return;
+			}
+			tuple<Types*...> columns = __allocate(other.__size, __indices());
+			try {
+				__transfer<false>(other, columns, other.__size, __indices());
+			}
+			catch (...) {
+				__deallocate(columns, other.__size);
+				throw;
+			}
+			__columns = columns;
+			__size = __capacity = other.__size;
+		}
+
+		soa_vector(soa_vector&& other) noexcept
+			: __columns(other.__columns), __size(other.__size), __capacity(other.__capacity) {
+			other.__columns = tuple<Types*...>();
+			other.__size = other.__capacity = 0;
+		}
+
+		~soa_vector() {
+			__destroy_rows(__columns, 0, __size);
+			__deallocate(__columns, __capacity);
+		}
+
+		soa_vector& operator=(const soa_vector& other) {
+			if (this != &other) {
+				soa_vector(other).swap(*this);
+			}
+			return *this;
+		}
+
+		soa_vector& operator=(soa_vector&& other) noexcept {
+			soa_vector(__MY_NAMESPACE::move(other)).swap(*this);
+			return *this;
+		}
+
+		void swap(soa_vector& other) noexcept {
+			__MY_NAMESPACE::swap(__columns, other.__columns);
+			__MY_NAMESPACE::swap(__size, other.__size);
+			__MY_NAMESPACE::swap(__capacity, other.__capacity);
+		}
+
+		__NODISCARD size_type size() const noexcept { return __size; }
+		__NODISCARD size_type capacity() const noexcept { return __capacity; }
+		__NODISCARD bool empty() const noexcept { return __size == 0; }
+
+		/**
+		 * @brief returns the first element of the I-th column
+		 * @brief 返回第 I 列的首地址
+		*/
+		template <::size_t I>
+		__NODISCARD column_type<I>* data() noexcept { return __MY_NAMESPACE::get<I>(__columns); }
+
+		template <::size_t I>
+		__NODISCARD const column_type<I>* data() const noexcept { return __MY_NAMESPACE::get<I>(__columns); }
+
+		/**
+		 * @brief returns the I-th column
+		 * @brief 返回第 I 列
+		*/
+		template <::size_t I>
+		__NODISCARD column_span<column_type<I>> column() noexcept { return column_span<column_type<I>>(data<I>(), __size); }
+
+		template <::size_t I>
+		__NODISCARD column_span<const column_type<I>> column() const noexcept {
+			return column_span<const column_type<I>>(data<I>(), __size);
+		}
+
+		__NODISCARD reference operator[](size_type index) noexcept { return __row(index, __indices()); }
+		__NODISCARD const_reference operator[](size_type index) const noexcept { return __row(index, __indices()); }
+
+		__NODISCARD reference at(size_type index) {
+			if (index >= __size) {
+				throw ::std::out_of_range("soa_vector index out of range");
+			}
+			return (*this)[index];
+		}
+
+		__NODISCARD const_reference at(size_type index) const {
+			if (index >= __size) {
+				throw ::std::out_of_range("soa_vector index out of range");
+			}
+			return (*this)[index];
+		}
+
+		__NODISCARD reference front() noexcept { return (*this)[0]; }
+		__NODISCARD const_reference front() const noexcept { return (*this)[0]; }
+		__NODISCARD reference back() noexcept { return (*this)[__size - 1]; }
+		__NODISCARD const_reference back() const noexcept { return (*this)[__size - 1]; }
+
+		__NODISCARD iterator begin() noexcept { return iterator(this, 0); }
+		__NODISCARD const_iterator begin() const noexcept { return const_iterator(this, 0); }
+		__NODISCARD const_iterator cbegin() const noexcept { return begin(); }
+		__NODISCARD iterator end() noexcept { return iterator(this, __size); }
+		__NODISCARD const_iterator end() const noexcept { return const_iterator(this, __size); }
+		__NODISCARD const_iterator cend() const noexcept { return end(); }
+
+		void reserve(size_type capacity) {
+			if (capacity > __capacity) {
+				__reallocate(capacity);
+			}
+		}
+
+		void shrink_to_fit() {
+			if (__size == __capacity) {
+				return;
+			}
+			if (__size == 0) {
+				__deallocate(__columns, __capacity);
+				__columns = tuple<Types*...>();
+				__capacity = 0;
+				return;
+			}
+			__reallocate(__size);
+		}
+
+		void clear() noexcept {
+			__destroy_rows(__columns, 0, __size);
+			__size = 0;
+		}
+
+		/**
+		 * @brief appends a row, constructing each column from the corresponding argument
+		 * @brief 在末尾追加一行，第 I 列的元素以第 I 个实参构造
+		*/
+		template <typename... Args>
+		reference emplace_back(Args&&... args) {
+			static_assert(sizeof...(Args) == sizeof...(Types), "emplace_back takes one argument per column");
+			if (__size == __capacity) {
+				__reallocate(__grown_capacity(), __construct_back<Args...>{
+					__size, tuple<Args&&...>(__MY_NAMESPACE::forward<Args>(args)...)
+				});
+			}
+			else {
+				__construct_row(__columns, __size, __indices(), __MY_NAMESPACE::forward<Args>(args)...);
+			}
+			++__size;
+			return back();
+		}
+
+		void push_back(const Types&... values) {
+			emplace_back(values...);
+		}
+
+		void push_back(Types&&... values) {
+			emplace_back(__MY_NAMESPACE::move(values)...);
+		}
+
+		void push_back(const value_type& row) {
+			__push_back_tuple(row, __indices());
+		}
+
+		void push_back(value_type&& row) {
+			__push_back_tuple(__MY_NAMESPACE::move(row), __indices());
+		}
+
+		void pop_back() noexcept {
+			--__size;
+			__destroy_rows(__columns, __size, __size + 1);
+		}
+
+		/**
+		 * @brief changes the number of rows, new rows are value-initialized
+		 * @brief 改变行数，新增的行被值初始化
+		*/
+		void resize(size_type count) {
+			if (count < __size) {
+				__destroy_rows(__columns, count, __size);
+				__size = count;
+				return;
+			}
+			reserve(count);
+			for (; __size != count; ++__size) {
+				__value_construct_row(__columns, __size, __indices());
+			}
+		}
+
+	private:
+		template <typename Row, ::size_t... Is>
+		void __push_back_tuple(Row&& row, index_sequence<Is...>) {
+			emplace_back(__MY_NAMESPACE::get<Is>(__MY_NAMESPACE::forward<Row>(row))...);
+		}
+	};
+
+	template <typename... Types>
+	void swap(soa_vector<Types...>& lhs, soa_vector<Types...>& rhs) noexcept {
+		lhs.swap(rhs);
+	}
+
+	// 只持有指向堆存储的各列指针
+	template <typename... Types>
+	struct is_trivially_relocatable<soa_vector<Types...>>: true_type {};
+	#pragma endregion soa_vector
+
+} // namespace __MY_NAMESPACE
+#endif // __HAS_CPP14
@@ -0,0 +1,87 @@
+﻿#ifndef __SWAP_BYTES_H__
+#define __SWAP_BYTES_H__
+
+#include "core.h"
+#include <cstring>
+
+// 向量指令的头文件只在此处包含，可用的指令集由 core.h 中的 __HAS_AVX2 / __HAS_SSE2 给出
+#if __HAS_AVX2
+#include <immintrin.h>
+#elif __HAS_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace __MY_NAMESPACE {
+
+	__INNER_BEGIN
+	/**
+	 * @brief (non-standard feature) swaps two non-overlapping byte ranges in register-sized blocks
+	 * @brief （非标准内容）以寄存器大小的块交换两段不重叠的字节，可用 AVX2 时每次 32 字节，可用 SSE2 时每次 16 字节，否则每次 8 字节
+	 *
+	 * @note
+	 * 每轮交换一个缓存行（64 字节），读入两侧的全部数据后再写回
+	*/
+	inline void __swap_bytes(unsigned char* left, unsigned char* right, ::size_t bytes) noexcept {
+		#if __HAS_AVX2
+		for (; bytes >= 64; bytes -= 64, left += 64, right += 64) {
+			__m256i l0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(left));
+			__m256i l1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(left + 32));
+			__m256i r0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(right));
+			__m256i r1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(right + 32));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(left), r0);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(left + 32), r1);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(right), l0);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(right + 32), l1);
+		}
+		for (; bytes >= 32; bytes -= 32, left += 32, right += 32) {
+			__m256i l = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(left));
+			__m256i r = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(right));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(left), r);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(right), l);
+		}
+		#elif __HAS_SSE2
+		for (; bytes >= 64; bytes -= 64, left += 64, right += 64) {
+			__m128i l0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(left));
+			__m128i l1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(left + 16));
+			__m128i l2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(left + 32));
+			__m128i l3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(left + 48));
+			__m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(right));
+			__m128i r1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(right + 16));
+			__m128i r2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(right + 32));
+			__m128i r3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(right + 48));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(left), r0);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(left + 16), r1);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(left + 32), r2);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(left + 48), r3);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(right), l0);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(right + 16), l1);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(right + 32), l2);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(right + 48), l3);
+		}
+		#endif // __HAS_AVX2
+		#if __HAS_SSE2
+		for (; bytes >= 16; bytes -= 16, left += 16, right += 16) {
+			__m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i*>(left));
+			__m128i r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(right));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(left), r);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(right), l);
+		}
+		#endif // __HAS_SSE2
+		for (; bytes >= 8; bytes -= 8, left += 8, right += 8) {
+			unsigned long long l, r;
+			::std::memcpy(&l, left, 8);
+			::std::memcpy(&r, right, 8);
+			::std::memcpy(left, &r, 8);
+			::std::memcpy(right, &l, 8);
+		}
+		for (; bytes != 0; --bytes, ++left, ++right) {
+			unsigned char temp = *left;
+			*left = *right;
+			*right = temp;
+		}
+	}
+	__INNER_END
+
+} // namespace __MY_NAMESPACE
+
+#endif // ifndef __SWAP_BYTES_H__
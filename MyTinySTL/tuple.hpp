@@ -4,14 +4,850 @@
 #if __HAS_CPP11
 #include <initializer_list>
 #include "type_traits.hpp"
+#include "utility.hpp"
 
 #if __HAS_CPP20
-// #include "compare.hpp"
+#include "compare.hpp"
 #endif // __HAS_CPP20
 
 namespace __MY_NAMESPACE {
 
+	#pragma region tuple
+	template <typename... Types>
+	class tuple;
 
+	__INNER_BEGIN
+	/**
+	 * @brief (non-standard feature) storage of one tuple element
+	 * @brief （非标准内容）tuple 中一个元素的存储，I 为该元素在声明中的下标
+	*/
+	template <::size_t I, typename T, bool = __is_ebo_candidate<T>::value>
+	class __tuple_leaf {
+	private:
+		T __value;
+
+	public:
+		__tuple_leaf() = default;
+
+		template <typename U, typename = typename enable_if<
+			!is_same<typename decay<U>::type, __tuple_leaf>::value
+		>::type>
+		constexpr explicit __tuple_leaf(U&& value): __value(__MY_NAMESPACE::forward<U>(value)) {}
+
+		__CONSTEXPR14 T& __get() noexcept { return __value; }
+		constexpr const T& __get() const noexcept { return __value; }
+	};
+
+	// 空且非 final 的元素作为基类存储，不占用空间
+	template <::size_t I, typename T>
+	class __tuple_leaf<I, T, true>: private T {
+	public:
+		__tuple_leaf() = default;
+
+		template <typename U, typename = typename enable_if<
+			!is_same<typename decay<U>::type, __tuple_leaf>::value
+		>::type>
+		constexpr explicit __tuple_leaf(U&& value): T(__MY_NAMESPACE::forward<U>(value)) {}
+
+		__CONSTEXPR14 T& __get() noexcept { return *this; }
+		constexpr const T& __get() const noexcept { return *this; }
+	};
+
+	/**
+	 * @brief (non-standard feature) decides the order in which tuple elements are laid out
+	 * @brief （非标准内容）决定 tuple 元素的存储顺序：按对齐要求从大到小排列，对齐相同时保持声明顺序
+	 * @tparam ...Aligns 各元素按声明顺序的对齐要求
+	 *
+	 * @note
+	 * 各元素的大小均为其对齐的整数倍，因此按对齐递减排列时元素之间不需要填充
+	*/
+	template <::size_t... Aligns>
+	struct __tuple_layout {
+		#if __HAS_CPP14
+		// 声明中第 index 个元素的存储位置
+		static constexpr ::size_t __slot_of(::size_t index) noexcept {
+			constexpr ::size_t aligns[] = { Aligns..., 0 };
+			::size_t slot = 0;
+			for (::size_t i = 0; i != sizeof...(Aligns); ++i) {
+				if (aligns[i] > aligns[index] || (aligns[i] == aligns[index] && i < index)) {
+					++slot;
+				}
+			}
+			return slot;
+		}
+
+		// 存储位置 slot 上元素在声明中的下标
+		static constexpr ::size_t __index_at(::size_t slot) noexcept {
+			for (::size_t i = 0; i != sizeof...(Aligns); ++i) {
+				if (__slot_of(i) == slot) {
+					return i;
+				}
+			}
+			return slot;
+		}
+		#else // ^^^ __HAS_CPP14 / vvv !__HAS_CPP14
+		// 无法在常量表达式中排序时按声明顺序存储
+		static constexpr ::size_t __index_at(::size_t slot) noexcept {
+			return slot;
+		}
+		#endif // __HAS_CPP14
+	};
+
+	template <typename Layout, typename Seq>
+	struct __tuple_storage_order;
+
+	template <typename Layout, ::size_t... Slots>
+	struct __tuple_storage_order<Layout, index_sequence<Slots...>> {
+		using type = index_sequence<Layout::__index_at(Slots)...>;
+	};
+
+	// 按存储顺序排列的元素下标
+	template <typename... Types>
+	using __tuple_storage_sequence = typename __tuple_storage_order<
+		__tuple_layout<alignof(__tuple_leaf<0, Types>)...>, index_sequence_for<Types...>
+	>::type;
+
+	/**
+	 * @brief (non-standard feature) forwarding references to constructor arguments, indexed by position
+	 * @brief （非标准内容）按位置保存构造实参的转发引用，元素按存储顺序构造时以下标一步取出对应实参
+	*/
+	template <::size_t I, typename T>
+	struct __tuple_arg {
+		T&& __value;
+	};
+
+	template <typename Seq, typename... Ts>
+	struct __tuple_args;
+
+	template <::size_t... Is, typename... Ts>
+	struct __tuple_args<index_sequence<Is...>, Ts...>: __tuple_arg<Is, Ts>... {
+		constexpr explicit __tuple_args(Ts&&... args): __tuple_arg<Is, Ts>{ __MY_NAMESPACE::forward<Ts>(args) }... {}
+	};
+
+	template <::size_t I, typename T>
+	constexpr T&& __forward_tuple_arg(const __tuple_arg<I, T>& arg) noexcept {
+		return __MY_NAMESPACE::forward<T>(arg.__value);
+	}
+
+	// 以实参构造各元素
+	struct __tuple_from_args_tag {};
+	// 以另一个 tuple 或 pair 的对应元素构造各元素
+	struct __tuple_from_tuple_tag {};
+
+	template <::size_t I, typename... Us>
+	constexpr const typename type_at<I, type_list<Us...>>::type& __tuple_source_get(const tuple<Us...>& source) noexcept {
+		return source.template __get<I>();
+	}
+
+	template <::size_t I, typename... Us>
+	constexpr typename type_at<I, type_list<Us...>>::type&& __tuple_source_get(tuple<Us...>&& source) noexcept {
+		return __MY_NAMESPACE::forward<typename type_at<I, type_list<Us...>>::type>(source.template __get<I>());
+	}
+
+	template <::size_t I, typename U1, typename U2>
+	constexpr const typename tuple_element<I, pair<U1, U2>>::type& __tuple_source_get(const pair<U1, U2>& source) noexcept {
+		return __pair_get<I>::get(source);
+	}
+
+	template <::size_t I, typename U1, typename U2>
+	__CONSTEXPR14 typename tuple_element<I, pair<U1, U2>>::type&& __tuple_source_get(pair<U1, U2>&& source) noexcept {
+		return __MY_NAMESPACE::forward<typename tuple_element<I, pair<U1, U2>>::type>(__pair_get<I>::get(source));
+	}
+
+	/**
+	 * @brief (non-standard feature) all the leaves of a tuple, inherited in storage order
+	 * @brief （非标准内容）tuple 的全部元素，以存储顺序平铺继承，每个元素一个基类，不递归嵌套
+	*/
+	template <typename StorageSeq, typename... Types>
+	struct __tuple_storage;
+
+	template <::size_t... Ss, typename... Types>
+	struct __tuple_storage<index_sequence<Ss...>, Types...>
+		: __tuple_leaf<Ss, typename type_at<Ss, type_list<Types...>>::type>... {
+		__tuple_storage() = default;
+
+		template <typename... Us>
+		constexpr __tuple_storage(__tuple_from_args_tag, const __tuple_args<index_sequence_for<Us...>, Us...>& args)
+			: __tuple_leaf<Ss, typename type_at<Ss, type_list<Types...>>::type>(__forward_tuple_arg<Ss>(args))... {}
+
+		template <typename Source>
+		constexpr __tuple_storage(__tuple_from_tuple_tag, Source&& source)
+			: __tuple_leaf<Ss, typename type_at<Ss, type_list<Types...>>::type>(
+				__tuple_source_get<Ss>(__MY_NAMESPACE::forward<Source>(source))
+			)... {}
+	};
+
+	/**
+	 * @brief (non-standard feature) assignment of tuple elements
+	 * @brief （非标准内容）tuple 的赋值
+	 *
+	 * @note
+	 * 元素均不是引用时，复制与移动赋值为默认的逐元素赋值，元素可平凡赋值时 tuple 也可平凡赋值；
+	 * 含引用元素时，经由引用为所引用的对象赋值
+	*/
+	template <typename Storage, bool HasReference, typename... Types>
+	struct __tuple_assign: Storage {
+		using Storage::Storage;
+	};
+
+	template <typename Storage, typename... Types>
+	struct __tuple_assign<Storage, true, Types...>: Storage {
+		using Storage::Storage;
+
+		__tuple_assign() = default;
+		__tuple_assign(const __tuple_assign&) = default;
+		__tuple_assign(__tuple_assign&&) = default;
+
+		__CONSTEXPR14 __tuple_assign& operator=(const __tuple_assign& other) {
+			__assign(other, index_sequence_for<Types...>());
+			return *this;
+		}
+
+		__CONSTEXPR14 __tuple_assign& operator=(__tuple_assign&& other) noexcept(
+			__all_true<is_nothrow_assignable<Types&, Types>::value...>::value
+		) {
+			__move_assign(other, index_sequence_for<Types...>());
+			return *this;
+		}
+
+	private:
+		template <::size_t I>
+		using __leaf = __tuple_leaf<I, typename type_at<I, type_list<Types...>>::type>;
+
+		template <::size_t... Is>
+		__CONSTEXPR14 void __assign(const __tuple_assign& other, index_sequence<Is...>) {
+			(void)::std::initializer_list<int>{ 0, (
+				static_cast<__leaf<Is>&>(*this).__get() = static_cast<const __leaf<Is>&>(other).__get(), 0
+			)... };
+		}
+
+		template <::size_t... Is>
+		__CONSTEXPR14 void __move_assign(__tuple_assign& other, index_sequence<Is...>) {
+			(void)::std::initializer_list<int>{ 0, (
+				static_cast<__leaf<Is>&>(*this).__get() = __MY_NAMESPACE::forward<Types>(static_cast<__leaf<Is>&>(other).__get()), 0
+			)... };
+		}
+	};
+
+	template <typename... Types>
+	using __tuple_base = __tuple_assign<
+		__tuple_storage<__tuple_storage_sequence<Types...>, Types...>,
+		!__all_false<is_reference<Types>::value...>::value,
+		Types...
+	>;
+
+	// 两组类型个数不同时为 false，否则逐个检查
+	template <typename TList, typename UList, bool = TList::size() == UList::size()>
+	struct __tuple_constructible: false_type {};
+
+	template <typename... Ts, typename... Us>
+	struct __tuple_constructible<type_list<Ts...>, type_list<Us...>, true>: __all_true<is_constructible<Ts, Us>::value...> {};
+
+	template <typename TList, typename UList, bool = TList::size() == UList::size()>
+	struct __tuple_convertible: false_type {};
+
+	template <typename... Ts, typename... Us>
+	struct __tuple_convertible<type_list<Ts...>, type_list<Us...>, true>: __all_true<is_convertible<Us, Ts>::value...> {};
+
+	template <typename TList, typename UList, bool = TList::size() == UList::size()>
+	struct __tuple_assignable: false_type {};
+
+	template <typename... Ts, typename... Us>
+	struct __tuple_assignable<type_list<Ts...>, type_list<Us...>, true>: __all_true<is_assignable<Ts&, Us>::value...> {};
+
+	// 单个实参恰为 tuple 自身时应使用复制或移动构造
+	template <typename Tuple, typename... Us>
+	struct __tuple_is_self: false_type {};
+
+	template <typename Tuple, typename U>
+	struct __tuple_is_self<Tuple, U>: is_same<typename remove_cv<typename remove_reference<U>::type>::type, Tuple> {};
+
+	// 以 tuple<Us...> 构造 tuple<Ts...>：单元素时若 T 能直接由源 tuple 构造则不使用逐元素转换
+	template <typename TList, typename Source, typename UList>
+	struct __tuple_convert_ok: true_type {};
+
+	template <typename T, typename Source, typename U>
+	struct __tuple_convert_ok<type_list<T>, Source, type_list<U>>: integral_constant<
+		bool,
+		!is_same<T, U>::value && !is_convertible<Source, T>::value && !is_constructible<T, Source>::value
+	> {};
+
+	template <typename T>
+	struct __tuple_nothrow_swappable: integral_constant<bool, noexcept(__swap_adl(declval<T&>(), declval<T&>()))> {};
+	__INNER_END
+
+	/**
+	 * @brief implements fixed size container, which holds elements of possibly different types
+	 * @brief 固定大小的异类值的汇集
+	 * @tparam ...Types 各元素的类型
+	 *
+	 * @note
+	 * 元素在内部按对齐要求从大到小存储以消除填充（如 tuple<char, double, char, int> 占用 16 字节而非 24 字节），
+	 * get<I> 等接口仍使用声明顺序；空且非 final 的元素类型经由空基类优化存储，不占用空间
+	 * 每个元素对应一个平铺的基类，get<I> 以下标一步定位元素，实例化深度与元素个数无关
+	 * 复制、移动构造与赋值、析构均为默认，元素均可平凡复制时 tuple 同样可平凡复制；
+	 * 与 pair 相同，值初始化时元素被清零，而默认初始化时平凡的元素不被初始化
+	*/
+	template <typename... Types>
+	class tuple: private __INNER_NAMESPACE::__tuple_base<Types...> {
+	private:
+		using __base = __INNER_NAMESPACE::__tuple_base<Types...>;
+		using __types = type_list<Types...>;
+
+		template <::size_t I>
+		using __leaf = __INNER_NAMESPACE::__tuple_leaf<I, typename type_at<I, __types>::type>;
+
+		template <typename... Us>
+		using __constructible = __INNER_NAMESPACE::__tuple_constructible<__types, type_list<Us...>>;
+
+		template <typename... Us>
+		using __convertible = __INNER_NAMESPACE::__tuple_convertible<__types, type_list<Us...>>;
+
+		template <typename... Us>
+		using __assignable = __INNER_NAMESPACE::__tuple_assignable<__types, type_list<Us...>>;
+
+		template <typename Source, typename... Us>
+		using __convert_ok = __INNER_NAMESPACE::__tuple_convert_ok<__types, Source, type_list<Us...>>;
+
+		template <typename... Us>
+		constexpr explicit tuple(__INNER_NAMESPACE::__tuple_from_args_tag tag, Us&&... args)
+			: __base(tag, __INNER_NAMESPACE::__tuple_args<index_sequence_for<Us...>, Us...>(__MY_NAMESPACE::forward<Us>(args)...)) {}
+
+		template <typename Source>
+		constexpr explicit tuple(__INNER_NAMESPACE::__tuple_from_tuple_tag tag, Source&& source)
+			: __base(tag, __MY_NAMESPACE::forward<Source>(source)) {}
+
+		template <::size_t... Is>
+		__CONSTEXPR14 void __swap(tuple& other, index_sequence<Is...>) {
+			(void)::std::initializer_list<int>{ 0, (__INNER_NAMESPACE::__swap_adl(__get<Is>(), other.template __get<Is>()), 0)... };
+		}
+
+		template <typename Source, ::size_t... Is>
+		__CONSTEXPR14 void __assign_from(Source&& source, index_sequence<Is...>) {
+			(void)::std::initializer_list<int>{ 0, (
+				__get<Is>() = __INNER_NAMESPACE::__tuple_source_get<Is>(__MY_NAMESPACE::forward<Source>(source)), 0
+			)... };
+		}
+
+	public:
+		// https://zh.cppreference.com/w/cpp/utility/tuple/tuple
+
+		tuple() = default;
+
+		template <typename List = __types, typename enable_if<
+			__INNER_NAMESPACE::__tuple_constructible<List, type_list<const Types&...>>::value &&
+			__INNER_NAMESPACE::__tuple_convertible<List, type_list<const Types&...>>::value, int
+		>::type = 0>
+		constexpr tuple(const Types&... args): tuple(__INNER_NAMESPACE::__tuple_from_args_tag(), args...) {}
+
+		template <typename List = __types, typename enable_if<
+			__INNER_NAMESPACE::__tuple_constructible<List, type_list<const Types&...>>::value &&
+			!__INNER_NAMESPACE::__tuple_convertible<List, type_list<const Types&...>>::value, int
+		>::type = 0>
+		constexpr explicit tuple(const Types&... args): tuple(__INNER_NAMESPACE::__tuple_from_args_tag(), args...) {}
+
+		template <typename... Us, typename enable_if<
+			!__INNER_NAMESPACE::__tuple_is_self<tuple, Us...>::value &&
+			__constructible<Us&&...>::value && __convertible<Us&&...>::value, int
+		>::type = 0>
+		constexpr tuple(Us&&... args): tuple(__INNER_NAMESPACE::__tuple_from_args_tag(), __MY_NAMESPACE::forward<Us>(args)...) {}
+
+		template <typename... Us, typename enable_if<
+			!__INNER_NAMESPACE::__tuple_is_self<tuple, Us...>::value &&
+			__constructible<Us&&...>::value && !__convertible<Us&&...>::value, int
+		>::type = 0>
+		constexpr explicit tuple(Us&&... args): tuple(__INNER_NAMESPACE::__tuple_from_args_tag(), __MY_NAMESPACE::forward<Us>(args)...) {}
+
+		template <typename... Us, typename enable_if<
+			__constructible<const Us&...>::value && __convert_ok<const tuple<Us...>&, Us...>::value &&
+			__convertible<const Us&...>::value, int
+		>::type = 0>
+		constexpr tuple(const tuple<Us...>& other): tuple(__INNER_NAMESPACE::__tuple_from_tuple_tag(), other) {}
+
+		template <typename... Us, typename enable_if<
+			__constructible<const Us&...>::value && __convert_ok<const tuple<Us...>&, Us...>::value &&
+			!__convertible<const Us&...>::value, int
+		>::type = 0>
+		constexpr explicit tuple(const tuple<Us...>& other): tuple(__INNER_NAMESPACE::__tuple_from_tuple_tag(), other) {}
+
+		template <typename... Us, typename enable_if<
+			__constructible<Us&&...>::value && __convert_ok<tuple<Us...>&&, Us...>::value &&
+			__convertible<Us&&...>::value, int
+		>::type = 0>
+		constexpr tuple(tuple<Us...>&& other): tuple(__INNER_NAMESPACE::__tuple_from_tuple_tag(), __MY_NAMESPACE::move(other)) {}
+
+		template <typename... Us, typename enable_if<
+			__constructible<Us&&...>::value && __convert_ok<tuple<Us...>&&, Us...>::value &&
+			!__convertible<Us&&...>::value, int
+		>::type = 0>
+		constexpr explicit tuple(tuple<Us...>&& other): tuple(__INNER_NAMESPACE::__tuple_from_tuple_tag(), __MY_NAMESPACE::move(other)) {}
+
+		template <typename U1, typename U2, typename enable_if<
+			__constructible<const U1&, const U2&>::value && __convertible<const U1&, const U2&>::value, int
+		>::type = 0>
+		constexpr tuple(const pair<U1, U2>& other): tuple(__INNER_NAMESPACE::__tuple_from_tuple_tag(), other) {}
+
+		template <typename U1, typename U2, typename enable_if<
+			__constructible<const U1&, const U2&>::value && !__convertible<const U1&, const U2&>::value, int
+		>::type = 0>
+		constexpr explicit tuple(const pair<U1, U2>& other): tuple(__INNER_NAMESPACE::__tuple_from_tuple_tag(), other) {}
+
+		template <typename U1, typename U2, typename enable_if<
+			__constructible<U1&&, U2&&>::value && __convertible<U1&&, U2&&>::value, int
+		>::type = 0>
+		constexpr tuple(pair<U1, U2>&& other): tuple(__INNER_NAMESPACE::__tuple_from_tuple_tag(), __MY_NAMESPACE::move(other)) {}
+
+		template <typename U1, typename U2, typename enable_if<
+			__constructible<U1&&, U2&&>::value && !__convertible<U1&&, U2&&>::value, int
+		>::type = 0>
+		constexpr explicit tuple(pair<U1, U2>&& other): tuple(__INNER_NAMESPACE::__tuple_from_tuple_tag(), __MY_NAMESPACE::move(other)) {}
+
+		tuple(const tuple& other) = default;
+		tuple(tuple&& other) = default;
+
+		tuple& operator=(const tuple& other) = default;
+		tuple& operator=(tuple&& other) = default;
+
+		template <typename... Us, typename = typename enable_if<
+			!is_same<tuple, tuple<Us...>>::value && __assignable<const Us&...>::value
+		>::type>
+		__CONSTEXPR14 tuple& operator=(const tuple<Us...>& other) {
+			__assign_from(other, index_sequence_for<Types...>());
+			return *this;
+		}
+
+		template <typename... Us, typename = typename enable_if<
+			!is_same<tuple, tuple<Us...>>::value && __assignable<Us&&...>::value
+		>::type>
+		__CONSTEXPR14 tuple& operator=(tuple<Us...>&& other) {
+			__assign_from(__MY_NAMESPACE::move(other), index_sequence_for<Types...>());
+			return *this;
+		}
+
+		template <typename U1, typename U2, typename = typename enable_if<
+			__assignable<const U1&, const U2&>::value
+		>::type>
+		__CONSTEXPR14 tuple& operator=(const pair<U1, U2>& other) {
+			__assign_from(other, index_sequence_for<Types...>());
+			return *this;
+		}
+
+		template <typename U1, typename U2, typename = typename enable_if<
+			__assignable<U1&&, U2&&>::value
+		>::type>
+		__CONSTEXPR14 tuple& operator=(pair<U1, U2>&& other) {
+			__assign_from(__MY_NAMESPACE::move(other), index_sequence_for<Types...>());
+			return *this;
+		}
+
+		/**
+		 * @brief swaps the contents of two tuples
+		 * @brief 交换两个 tuple 的内容
+		*/
+		__CONSTEXPR20 void swap(tuple& other) noexcept(
+			__INNER_NAMESPACE::__all_true<__INNER_NAMESPACE::__tuple_nothrow_swappable<Types>::value...>::value
+		) {
+			__swap(other, index_sequence_for<Types...>());
+		}
+
+		/**
+		 * @brief (non-standard feature) accesses the I-th element, use get<I> instead
+		 * @brief （非标准内容）访问第 I 个元素，应使用 get<I>
+		*/
+		template <::size_t I>
+		__CONSTEXPR14 typename type_at<I, __types>::type& __get() noexcept {
+			return static_cast<__leaf<I>&>(*this).__get();
+		}
+
+		template <::size_t I>
+		constexpr const typename type_at<I, __types>::type& __get() const noexcept {
+			return static_cast<const __leaf<I>&>(*this).__get();
+		}
+	};
+
+	template <>
+	class tuple<> {
+	public:
+		__CONSTEXPR20 void swap(tuple&) noexcept {}
+	};
+
+	#if __HAS_CPP17
+	template <typename... Types>
+	tuple(Types...) -> tuple<Types...>;
+
+	template <typename T1, typename T2>
+	tuple(pair<T1, T2>) -> tuple<T1, T2>;
+	#endif // __HAS_CPP17
+
+	template <typename... Types>
+	struct tuple_size<tuple<Types...>>: integral_constant<::size_t, sizeof...(Types)> {};
+
+	template <::size_t I, typename... Types>
+	struct tuple_element<I, tuple<Types...>>: type_at<I, type_list<Types...>> {};
+
+	/**
+	 * @brief accesses the I-th element of a tuple
+	 * @brief 访问 tuple 的第 I 个元素
+	*/
+	template <::size_t I, typename... Types>
+	__NODISCARD __CONSTEXPR14 typename tuple_element<I, tuple<Types...>>::type& get(tuple<Types...>& t) noexcept {
+		return t.template __get<I>();
+	}
+
+	template <::size_t I, typename... Types>
+	__NODISCARD constexpr const typename tuple_element<I, tuple<Types...>>::type& get(const tuple<Types...>& t) noexcept {
+		return t.template __get<I>();
+	}
+
+	template <::size_t I, typename... Types>
+	__NODISCARD __CONSTEXPR14 typename tuple_element<I, tuple<Types...>>::type&& get(tuple<Types...>&& t) noexcept {
+		return __MY_NAMESPACE::forward<typename tuple_element<I, tuple<Types...>>::type>(t.template __get<I>());
+	}
+
+	template <::size_t I, typename... Types>
+	__NODISCARD constexpr const typename tuple_element<I, tuple<Types...>>::type&& get(const tuple<Types...>&& t) noexcept {
+		return static_cast<const typename tuple_element<I, tuple<Types...>>::type&&>(t.template __get<I>());
+	}
+
+	__INNER_BEGIN
+	template <typename T, ::size_t I>
+	integral_constant<::size_t, I> __select_indexed_index(const __indexed_type<I, T>&);
+
+	// T 在 Types 中恰好出现一次时为其下标，T 不存在或出现多次时推导失败
+	template <typename T, typename... Types>
+	struct __tuple_index_of_unique: decltype(
+		__select_indexed_index<T>(declval<__indexed_types<index_sequence_for<Types...>, Types...>>())
+	) {};
+	__INNER_END
+
+	template <typename T, typename... Types>
+	__NODISCARD __CONSTEXPR14 T& get(tuple<Types...>& t) noexcept {
+		return t.template __get<__INNER_NAMESPACE::__tuple_index_of_unique<T, Types...>::value>();
+	}
+
+	template <typename T, typename... Types>
+	__NODISCARD constexpr const T& get(const tuple<Types...>& t) noexcept {
+		return t.template __get<__INNER_NAMESPACE::__tuple_index_of_unique<T, Types...>::value>();
+	}
+
+	template <typename T, typename... Types>
+	__NODISCARD __CONSTEXPR14 T&& get(tuple<Types...>&& t) noexcept {
+		return __MY_NAMESPACE::forward<T>(t.template __get<__INNER_NAMESPACE::__tuple_index_of_unique<T, Types...>::value>());
+	}
+
+	template <typename T, typename... Types>
+	__NODISCARD constexpr const T&& get(const tuple<Types...>&& t) noexcept {
+		return static_cast<const T&&>(t.template __get<__INNER_NAMESPACE::__tuple_index_of_unique<T, Types...>::value>());
+	}
+
+	template <typename... Types>
+	__CONSTEXPR20 void swap(tuple<Types...>& lhs, tuple<Types...>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+		lhs.swap(rhs);
+	}
+
+	// 各元素都可平凡重定位时，tuple 可平凡重定位
+	template <typename... Types>
+	struct is_trivially_relocatable<tuple<Types...>>:
+		__INNER_NAMESPACE::__all_true<is_trivially_relocatable<Types>::value...> {};
+
+	__INNER_BEGIN
+	struct __ignore_t {
+		template <typename T>
+		__CONSTEXPR14 const __ignore_t& operator=(T&&) const noexcept {
+			return *this;
+		}
+	};
+	__INNER_END
+
+	/**
+	 * @brief placeholder to skip an element when unpacking a tuple using tie
+	 * @brief 用 tie 解包 tuple 时用来跳过元素的占位符
+	*/
+	__INLINE17 constexpr __INNER_NAMESPACE::__ignore_t ignore{};
+
+	/**
+	 * @brief creates a tuple object of the type defined by the argument types
+	 * @brief 创建 tuple 对象，其类型由实参类型退化得到
+	*/
+	template <typename... Types>
+	__NODISCARD constexpr tuple<typename decay<Types>::type...> make_tuple(Types&&... args) {
+		return tuple<typename decay<Types>::type...>(__MY_NAMESPACE::forward<Types>(args)...);
+	}
+
+	/**
+	 * @brief creates a tuple of lvalue references or unpacks a tuple into individual objects
+	 * @brief 创建左值引用的 tuple，或将 tuple 解包为独立对象
+	*/
+	template <typename... Types>
+	__NODISCARD constexpr tuple<Types&...> tie(Types&... args) noexcept {
+		return tuple<Types&...>(args...);
+	}
+
+	/**
+	 * @brief creates a tuple of forwarding references
+	 * @brief 创建转发引用的 tuple
+	*/
+	template <typename... Types>
+	__NODISCARD constexpr tuple<Types&&...> forward_as_tuple(Types&&... args) noexcept {
+		return tuple<Types&&...>(__MY_NAMESPACE::forward<Types>(args)...);
+	}
+
+	#if __HAS_CPP20
+	__INNER_BEGIN
+	// 各元素都可按位比较且没有填充时，整个 tuple 可按位比较，元素的存储顺序不影响相等性
+	template <typename... Ts, typename... Us>
+	struct __is_bitwise_equality_comparable<tuple<Ts...>, tuple<Us...>>: integral_constant<
+		bool,
+		sizeof...(Ts) == sizeof...(Us) && sizeof...(Ts) != 0 &&
+		__all_true<__is_bitwise_equality_comparable<Ts, Us>::value...>::value &&
+		sizeof(tuple<Ts...>) == (sizeof(Ts) + ... + 0)
+	> {};
+
+	// 单字节的元素对齐均为 1，存储顺序与声明顺序一致，memcmp 的结果即字典序
+	template <typename... Ts, typename... Us>
+	struct __is_byte_comparable<tuple<Ts...>, tuple<Us...>>: integral_constant<
+		bool,
+		sizeof...(Ts) == sizeof...(Us) && sizeof...(Ts) != 0 &&
+		__all_true<__is_byte_comparable<Ts, Us>::value...>::value &&
+		sizeof(tuple<Ts...>) == sizeof...(Ts)
+	> {};
+
+	template <typename Tuple1, typename Tuple2, ::size_t... Is>
+	constexpr bool __tuple_equal(const Tuple1& lhs, const Tuple2& rhs, index_sequence<Is...>) {
+		return (static_cast<bool>(__MY_NAMESPACE::get<Is>(lhs) == __MY_NAMESPACE::get<Is>(rhs)) && ...);
+	}
+
+	template <typename Result, typename Tuple1, typename Tuple2, ::size_t... Is>
+	constexpr Result __tuple_three_way(const Tuple1& lhs, const Tuple2& rhs, index_sequence<Is...>) {
+		Result order = Result::equivalent;
+		(void)((order = __synth_three_way(__MY_NAMESPACE::get<Is>(lhs), __MY_NAMESPACE::get<Is>(rhs)), order == 0) && ...);
+		return order;
+	}
+	__INNER_END
+
+	/**
+	 * @brief lexicographically compares the values in the tuple
+	 * @brief 按字典序比较两个 tuple
+	*/
+	template <typename... Ts, typename... Us>
+	__NODISCARD constexpr bool operator==(const tuple<Ts...>& lhs, const tuple<Us...>& rhs) {
+		static_assert(sizeof...(Ts) == sizeof...(Us), "cannot compare tuples of different sizes");
+		if constexpr (__INNER_NAMESPACE::__is_bitwise_equality_comparable<tuple<Ts...>, tuple<Us...>>::value) {
+			if (!__builtin_is_constant_evaluated()) {
+				return __INNER_NAMESPACE::__bytes_equal(&lhs, &rhs, sizeof(tuple<Ts...>));
+			}
+		}
+		return __INNER_NAMESPACE::__tuple_equal(lhs, rhs, index_sequence_for<Ts...>());
+	}
+
+	/**
+	 * @brief compares the tuple with a single pass of synth-three-way per element
+	 * @brief 对每个元素只进行一次 synth-three-way，在第一个不等价的元素处得出结果
+	*/
+	template <typename... Ts, typename... Us>
+	__NODISCARD constexpr common_comparison_category_t<__INNER_NAMESPACE::__synth_three_way_result<const Ts, const Us>...>
+	operator<=>(const tuple<Ts...>& lhs, const tuple<Us...>& rhs) {
+		using result_type = common_comparison_category_t<__INNER_NAMESPACE::__synth_three_way_result<const Ts, const Us>...>;
+		if constexpr (__INNER_NAMESPACE::__is_byte_comparable<tuple<Ts...>, tuple<Us...>>::value) {
+			if (!__builtin_is_constant_evaluated()) {
+				return __INNER_NAMESPACE::__bytes_compare(&__MY_NAMESPACE::get<0>(lhs), &__MY_NAMESPACE::get<0>(rhs), sizeof...(Ts));
+			}
+		}
+		return __INNER_NAMESPACE::__tuple_three_way<result_type>(lhs, rhs, index_sequence_for<Ts...>());
+	}
+	#else // ^^^ __HAS_CPP20 / vvv !__HAS_CPP20
+	__INNER_BEGIN
+	template <typename Tuple1, typename Tuple2, ::size_t... Is>
+	__CONSTEXPR14 bool __tuple_equal(const Tuple1& lhs, const Tuple2& rhs, index_sequence<Is...>) {
+		bool equal = true;
+		(void)::std::initializer_list<int>{ 0, (
+			equal = equal && static_cast<bool>(__MY_NAMESPACE::get<Is>(lhs) == __MY_NAMESPACE::get<Is>(rhs)), 0
+		)... };
+		return equal;
+	}
+
+	// 在第一个不相等的元素处得出结果，之后的元素不再比较
+	template <typename Tuple1, typename Tuple2, ::size_t... Is>
+	__CONSTEXPR14 bool __tuple_less(const Tuple1& lhs, const Tuple2& rhs, index_sequence<Is...>) {
+		int order = 0;
+		(void)::std::initializer_list<int>{ 0, (
+			order = order != 0 ? order :
+				__MY_NAMESPACE::get<Is>(lhs) < __MY_NAMESPACE::get<Is>(rhs) ? -1 :
+				__MY_NAMESPACE::get<Is>(rhs) < __MY_NAMESPACE::get<Is>(lhs) ? 1 : 0, 0
+		)... };
+		return order < 0;
+	}
+	__INNER_END
+
+	/**
+	 * @brief lexicographically compares the values in the tuple
+	 * @brief 按字典序比较两个 tuple
+	*/
+	template <typename... Ts, typename... Us>
+	__NODISCARD __CONSTEXPR14 bool operator==(const tuple<Ts...>& lhs, const tuple<Us...>& rhs) {
+		static_assert(sizeof...(Ts) == sizeof...(Us), "cannot compare tuples of different sizes");
+		return __INNER_NAMESPACE::__tuple_equal(lhs, rhs, index_sequence_for<Ts...>());
+	}
+
+	template <typename... Ts, typename... Us>
+	__NODISCARD __CONSTEXPR14 bool operator!=(const tuple<Ts...>& lhs, const tuple<Us...>& rhs) {
+		return !(lhs == rhs);
+	}
+
+	template <typename... Ts, typename... Us>
+	__NODISCARD __CONSTEXPR14 bool operator<(const tuple<Ts...>& lhs, const tuple<Us...>& rhs) {
+		static_assert(sizeof...(Ts) == sizeof...(Us), "cannot compare tuples of different sizes");
+		return __INNER_NAMESPACE::__tuple_less(lhs, rhs, index_sequence_for<Ts...>());
+	}
+
+	template <typename... Ts, typename... Us>
+	__NODISCARD __CONSTEXPR14 bool operator>(const tuple<Ts...>& lhs, const tuple<Us...>& rhs) {
+		return rhs < lhs;
+	}
+
+	template <typename... Ts, typename... Us>
+	__NODISCARD __CONSTEXPR14 bool operator<=(const tuple<Ts...>& lhs, const tuple<Us...>& rhs) {
+		return !(rhs < lhs);
+	}
+
+	template <typename... Ts, typename... Us>
+	__NODISCARD __CONSTEXPR14 bool operator>=(const tuple<Ts...>& lhs, const tuple<Us...>& rhs) {
+		return !(lhs < rhs);
+	}
+	#endif // __HAS_CPP20
+	#pragma endregion tuple
+
+	#pragma region tuple_cat apply make_from_tuple
+	__INNER_BEGIN
+	/**
+	 * @brief (non-standard feature) maps each element of the concatenated tuple to its source
+	 * @brief （非标准内容）将拼接结果中的每个元素映射到其来源：第几个 tuple 中的第几个元素
+	 * @tparam ...Sizes 各个被拼接 tuple 的大小
+	*/
+	template <::size_t... Sizes>
+	struct __tuple_cat_layout {
+		static constexpr ::size_t __total() noexcept {
+			constexpr ::size_t sizes[] = { Sizes..., 0 };
+			::size_t total = 0;
+			for (::size_t i = 0; i != sizeof...(Sizes); ++i) {
+				total += sizes[i];
+			}
+			return total;
+		}
+
+		// 结果中第 index 个元素来自第几个 tuple
+		static constexpr ::size_t __outer(::size_t index) noexcept {
+			constexpr ::size_t sizes[] = { Sizes..., 0 };
+			::size_t outer = 0;
+			while (index >= sizes[outer]) {
+				index -= sizes[outer];
+				++outer;
+			}
+			return outer;
+		}
+
+		// 结果中第 index 个元素是其所在 tuple 的第几个元素
+		static constexpr ::size_t __inner(::size_t index) noexcept {
+			constexpr ::size_t sizes[] = { Sizes..., 0 };
+			::size_t outer = 0;
+			while (index >= sizes[outer]) {
+				index -= sizes[outer];
+				++outer;
+			}
+			return index;
+		}
+	};
+
+	template <typename Layout, typename Seq>
+	struct __tuple_cat_indices;
+
+	template <typename Layout, ::size_t... Is>
+	struct __tuple_cat_indices<Layout, index_sequence<Is...>> {
+		using outer = index_sequence<Layout::__outer(Is)...>;
+		using inner = index_sequence<Layout::__inner(Is)...>;
+	};
+
+	template <typename TupleList, typename Outer, typename Inner>
+	struct __tuple_cat_result;
+
+	template <typename TupleList, ::size_t... Outer, ::size_t... Inner>
+	struct __tuple_cat_result<TupleList, index_sequence<Outer...>, index_sequence<Inner...>> {
+		using type = tuple<typename tuple_element<Inner, typename type_at<Outer, TupleList>::type>::type...>;
+	};
+
+	// 每个元素的来源一次算出，实例化次数与元素总数成线性关系，不逐个 tuple 递归拼接
+	template <typename... Tuples>
+	struct __tuple_cat_traits {
+		using __layout = __tuple_cat_layout<tuple_size<Tuples>::value...>;
+		using __indices = __tuple_cat_indices<__layout, make_index_sequence<__layout::__total()>>;
+		using outer = typename __indices::outer;
+		using inner = typename __indices::inner;
+		using type = typename __tuple_cat_result<type_list<Tuples...>, outer, inner>::type;
+	};
+
+	template <typename Result, typename Refs, ::size_t... Outer, ::size_t... Inner>
+	__CONSTEXPR14 Result __tuple_cat(Refs&& refs, index_sequence<Outer...>, index_sequence<Inner...>) {
+		return Result(__MY_NAMESPACE::get<Inner>(__MY_NAMESPACE::get<Outer>(__MY_NAMESPACE::move(refs)))...);
+	}
+	__INNER_END
+
+	/**
+	 * @brief creates a tuple by concatenating any number of tuples
+	 * @brief 拼接任意个 tuple（或 pair）得到一个 tuple
+	*/
+	template <typename... Tuples>
+	__NODISCARD __CONSTEXPR14 typename __INNER_NAMESPACE::__tuple_cat_traits<typename decay<Tuples>::type...>::type
+	tuple_cat(Tuples&&... tuples) {
+		using __traits = __INNER_NAMESPACE::__tuple_cat_traits<typename decay<Tuples>::type...>;
+		return __INNER_NAMESPACE::__tuple_cat<typename __traits::type>(
+			__MY_NAMESPACE::forward_as_tuple(__MY_NAMESPACE::forward<Tuples>(tuples)...),
+			typename __traits::outer(), typename __traits::inner()
+		);
+	}
+
+	__INNER_BEGIN
+	template <typename F, typename Tuple, ::size_t... Is>
+	constexpr auto __apply(F&& f, Tuple&& t, index_sequence<Is...>)
+		-> decltype(__MY_NAMESPACE::forward<F>(f)(__MY_NAMESPACE::get<Is>(__MY_NAMESPACE::forward<Tuple>(t))...)) {
+		return __MY_NAMESPACE::forward<F>(f)(__MY_NAMESPACE::get<Is>(__MY_NAMESPACE::forward<Tuple>(t))...);
+	}
+
+	template <typename T, typename Tuple, ::size_t... Is>
+	constexpr T __make_from_tuple(Tuple&& t, index_sequence<Is...>) {
+		return T(__MY_NAMESPACE::get<Is>(__MY_NAMESPACE::forward<Tuple>(t))...);
+	}
+	__INNER_END
+
+	/**
+	 * @brief calls a function object with a tuple of arguments
+	 * @brief 以 tuple 中的元素为实参调用函数对象
+	 *
+	 * @note
+	 * 直接以 f(args...) 调用，不支持成员指针
+	*/
+	template <typename F, typename Tuple>
+	constexpr auto apply(F&& f, Tuple&& t) -> decltype(__INNER_NAMESPACE::__apply(
+		__MY_NAMESPACE::forward<F>(f), __MY_NAMESPACE::forward<Tuple>(t),
+		make_index_sequence<tuple_size<typename remove_reference<Tuple>::type>::value>()
+	)) {
+		return __INNER_NAMESPACE::__apply(
+			__MY_NAMESPACE::forward<F>(f), __MY_NAMESPACE::forward<Tuple>(t),
+			make_index_sequence<tuple_size<typename remove_reference<Tuple>::type>::value>()
+		);
+	}
+
+	/**
+	 * @brief constructs an object with a tuple of arguments
+	 * @brief 以 tuple 中的元素为实参构造 T 类型的对象
+	*/
+	template <typename T, typename Tuple>
+	__NODISCARD constexpr T make_from_tuple(Tuple&& t) {
+		return __INNER_NAMESPACE::__make_from_tuple<T>(
+			__MY_NAMESPACE::forward<Tuple>(t),
+			make_index_sequence<tuple_size<typename remove_reference<Tuple>::type>::value>()
+		);
+	}
+	#pragma endregion tuple_cat apply make_from_tuple
 
 } // namespace __MY_NAMESPACE
 #endif // __HAS_CPP11
@@ -396,6 +396,18 @@ namespace __MY_NAMESPACE {
 	// (non-standard feature) checks if one type equals to any other types
 	// (非标准内容) 判断一个类型是否与后续类型之一相等
 	#pragma region is_any_of
+	__INNER_BEGIN
+	template <bool...>
+	struct __bool_pack {};
+
+	// 所有 Bs 均为 false 时，将 false 分别放在首尾得到的两个序列相同，无需递归实例化
+	template <bool... Bs>
+	struct __all_false: is_same<__bool_pack<false, Bs...>, __bool_pack<Bs..., false>> {};
+
+	template <bool... Bs>
+	struct __all_true: is_same<__bool_pack<true, Bs...>, __bool_pack<Bs..., true>> {};
+	__INNER_END
+
 	#if __HAS_CPP17
 	/**
 	 * @brief (non-standard feature) checks if one type equals to any other types
@@ -417,7 +429,7 @@ namespace __MY_NAMESPACE {
 	 * @tparam ...Ts 被判断是否包含T的类型集合
 	*/
 	template <typename T, typename... Ts>
-	inline constexpr bool is_any_of_v = is_any_of_v<T, Ts...>;
+	inline constexpr bool is_any_of_v = is_any_of<T, Ts...>::value;
 
 	#else // ^^^__HAS_CPP17 / vvv !__HAS_CPP17
 	/**
@@ -428,14 +440,8 @@ namespace __MY_NAMESPACE {
 	 * @tparam T 一个类型
 	 * @tparam ...Ts 被判断是否包含T的类型集合
 	*/
-	template <typename T, typename...>
-	struct is_any_of: integral_constant<bool, false> {};
-
-	template <typename T1, typename T2>
-	struct is_any_of<T1, T2>: is_same<T1, T2> {};
-
-	template <typename T1, typename T2, typename... Ts>
-	struct is_any_of<T1, T2, Ts...>: integral_constant<bool, is_same<T1, T2>::value || is_any_of<T1, Ts...>::value> {};
+	template <typename T, typename... Ts>
+	struct is_any_of: integral_constant<bool, !__INNER_NAMESPACE::__all_false<is_same<T, Ts>::value...>::value> {};
 	#endif // __HAS_CPP17
 	#pragma endregion is_any_of
 
@@ -482,8 +488,8 @@ namespace __MY_NAMESPACE {
 	 * @tparam Base 需要进行判断的基类类型
 	 * @tparam Derived 需要进行判断的派生类类型
 	*/
-	template <typename T>
-	inline constexpr bool is_base_of_v = is_base_of<T>::value;
+	template <typename Base, typename Derived>
+	inline constexpr bool is_base_of_v = is_base_of<Base, Derived>::value;
 	#endif // __HAS_CPP17
 	#pragma endregion is_base_of
 
@@ -827,7 +833,7 @@ namespace __MY_NAMESPACE {
 	};
 
 	template <typename T>
-	struct __try_add_reference<T, typename __void_t<T&>> {
+	struct __try_add_reference<T, __void_t<T&>> {
 		using lvalue_type = T&;
 		using rvalue_type = T&&;
 	};
@@ -974,7 +980,7 @@ namespace __MY_NAMESPACE {
 	};
 
 	template <typename T>
-	struct __try_add_pointer<T, typename __void_t<typename remove_reference<T>::type*>> {
+	struct __try_add_pointer<T, __void_t<typename remove_reference<T>::type*>> {
 		using pointer_type = typename remove_reference<T>::type*;
 	};
 	__INNER_END
@@ -1239,6 +1245,112 @@ namespace __MY_NAMESPACE {
 	#endif // __HAS_CPP17
 	#pragma endregion is_volatile
 
+	// checks if a type is a class (but not union) type and has no non-static data members
+	// 检查类型是否为无非静态数据成员的类（非联合体）类型
+	#pragma region is_empty
+	/**
+	 * @brief checks if a type is a class (but not union) type and has no non-static data members
+	 * @brief 检查类型是否为无非静态数据成员、无虚函数、无虚基类的类（非联合体）类型
+	 * @brief 包含成员 value, 表示其判断结果
+	 * 
+	 * @tparam T 需要进行判断的类型
+	*/
+	template <typename T>
+	struct is_empty: integral_constant<bool, __is_empty(T)> {};
+
+	#if __HAS_CPP17
+	/**
+	 * @brief checks if a type is a class (but not union) type and has no non-static data members
+	 * @brief 检查类型是否为无非静态数据成员、无虚函数、无虚基类的类（非联合体）类型
+	 * @brief 该常量即为判断结果
+	 * 
+	 * @tparam T 需要进行判断的类型
+	*/
+	template <typename T>
+	inline constexpr bool is_empty_v = is_empty<T>::value;
+	#endif // __HAS_CPP17
+	#pragma endregion is_empty
+
+	// checks if a type is a final class type
+	// 检查类型是否为 final 类类型
+	#pragma region is_final (>=C++14)
+	#if __HAS_CPP14
+	/**
+	 * @brief checks if a type is a final class type
+	 * @brief 检查类型是否为以 final 声明的类类型
+	 * @brief 包含成员 value, 表示其判断结果
+	 * 
+	 * @tparam T 需要进行判断的类型
+	*/
+	template <typename T>
+	struct is_final: integral_constant<bool, __is_final(T)> {};
+
+	#if __HAS_CPP17
+	/**
+	 * @brief checks if a type is a final class type
+	 * @brief 检查类型是否为以 final 声明的类类型
+	 * @brief 该常量即为判断结果
+	 * 
+	 * @tparam T 需要进行判断的类型
+	*/
+	template <typename T>
+	inline constexpr bool is_final_v = is_final<T>::value;
+	#endif // __HAS_CPP17
+	#endif // __HAS_CPP14
+	#pragma endregion is_final
+
+	// checks if a type is trivially copyable
+	// 检查类型是否可平凡复制
+	#pragma region is_trivially_copyable
+	/**
+	 * @brief checks if a type is trivially copyable
+	 * @brief 检查类型是否可平凡复制，可平凡复制的对象可以用 memcpy 复制其对象表示
+	 * @brief 包含成员 value, 表示其判断结果
+	 * 
+	 * @tparam T 需要进行判断的类型
+	*/
+	template <typename T>
+	struct is_trivially_copyable: integral_constant<bool, __is_trivially_copyable(T)> {};
+
+	#if __HAS_CPP17
+	/**
+	 * @brief checks if a type is trivially copyable
+	 * @brief 检查类型是否可平凡复制，可平凡复制的对象可以用 memcpy 复制其对象表示
+	 * @brief 该常量即为判断结果
+	 * 
+	 * @tparam T 需要进行判断的类型
+	*/
+	template <typename T>
+	inline constexpr bool is_trivially_copyable_v = is_trivially_copyable<T>::value;
+	#endif // __HAS_CPP17
+	#pragma endregion is_trivially_copyable
+
+	// checks if a type is trivial
+	// 检查类型是否为平凡类型
+	#pragma region is_trivial
+	/**
+	 * @brief checks if a type is trivial
+	 * @brief 检查类型是否为平凡类型，即可平凡复制且拥有平凡的默认构造函数
+	 * @brief 包含成员 value, 表示其判断结果
+	 * 
+	 * @tparam T 需要进行判断的类型
+	*/
+	template <typename T>
+	struct is_trivial: integral_constant<bool, __is_trivial(T)> {};
+
+	#if __HAS_CPP17
+	/**
+	 * @brief checks if a type is trivial
+	 * @brief 检查类型是否为平凡类型，即可平凡复制且拥有平凡的默认构造函数
+	 * @brief 该常量即为判断结果
+	 * 
+	 * @tparam T 需要进行判断的类型
+	*/
+	template <typename T>
+	inline constexpr bool is_trivial_v = is_trivial<T>::value;
+	#endif // __HAS_CPP17
+	#pragma endregion is_trivial
+
 
 
 	// ====================================================
@@ -2149,7 +2261,7 @@ namespace __MY_NAMESPACE {
 	 * @tparam ...Args 构造函数的特定实参
 	*/
 	template <typename T, typename... Args>
-	inline constexpr bool is_constructible_v = is_constructible<T>::value;
+	inline constexpr bool is_constructible_v = is_constructible<T, Args...>::value;
 	#endif // __HAS_CPP17
 	#pragma endregion is_constructible
 
@@ -2309,7 +2421,7 @@ namespace __MY_NAMESPACE {
 	template <typename T>
 	struct is_implicitly_default_constructible: integral_constant<
 		bool, 
-		decltype(__INNER_NAMESPACE::__is_implicitly_default_constructible<T>(0))
+		decltype(__INNER_NAMESPACE::__is_implicitly_default_constructible<T>(0))::value
 	> {};
 
 	#if __HAS_CPP17
@@ -2864,7 +2976,15 @@ namespace __MY_NAMESPACE {
 	 * @tparam T 需要检查的类型
 	*/
 	template <typename T>
-	struct is_trivially_destructible: integral_constant<bool, __is_trivially_destructible(T)> {};
+	struct is_trivially_destructible: integral_constant<
+		bool,
+		#if defined(__GNUC__) && !defined(__clang__)
+		// GCC 未提供 __is_trivially_destructible 内建函数
+		is_destructible<T>::value && __has_trivial_destructor(T)
+		#else // ^^^ GCC / vvv MSVC, Clang
+		__is_trivially_destructible(T)
+		#endif
+	> {};
 
 	#if __HAS_CPP17
 	/**
@@ -2915,6 +3035,51 @@ namespace __MY_NAMESPACE {
 
 	#pragma endregion destructible series
 
+	#pragma region is_trivially_relocatable
+
+	__INNER_BEGIN
+	template <typename T, typename = void>
+	struct __is_trivially_relocatable_impl: integral_constant<
+		bool,
+		is_trivially_move_constructible<T>::value && is_trivially_destructible<T>::value
+	> {};
+
+	// 类型以成员类型 is_trivially_relocatable 自行声明
+	template <typename T>
+	struct __is_trivially_relocatable_impl<T, __void_t<typename T::is_trivially_relocatable>>:
+		integral_constant<bool, T::is_trivially_relocatable::value> {};
+	__INNER_END
+
+	/**
+	 * @brief (non-standard feature) checks if a type can be relocated by copying its bytes
+	 * @brief （非标准内容）检查类型是否可平凡重定位，即移动构造到新位置再析构原对象，等价于逐字节复制且不再析构原对象
+	 * @brief 包含成员 type，表示检查的结果
+	 * @brief 默认为 is_trivially_move_constructible 与 is_trivially_destructible 同时成立
+	 * 
+	 * @tparam T 需要检查的类型，数组类型按其元素类型判断
+	 * 
+	 * @note 不满足默认条件但可以逐字节搬移的类型（如持有堆指针的句柄）可通过以下任一方式声明：
+	 * @note 1. 声明成员类型 is_trivially_relocatable，其 ::value 为 true（如 using is_trivially_relocatable = my::true_type;）
+	 * @note 2. 直接特化本模板，适用于无法修改定义的类型以及依赖模板参数的情形
+	 * @note 对象地址被他处记录（如自引用指针、侵入式链表节点）的类型不可如此声明
+	*/
+	template <typename T>
+	struct is_trivially_relocatable:
+		__INNER_NAMESPACE::__is_trivially_relocatable_impl<typename remove_all_extents<T>::type> {};
+
+	#if __HAS_CPP17
+	/**
+	 * @brief (non-standard feature) checks if a type can be relocated by copying its bytes
+	 * @brief （非标准内容）检查类型是否可平凡重定位
+	 * @brief 其本身即表示检查的结果
+	 * 
+	 * @tparam T 需要检查的类型
+	*/
+	template <typename T>
+	inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+	#endif // __HAS_CPP17
+	#pragma endregion is_trivially_relocatable
+
 	// checks if a type has a virtual destructor
 	// 检查类型是否拥有虚析构函数
 	#pragma region has_virtual_destructor
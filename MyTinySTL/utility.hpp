@@ -3,10 +3,12 @@
 
 #if __HAS_CPP11
 #include <initializer_list>
+
 #include "type_traits.hpp"
+#include "swap_bytes.h"
 
 #if __HAS_CPP20
-// #include "compare.hpp"
+#include "compare.hpp"
 #endif // __HAS_CPP20
 
 namespace __MY_NAMESPACE {
@@ -79,6 +81,18 @@ namespace __MY_NAMESPACE {
 	__CONSTEXPR14 typename remove_reference<T>::type&& move(T&& t) noexcept {
 		return static_cast<typename remove_reference<T>::type&&>(t);
 	}
+
+	/**
+	 * @brief obtains an rvalue reference if the move constructor does not throw
+	 * @brief 移动构造不抛出异常或无法复制构造时得到右值引用，否则得到 const 左值引用，用于提供强异常保证
+	 * @param t 要被移动或复制的对象
+	*/
+	template <typename T>
+	__CONSTEXPR14 typename conditional<
+		!is_nothrow_move_constructible<T>::value && is_copy_constructible<T>::value, const T&, T&&
+	>::type move_if_noexcept(T& t) noexcept {
+		return __MY_NAMESPACE::move(t);
+	}
 	#pragma endregion move
 
 	#pragma region forward
@@ -91,7 +105,7 @@ namespace __MY_NAMESPACE {
 	 * @return static_cast<T&&>(t)
 	*/
 	template <typename T>
-	__CONSTEXPR14 T&& forward(typename std::remove_reference<T>::type& t) noexcept {
+	__CONSTEXPR14 T&& forward(typename remove_reference<T>::type& t) noexcept {
 		return static_cast<T&&>(t);
 	}
 
@@ -104,7 +118,7 @@ namespace __MY_NAMESPACE {
 	 * @return static_cast<T&&>(t)
 	*/
 	template <typename T>
-	__CONSTEXPR14 T&& forward(typename std::remove_reference<T>::type&& t) noexcept {
+	__CONSTEXPR14 T&& forward(typename remove_reference<T>::type&& t) noexcept {
 		return static_cast<T&&>(t);
 	}
 	#pragma endregion forward
@@ -128,9 +142,88 @@ namespace __MY_NAMESPACE {
 		is_nothrow_move_constructible<T>::value&&
 		is_nothrow_move_assignable<T>::value
 	) {
-		T temp = move(left);
-		left = move(right);
-		right = move(temp);
+		T temp = __MY_NAMESPACE::move(left);
+		left = __MY_NAMESPACE::move(right);
+		right = __MY_NAMESPACE::move(temp);
+	}
+
+	__INNER_BEGIN
+	template <typename T, typename = decltype(swap(declval<T&>(), declval<T&>()))>
+	true_type __test_unqualified_swap(int);
+	template <typename T>
+	false_type __test_unqualified_swap(...);
+
+	template <typename T>
+	__CONSTEXPR20 void __swap_adl(T& left, T& right, true_type) noexcept(noexcept(swap(left, right))) {
+		swap(left, right);
+	}
+
+	template <typename T>
+	__CONSTEXPR20 void __swap_adl(T& left, T& right, false_type) noexcept(noexcept(__MY_NAMESPACE::swap(left, right))) {
+		__MY_NAMESPACE::swap(left, right);
+	}
+
+	/**
+	 * @brief (non-standard feature) swaps two objects, preferring a swap found by argument-dependent lookup
+	 * @brief （非标准内容）交换两个对象，优先使用实参依赖查找到的 swap；
+	 * 与其他命名空间中的通用 swap（如 std::swap）产生歧义时使用 my::swap
+	*/
+	template <typename T>
+	__CONSTEXPR20 void __swap_adl(T& left, T& right) noexcept(
+		noexcept(__swap_adl(left, right, decltype(__test_unqualified_swap<T>(0))()))
+	) {
+		__swap_adl(left, right, decltype(__test_unqualified_swap<T>(0))());
+	}
+
+	// 两侧均为指向同一可平凡复制类型的指针，且该类型可以移动构造与移动赋值（my::swap 的要求）时，可以按字节整块交换
+	template <typename Iter1, typename Iter2>
+	struct __is_bulk_swappable: false_type {};
+
+	template <typename T>
+	struct __is_bulk_swappable<T*, T*>: integral_constant<
+		bool,
+		is_trivially_copyable<T>::value && !is_const<T>::value && !is_volatile<T>::value &&
+		is_move_constructible<T>::value && is_move_assignable<T>::value
+	> {};
+
+	template <typename ForwardIter1, typename ForwardIter2>
+	__CONSTEXPR20 ForwardIter2 __swap_ranges(ForwardIter1 first1, ForwardIter1 last1, ForwardIter2 first2, false_type) {
+		for (; first1 != last1; ++first1, ++first2) {
+			__swap_adl(*first1, *first2);
+		}
+		return first2;
+	}
+
+	template <typename T>
+	__CONSTEXPR20 T* __swap_ranges(T* first1, T* last1, T* first2, true_type) noexcept {
+		#if __HAS_CPP20
+		// 常量求值中不能使用 memcpy 与向量指令
+		if (__builtin_is_constant_evaluated()) {
+			return __swap_ranges(first1, last1, first2, false_type());
+		}
+		#endif // __HAS_CPP20
+		const ::size_t count = static_cast<::size_t>(last1 - first1);
+		__swap_bytes(reinterpret_cast<unsigned char*>(first1), reinterpret_cast<unsigned char*>(first2), count * sizeof(T));
+		return first2 + count;
+	}
+	__INNER_END
+
+	/**
+	 * @brief swaps two ranges of elements
+	 * @brief 交换两个不重叠的范围中的元素
+	 * @param first1 第一个范围的起始
+	 * @param last1 第一个范围的末尾
+	 * @param first2 第二个范围的起始
+	 * @return 第二个范围中最后一个被交换元素的下一位置
+	 *
+	 * @note
+	 * 两侧为指向同一可平凡复制类型的指针时，按 64 字节的块（AVX2 或 SSE2 可用时使用向量寄存器）整块交换，而非逐元素移动三次
+	*/
+	template <typename ForwardIter1, typename ForwardIter2>
+	__CONSTEXPR20 ForwardIter2 swap_ranges(ForwardIter1 first1, ForwardIter1 last1, ForwardIter2 first2) {
+		return __INNER_NAMESPACE::__swap_ranges(
+			first1, last1, first2, __INNER_NAMESPACE::__is_bulk_swappable<ForwardIter1, ForwardIter2>()
+		);
 	}
 
 	#if __HAS_CPP17
@@ -154,68 +247,785 @@ namespace __MY_NAMESPACE {
 		noexcept(noexcept(swap(*a, *b)))
 		#endif // __HAS_CPP17
 	{
-		T* l_ptr = left_arr;
-		T* l_end_ptr = l_ptr + N;
-		T* r_ptr = right_arr;
-		for (; l_ptr != l_end_ptr; ++l_ptr, ++r_ptr) {
-			swap(*l_ptr, *r_ptr);
-		}
+		__MY_NAMESPACE::swap_ranges(left_arr, left_arr + N, right_arr);
 	}
 	#pragma endregion swap
 
+	#pragma region integer_sequence
+	/**
+	 * @brief implements compile-time sequence of integers
+	 * @brief 编译期整数序列
+	 * @tparam T 整数的类型
+	 * @tparam ...Ints 整数序列
+	*/
+	template <typename T, T... Ints>
+	struct integer_sequence {
+		static_assert(is_integral<T>::value, "integer_sequence requires an integral value type");
+
+		using value_type = T;
+
+		__NODISCARD static constexpr ::size_t size() noexcept {
+			return sizeof...(Ints);
+		}
+	};
+
+	template <::size_t... Ints>
+	using index_sequence = integer_sequence<::size_t, Ints...>;
+
+	__INNER_BEGIN
+	#if __HAS_MAKE_INTEGER_SEQ
+	template <typename T, T N>
+	using __make_integer_sequence = __make_integer_seq<integer_sequence, T, N>;
+	#elif __HAS_INTEGER_PACK
+	template <typename T, T N>
+	using __make_integer_sequence = integer_sequence<T, __integer_pack(N)...>;
+	#else // ^^^ builtin / vvv !builtin
+	template <typename Seq1, typename Seq2>
+	struct __concat_integer_sequence;
+
+	// 将后半段整体平移前半段的长度后拼接
+	template <typename T, T... Ints1, T... Ints2>
+	struct __concat_integer_sequence<integer_sequence<T, Ints1...>, integer_sequence<T, Ints2...>> {
+		using type = integer_sequence<T, Ints1..., static_cast<T>(sizeof...(Ints1) + Ints2)...>;
+	};
+
+	// 对半分治，实例化深度为 O(log N)
+	template <typename T, ::size_t N>
+	struct __make_integer_sequence_impl: __concat_integer_sequence<
+		typename __make_integer_sequence_impl<T, N / 2>::type,
+		typename __make_integer_sequence_impl<T, N - N / 2>::type
+	> {};
+
+	template <typename T>
+	struct __make_integer_sequence_impl<T, 0> {
+		using type = integer_sequence<T>;
+	};
+
+	template <typename T>
+	struct __make_integer_sequence_impl<T, 1> {
+		using type = integer_sequence<T, 0>;
+	};
+
+	template <typename T, T N>
+	using __make_integer_sequence = typename __make_integer_sequence_impl<T, static_cast<::size_t>(N)>::type;
+	#endif // __HAS_MAKE_INTEGER_SEQ
+	__INNER_END
+
+	/**
+	 * @brief creates integer_sequence<T, 0, 1, ..., N - 1>
+	 * @brief 生成 integer_sequence<T, 0, 1, ..., N - 1>
+	 *
+	 * @note
+	 * 编译器提供 __make_integer_seq 或 __integer_pack 时直接使用之，否则以对半分治生成，实例化深度为 O(log N)
+	*/
+	template <typename T, T N>
+	using make_integer_sequence = __INNER_NAMESPACE::__make_integer_sequence<T, N>;
+
+	template <::size_t N>
+	using make_index_sequence = make_integer_sequence<::size_t, N>;
+
+	template <typename... Ts>
+	using index_sequence_for = make_index_sequence<sizeof...(Ts)>;
+	#pragma endregion integer_sequence
+
+	#pragma region type_list
+	/**
+	 * @brief (non-standard feature) compile-time list of types
+	 * @brief （非标准内容）编译期类型列表
+	*/
+	template <typename... Ts>
+	struct type_list {
+		__NODISCARD static constexpr ::size_t size() noexcept {
+			return sizeof...(Ts);
+		}
+	};
+
+	__INNER_BEGIN
+	template <::size_t I, typename T>
+	struct __indexed_type {
+		using type = T;
+	};
+
+	template <typename Seq, typename... Ts>
+	struct __indexed_types;
+
+	// 每个类型与其下标组成一个基类，按下标推导即可一步取出类型
+	template <::size_t... Is, typename... Ts>
+	struct __indexed_types<index_sequence<Is...>, Ts...>: __indexed_type<Is, Ts>... {};
+
+	template <::size_t I, typename T>
+	__indexed_type<I, T> __select_indexed_type(const __indexed_type<I, T>&);
+
+	template <::size_t I, typename... Ts>
+	struct __type_at {
+		static_assert(I < sizeof...(Ts), "type_at index out of range");
+
+		using type = typename decltype(
+			__select_indexed_type<I>(declval<__indexed_types<index_sequence_for<Ts...>, Ts...>>())
+		)::type;
+	};
+
+	#if __HAS_CPP14
+	template <bool... Found>
+	constexpr ::size_t __first_true() noexcept {
+		constexpr bool found[] = { Found..., true };
+		::size_t i = 0;
+		while (!found[i]) {
+			++i;
+		}
+		return i;
+	}
+	#else // ^^^ __HAS_CPP14 / vvv !__HAS_CPP14
+	constexpr ::size_t __first_true_from(const bool* found, ::size_t i) noexcept {
+		return found[i] ? i : __first_true_from(found, i + 1);
+	}
+
+	template <bool... Found>
+	struct __first_true_array {
+		static constexpr bool value[] = { Found..., true };
+	};
+
+	template <bool... Found>
+	constexpr bool __first_true_array<Found...>::value[];
+
+	template <bool... Found>
+	constexpr ::size_t __first_true() noexcept {
+		return __first_true_from(__first_true_array<Found...>::value, 0);
+	}
+	#endif // __HAS_CPP14
+	__INNER_END
+
+	/**
+	 * @brief (non-standard feature) obtains the I-th type of a type_list
+	 * @brief （非标准内容）获取 type_list 中的第 I 个类型，实例化深度与列表长度无关
+	*/
+	template <::size_t I, typename List>
+	struct type_at;
+
+	template <::size_t I, typename... Ts>
+	struct type_at<I, type_list<Ts...>>: __INNER_NAMESPACE::__type_at<I, Ts...> {};
+
+	template <::size_t I, typename List>
+	using type_at_t = typename type_at<I, List>::type;
+
+	/**
+	 * @brief (non-standard feature) obtains the index of the first occurrence of T in a type_list
+	 * @brief （非标准内容）获取 T 在 type_list 中第一次出现的下标，不存在时为列表长度
+	*/
+	template <typename T, typename List>
+	struct index_of;
+
+	template <typename T, typename... Ts>
+	struct index_of<T, type_list<Ts...>>: integral_constant<
+		::size_t, __INNER_NAMESPACE::__first_true<is_same<T, Ts>::value...>()
+	> {};
+
+	#if __HAS_CPP17
+	template <typename T, typename List>
+	inline constexpr ::size_t index_of_v = index_of<T, List>::value;
+	#endif // __HAS_CPP17
+	#pragma endregion type_list
+
+	#pragma region piecewise_construct
+	template <typename... Types>
+	class tuple;
+
+	/**
+	 * @brief tag type used to select correct function overload for piecewise construction
+	 * @brief 用于选择逐段构造的函数重载的标签类型
+	*/
+	struct piecewise_construct_t {
+		explicit piecewise_construct_t() = default;
+	};
+
+	/**
+	 * @brief an object of type piecewise_construct_t
+	 * @brief piecewise_construct_t 类型的对象
+	*/
+	__INLINE17 constexpr piecewise_construct_t piecewise_construct{};
+	#pragma endregion piecewise_construct
+
 	#pragma region pair
 	template <typename T1, typename T2>
-	struct pair {
-		using first_type = T1;
-		using second_type = T2;
+	struct pair;
 
+	__INNER_BEGIN
+	/**
+	 * @brief (non-standard feature) storage and assignment of pair
+	 * @brief （非标准内容）pair 的数据成员与赋值
+	 *
+	 * @note
+	 * 成员均不是引用时，复制与移动赋值为默认的逐成员赋值，成员可平凡赋值时 pair 也可平凡赋值；
+	 * 含引用成员时，默认的赋值被弃置，此时经由引用为所引用的对象赋值
+	*/
+	template <typename T1, typename T2, bool = !is_reference<T1>::value && !is_reference<T2>::value>
+	struct __pair_base {
 		T1 first;
 		T2 second;
 
-		// https://zh.cppreference.com/w/cpp/utility/pair/pair
+		__pair_base() = default;
 
-		__CONSTEXPR11 pair();
+		template <typename U1, typename U2>
+		constexpr __pair_base(U1&& first, U2&& second)
+			: first(__MY_NAMESPACE::forward<U1>(first)), second(__MY_NAMESPACE::forward<U2>(second)) {}
 
-		__CONSTEXPR14 pair(const T1& first, const T2& second);
+		// 逐段构造，以两个 tuple 中的元素分别构造两个成员
+		template <typename... Args1, typename... Args2, ::size_t... I1, ::size_t... I2>
+		__CONSTEXPR20 __pair_base(
+			tuple<Args1...>& first_args, tuple<Args2...>& second_args, index_sequence<I1...>, index_sequence<I2...>
+		): first(__MY_NAMESPACE::forward<Args1>(first_args.template __get<I1>())...),
+			second(__MY_NAMESPACE::forward<Args2>(second_args.template __get<I2>())...) {}
+	};
+
+	template <typename T1, typename T2>
+	struct __pair_base<T1, T2, false> {
+		T1 first;
+		T2 second;
+
+		__pair_base() = default;
 
-		#if __HAS_CPP23
-		template <typename U1 = T1, typename U2 = T2>
-		#else // ^^^ __HAS_CPP23 / vvv !__HAS_CPP23
 		template <typename U1, typename U2>
-		#endif // __HAS_CPP23
-		__CONSTEXPR14 pair(U1&& first, U2&& second);
+		constexpr __pair_base(U1&& first, U2&& second)
+			: first(__MY_NAMESPACE::forward<U1>(first)), second(__MY_NAMESPACE::forward<U2>(second)) {}
+
+		// 逐段构造，以两个 tuple 中的元素分别构造两个成员
+		template <typename... Args1, typename... Args2, ::size_t... I1, ::size_t... I2>
+		__CONSTEXPR20 __pair_base(
+			tuple<Args1...>& first_args, tuple<Args2...>& second_args, index_sequence<I1...>, index_sequence<I2...>
+		): first(__MY_NAMESPACE::forward<Args1>(first_args.template __get<I1>())...),
+			second(__MY_NAMESPACE::forward<Args2>(second_args.template __get<I2>())...) {}
+
+		__pair_base(const __pair_base&) = default;
+		__pair_base(__pair_base&&) = default;
+
+		__CONSTEXPR14 __pair_base& operator=(const __pair_base& other) {
+			first = other.first;
+			second = other.second;
+			return *this;
+		}
+
+		__CONSTEXPR14 __pair_base& operator=(__pair_base&& other) noexcept(
+			is_nothrow_assignable<T1&, T1>::value && is_nothrow_assignable<T2&, T2>::value
+		) {
+			first = __MY_NAMESPACE::forward<T1>(other.first);
+			second = __MY_NAMESPACE::forward<T2>(other.second);
+			return *this;
+		}
+	};
+
+	// 以 U1、U2 构造 T1、T2 是否可行，以及是否可隐式转换（决定构造函数是否为 explicit）
+	template <typename T1, typename T2, typename U1, typename U2>
+	struct __pair_constructible: integral_constant<
+		bool,
+		is_constructible<T1, U1>::value && is_constructible<T2, U2>::value
+	> {};
+
+	template <typename T1, typename T2, typename U1, typename U2>
+	struct __pair_implicit: integral_constant<
+		bool,
+		is_convertible<U1, T1>::value && is_convertible<U2, T2>::value
+	> {};
+
+	template <typename T1, typename T2, typename U1, typename U2>
+	struct __pair_assignable: integral_constant<
+		bool,
+		is_assignable<T1&, U1>::value && is_assignable<T2&, U2>::value
+	> {};
+	__INNER_END
+
+	/**
+	 * @brief stores two heterogeneous objects as a single unit
+	 * @brief 将两个可能不同类型的对象存储为一个单元
+	 * @tparam T1 第一个成员的类型
+	 * @tparam T2 第二个成员的类型
+	 *
+	 * @note
+	 * 复制、移动构造与赋值、析构均为默认，因此 T1、T2 均可平凡复制（可平凡析构）时 pair 同样可平凡复制（可平凡析构），
+	 * 容器可以用 memcpy 搬移 pair<int, int> 之类的元素
+	 * 默认构造函数同样为默认，T1、T2 均可平凡默认构造时 pair 同样可平凡默认构造：
+	 * 值初始化（pair<T1, T2>() 或 pair<T1, T2>{}）时成员被清零，而默认初始化时平凡的成员不被初始化（与 std::pair 不同）
+	 * 构造函数仅当对应的成员构造为隐式转换时才不是 explicit
+	*/
+	template <typename T1, typename T2>
+	struct pair: __INNER_NAMESPACE::__pair_base<T1, T2> {
+	private:
+		using __base = __INNER_NAMESPACE::__pair_base<T1, T2>;
 
-		#if __HAS_CPP23
 		template <typename U1, typename U2>
-		constexpr pair(pair<U1, U2>& other_pair);
-		#endif // __HAS_CPP23
+		using __constructible = __INNER_NAMESPACE::__pair_constructible<T1, T2, U1, U2>;
 
 		template <typename U1, typename U2>
-		__CONSTEXPR14 pair(const pair<U1, U2>& other_pair);
+		using __implicit = __INNER_NAMESPACE::__pair_implicit<T1, T2, U1, U2>;
 
 		template <typename U1, typename U2>
-		__CONSTEXPR14 pair(pair<U1, U2>&& other_pair);
+		using __assignable = __INNER_NAMESPACE::__pair_assignable<T1, T2, U1, U2>;
+
+	public:
+		using first_type = T1;
+		using second_type = T2;
+
+		// https://zh.cppreference.com/w/cpp/utility/pair/pair
+
+		pair() = default;
+
+		template <typename U1 = T1, typename U2 = T2, typename enable_if<
+			__constructible<const U1&, const U2&>::value && __implicit<const U1&, const U2&>::value, int
+		>::type = 0>
+		constexpr pair(const T1& first, const T2& second): __base(first, second) {}
+
+		template <typename U1 = T1, typename U2 = T2, typename enable_if<
+			__constructible<const U1&, const U2&>::value && !__implicit<const U1&, const U2&>::value, int
+		>::type = 0>
+		constexpr explicit pair(const T1& first, const T2& second): __base(first, second) {}
 
 		#if __HAS_CPP23
-		template <typename U1, typename U2>
-		constexpr pair(const pair<U1, U2>&& other_pair);
+		template <typename U1 = T1, typename U2 = T2, typename enable_if<
+		#else // ^^^ __HAS_CPP23 / vvv !__HAS_CPP23
+		template <typename U1, typename U2, typename enable_if<
+		#endif // __HAS_CPP23
+			__constructible<U1&&, U2&&>::value && __implicit<U1&&, U2&&>::value, int
+		>::type = 0>
+		constexpr pair(U1&& first, U2&& second)
+			: __base(__MY_NAMESPACE::forward<U1>(first), __MY_NAMESPACE::forward<U2>(second)) {}
+
+		#if __HAS_CPP23
+		template <typename U1 = T1, typename U2 = T2, typename enable_if<
+		#else // ^^^ __HAS_CPP23 / vvv !__HAS_CPP23
+		template <typename U1, typename U2, typename enable_if<
+		#endif // __HAS_CPP23
+			__constructible<U1&&, U2&&>::value && !__implicit<U1&&, U2&&>::value, int
+		>::type = 0>
+		constexpr explicit pair(U1&& first, U2&& second)
+			: __base(__MY_NAMESPACE::forward<U1>(first), __MY_NAMESPACE::forward<U2>(second)) {}
+
+		#if __HAS_CPP23
+		template <typename U1, typename U2, typename enable_if<
+			__constructible<U1&, U2&>::value && __implicit<U1&, U2&>::value, int
+		>::type = 0>
+		constexpr pair(pair<U1, U2>& other_pair): __base(other_pair.first, other_pair.second) {}
+
+		template <typename U1, typename U2, typename enable_if<
+			__constructible<U1&, U2&>::value && !__implicit<U1&, U2&>::value, int
+		>::type = 0>
+		constexpr explicit pair(pair<U1, U2>& other_pair): __base(other_pair.first, other_pair.second) {}
 		#endif // __HAS_CPP23
 
+		template <typename U1, typename U2, typename enable_if<
+			__constructible<const U1&, const U2&>::value && __implicit<const U1&, const U2&>::value, int
+		>::type = 0>
+		constexpr pair(const pair<U1, U2>& other_pair): __base(other_pair.first, other_pair.second) {}
+
+		template <typename U1, typename U2, typename enable_if<
+			__constructible<const U1&, const U2&>::value && !__implicit<const U1&, const U2&>::value, int
+		>::type = 0>
+		constexpr explicit pair(const pair<U1, U2>& other_pair): __base(other_pair.first, other_pair.second) {}
+
+		template <typename U1, typename U2, typename enable_if<
+			__constructible<U1&&, U2&&>::value && __implicit<U1&&, U2&&>::value, int
+		>::type = 0>
+		constexpr pair(pair<U1, U2>&& other_pair)
+			: __base(__MY_NAMESPACE::forward<U1>(other_pair.first), __MY_NAMESPACE::forward<U2>(other_pair.second)) {}
+
+		template <typename U1, typename U2, typename enable_if<
+			__constructible<U1&&, U2&&>::value && !__implicit<U1&&, U2&&>::value, int
+		>::type = 0>
+		constexpr explicit pair(pair<U1, U2>&& other_pair)
+			: __base(__MY_NAMESPACE::forward<U1>(other_pair.first), __MY_NAMESPACE::forward<U2>(other_pair.second)) {}
+
 		#if __HAS_CPP23
-		template <pair-like P>
-		constexpr pair(P&& other_pair);
+		template <typename U1, typename U2, typename enable_if<
+			__constructible<const U1&&, const U2&&>::value && __implicit<const U1&&, const U2&&>::value, int
+		>::type = 0>
+		constexpr pair(const pair<U1, U2>&& other_pair)
+			: __base(__MY_NAMESPACE::forward<const U1>(other_pair.first), __MY_NAMESPACE::forward<const U2>(other_pair.second)) {}
+
+		template <typename U1, typename U2, typename enable_if<
+			__constructible<const U1&&, const U2&&>::value && !__implicit<const U1&&, const U2&&>::value, int
+		>::type = 0>
+		constexpr explicit pair(const pair<U1, U2>&& other_pair)
+			: __base(__MY_NAMESPACE::forward<const U1>(other_pair.first), __MY_NAMESPACE::forward<const U2>(other_pair.second)) {}
 		#endif // __HAS_CPP23
 
+		/**
+		 * @brief constructs first from the elements of first_args and second from the elements of second_args
+		 * @brief 以 first_args 中的元素构造 first，以 second_args 中的元素构造 second，使用时需要包含 tuple.hpp
+		*/
 		template <typename... Args1, typename... Args2>
-		__CONSTEXPR20 pair(piecewise_construct_t, tuple<Args1...> first_args, tuple<Args2...> second_args);
+		__CONSTEXPR20 pair(piecewise_construct_t, tuple<Args1...> first_args, tuple<Args2...> second_args)
+			: __base(first_args, second_args, index_sequence_for<Args1...>(), index_sequence_for<Args2...>()) {}
 
 		pair(const pair& other_pair) = default;
 		pair(pair&& other_pair) = default;
 
+		pair& operator=(const pair& other_pair) = default;
+		pair& operator=(pair&& other_pair) = default;
+
+		template <typename U1, typename U2, typename = typename enable_if<
+			__assignable<const U1&, const U2&>::value
+		>::type>
+		__CONSTEXPR14 pair& operator=(const pair<U1, U2>& other_pair) {
+			this->first = other_pair.first;
+			this->second = other_pair.second;
+			return *this;
+		}
+
+		template <typename U1, typename U2, typename = typename enable_if<
+			__assignable<U1&&, U2&&>::value
+		>::type>
+		__CONSTEXPR14 pair& operator=(pair<U1, U2>&& other_pair) {
+			this->first = __MY_NAMESPACE::forward<U1>(other_pair.first);
+			this->second = __MY_NAMESPACE::forward<U2>(other_pair.second);
+			return *this;
+		}
+
+		/**
+		 * @brief swaps the contents
+		 * @brief 交换两个 pair 的内容
+		*/
+		__CONSTEXPR20 void swap(pair& other_pair) noexcept(
+			noexcept(__INNER_NAMESPACE::__swap_adl(declval<T1&>(), declval<T1&>())) &&
+			noexcept(__INNER_NAMESPACE::__swap_adl(declval<T2&>(), declval<T2&>()))
+		) {
+			__INNER_NAMESPACE::__swap_adl(this->first, other_pair.first);
+			__INNER_NAMESPACE::__swap_adl(this->second, other_pair.second);
+		}
+	};
+
+	#if __HAS_CPP17
+	template <typename T1, typename T2>
+	pair(T1, T2) -> pair<T1, T2>;
+	#endif // __HAS_CPP17
+
+	/**
+	 * @brief creates a pair object of type, defined by the argument types
+	 * @brief 创建 pair 对象，其类型由实参类型退化得到
+	*/
+	template <typename T1, typename T2>
+	__NODISCARD constexpr pair<typename decay<T1>::type, typename decay<T2>::type> make_pair(T1&& first, T2&& second) {
+		return pair<typename decay<T1>::type, typename decay<T2>::type>(
+			__MY_NAMESPACE::forward<T1>(first), __MY_NAMESPACE::forward<T2>(second)
+		);
+	}
+
+	template <typename T1, typename T2>
+	__CONSTEXPR20 void swap(pair<T1, T2>& lhs, pair<T1, T2>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+		lhs.swap(rhs);
+	}
+
+	// 两个元素都可平凡重定位时，pair 可平凡重定位
+	template <typename T1, typename T2>
+	struct is_trivially_relocatable<pair<T1, T2>>: integral_constant<
+		bool,
+		is_trivially_relocatable<T1>::value && is_trivially_relocatable<T2>::value
+	> {};
+
+	#if __HAS_CPP20
+	__INNER_BEGIN
+	// 两个元素都可按位比较且没有填充时，整个 pair 可按位比较
+	template <typename T1, typename T2, typename U1, typename U2>
+	struct __is_bitwise_equality_comparable<pair<T1, T2>, pair<U1, U2>>: integral_constant<
+		bool,
+		__is_bitwise_equality_comparable<T1, U1>::value && __is_bitwise_equality_comparable<T2, U2>::value &&
+		sizeof(pair<T1, T2>) == sizeof(T1) + sizeof(T2)
+	> {};
+	__INNER_END
+
+	/**
+	 * @brief lexicographically compares the values in the pair
+	 * @brief 按字典序比较两个 pair
+	*/
+	template <typename T1, typename T2, typename U1, typename U2>
+	__NODISCARD constexpr bool operator==(const pair<T1, T2>& lhs, const pair<U1, U2>& rhs) {
+		if constexpr (__INNER_NAMESPACE::__is_bitwise_equality_comparable<pair<T1, T2>, pair<U1, U2>>::value) {
+			if (!__builtin_is_constant_evaluated()) {
+				return __INNER_NAMESPACE::__bytes_equal(&lhs.first, &rhs.first, sizeof(pair<T1, T2>));
+			}
+		}
+		return lhs.first == rhs.first && lhs.second == rhs.second;
+	}
+
+	/**
+	 * @brief compares the pair with a single pass of synth-three-way per element
+	 * @brief 对每个元素只进行一次 synth-three-way，在第一个不等价的元素处得出结果
+	*/
+	template <typename T1, typename T2, typename U1, typename U2>
+	__NODISCARD constexpr common_comparison_category_t<
+		__INNER_NAMESPACE::__synth_three_way_result<const T1, const U1>,
+		__INNER_NAMESPACE::__synth_three_way_result<const T2, const U2>
+	> operator<=>(const pair<T1, T2>& lhs, const pair<U1, U2>& rhs) {
+		if constexpr (__INNER_NAMESPACE::__is_byte_comparable<T1, U1>::value && __INNER_NAMESPACE::__is_byte_comparable<T2, U2>::value) {
+			if (!__builtin_is_constant_evaluated()) {
+				return __INNER_NAMESPACE::__bytes_compare(&lhs.first, &rhs.first, 2);
+			}
+		}
+		if (auto order = __INNER_NAMESPACE::__synth_three_way(lhs.first, rhs.first); order != 0) {
+			return order;
+		}
+		return __INNER_NAMESPACE::__synth_three_way(lhs.second, rhs.second);
+	}
+	#else // ^^^ __HAS_CPP20 / vvv !__HAS_CPP20
+	/**
+	 * @brief lexicographically compares the values in the pair
+	 * @brief 按字典序比较两个 pair
+	*/
+	template <typename T1, typename T2, typename U1, typename U2>
+	__NODISCARD constexpr bool operator==(const pair<T1, T2>& lhs, const pair<U1, U2>& rhs) {
+		return lhs.first == rhs.first && lhs.second == rhs.second;
+	}
+
+	template <typename T1, typename T2, typename U1, typename U2>
+	__NODISCARD constexpr bool operator!=(const pair<T1, T2>& lhs, const pair<U1, U2>& rhs) {
+		return !(lhs == rhs);
+	}
+
+	template <typename T1, typename T2, typename U1, typename U2>
+	__NODISCARD constexpr bool operator<(const pair<T1, T2>& lhs, const pair<U1, U2>& rhs) {
+		return lhs.first < rhs.first || (!(rhs.first < lhs.first) && lhs.second < rhs.second);
+	}
+
+	template <typename T1, typename T2, typename U1, typename U2>
+	__NODISCARD constexpr bool operator>(const pair<T1, T2>& lhs, const pair<U1, U2>& rhs) {
+		return rhs < lhs;
+	}
+
+	template <typename T1, typename T2, typename U1, typename U2>
+	__NODISCARD constexpr bool operator<=(const pair<T1, T2>& lhs, const pair<U1, U2>& rhs) {
+		return !(rhs < lhs);
+	}
+
+	template <typename T1, typename T2, typename U1, typename U2>
+	__NODISCARD constexpr bool operator>=(const pair<T1, T2>& lhs, const pair<U1, U2>& rhs) {
+		return !(lhs < rhs);
+	}
+	#endif // __HAS_CPP20
+
+	#pragma region tuple_size tuple_element get
+	/**
+	 * @brief obtains the number of elements of a tuple-like type
+	 * @brief 获取类 tuple 类型的元素个数
+	*/
+	template <typename T>
+	struct tuple_size;
+
+	template <typename T>
+	struct tuple_size<const T>: integral_constant<::size_t, tuple_size<T>::value> {};
+
+	template <typename T1, typename T2>
+	struct tuple_size<pair<T1, T2>>: integral_constant<::size_t, 2> {};
+
+	#if __HAS_CPP17
+	template <typename T>
+	inline constexpr ::size_t tuple_size_v = tuple_size<T>::value;
+	#endif // __HAS_CPP17
+
+	/**
+	 * @brief obtains the element types of a tuple-like type
+	 * @brief 获取类 tuple 类型的元素类型
+	*/
+	template <::size_t I, typename T>
+	struct tuple_element;
+
+	template <::size_t I, typename T>
+	struct tuple_element<I, const T> {
+		using type = typename add_const<typename tuple_element<I, T>::type>::type;
+	};
+
+	template <typename T1, typename T2>
+	struct tuple_element<0, pair<T1, T2>> { using type = T1; };
+
+	template <typename T1, typename T2>
+	struct tuple_element<1, pair<T1, T2>> { using type = T2; };
+
+	template <::size_t I, typename T>
+	using tuple_element_t = typename tuple_element<I, T>::type;
 
+	__INNER_BEGIN
+	template <::size_t I>
+	struct __pair_get;
+
+	template <>
+	struct __pair_get<0> {
+		template <typename T1, typename T2>
+		static constexpr T1& get(pair<T1, T2>& p) noexcept { return p.first; }
+		template <typename T1, typename T2>
+		static constexpr const T1& get(const pair<T1, T2>& p) noexcept { return p.first; }
+	};
+
+	template <>
+	struct __pair_get<1> {
+		template <typename T1, typename T2>
+		static constexpr T2& get(pair<T1, T2>& p) noexcept { return p.second; }
+		template <typename T1, typename T2>
+		static constexpr const T2& get(const pair<T1, T2>& p) noexcept { return p.second; }
 	};
+	__INNER_END
+
+	/**
+	 * @brief accesses an element of a pair
+	 * @brief 访问 pair 的第 I 个元素
+	*/
+	template <::size_t I, typename T1, typename T2>
+	__NODISCARD constexpr typename tuple_element<I, pair<T1, T2>>::type& get(pair<T1, T2>& p) noexcept {
+		return __INNER_NAMESPACE::__pair_get<I>::get(p);
+	}
+
+	template <::size_t I, typename T1, typename T2>
+	__NODISCARD constexpr const typename tuple_element<I, pair<T1, T2>>::type& get(const pair<T1, T2>& p) noexcept {
+		return __INNER_NAMESPACE::__pair_get<I>::get(p);
+	}
+
+	template <::size_t I, typename T1, typename T2>
+	__NODISCARD constexpr typename tuple_element<I, pair<T1, T2>>::type&& get(pair<T1, T2>&& p) noexcept {
+		return __MY_NAMESPACE::forward<typename tuple_element<I, pair<T1, T2>>::type>(__INNER_NAMESPACE::__pair_get<I>::get(p));
+	}
+
+	template <typename T, typename U>
+	__NODISCARD constexpr T& get(pair<T, U>& p) noexcept {
+		return p.first;
+	}
+
+	template <typename T, typename U>
+	__NODISCARD constexpr const T& get(const pair<T, U>& p) noexcept {
+		return p.first;
+	}
+
+	template <typename T, typename U>
+	__NODISCARD constexpr T& get(pair<U, T>& p) noexcept {
+		return p.second;
+	}
+
+	template <typename T, typename U>
+	__NODISCARD constexpr const T& get(const pair<U, T>& p) noexcept {
+		return p.second;
+	}
+	#pragma endregion tuple_size tuple_element get
 	#pragma endregion pair
 
+	#pragma region compressed_pair
+	__INNER_BEGIN
+	// 能否作为空基类以占用零字节
+	template <typename T>
+	struct __is_ebo_candidate: integral_constant<
+		bool,
+		is_class<T>::value && is_empty<T>::value &&
+		#if __HAS_CPP14
+		!is_final<T>::value
+		#else // ^^^ __HAS_CPP14 / vvv !__HAS_CPP14
+		!__is_final(T)
+		#endif // __HAS_CPP14
+	> {};
+
+	/**
+	 * @brief (non-standard feature) one member of compressed_pair
+	 * @brief （非标准内容）compressed_pair 的一个成员，Index 用于区分两个成员以免基类重复
+	*/
+	template <typename T, ::size_t Index, bool = __is_ebo_candidate<T>::value>
+	class __compressed_pair_elem {
+	private:
+		T __value;
+
+	public:
+		constexpr __compressed_pair_elem(): __value() {}
+
+		template <typename U, typename = typename enable_if<
+			!is_same<typename decay<U>::type, __compressed_pair_elem>::value
+		>::type>
+		constexpr explicit __compressed_pair_elem(U&& value): __value(__MY_NAMESPACE::forward<U>(value)) {}
+
+		template <typename... Args, ::size_t... Is>
+		__CONSTEXPR20 __compressed_pair_elem(piecewise_construct_t, tuple<Args...>& args, index_sequence<Is...>)
+			: __value(__MY_NAMESPACE::forward<Args>(args.template __get<Is>())...) {}
+
+		__CONSTEXPR14 T& __get() noexcept { return __value; }
+		constexpr const T& __get() const noexcept { return __value; }
+	};
+
+	// 空且非 final 的成员作为基类存储，不占用空间
+	template <typename T, ::size_t Index>
+	class __compressed_pair_elem<T, Index, true>: private T {
+	public:
+		constexpr __compressed_pair_elem(): T() {}
+
+		template <typename U, typename = typename enable_if<
+			!is_same<typename decay<U>::type, __compressed_pair_elem>::value
+		>::type>
+		constexpr explicit __compressed_pair_elem(U&& value): T(__MY_NAMESPACE::forward<U>(value)) {}
+
+		template <typename... Args, ::size_t... Is>
+		__CONSTEXPR20 __compressed_pair_elem(piecewise_construct_t, tuple<Args...>& args, index_sequence<Is...>)
+			: T(__MY_NAMESPACE::forward<Args>(args.template __get<Is>())...) {}
+
+		__CONSTEXPR14 T& __get() noexcept { return *this; }
+		constexpr const T& __get() const noexcept { return *this; }
+	};
+	__INNER_END
+
+	/**
+	 * @brief (non-standard feature) pair that stores empty members without taking space
+	 * @brief （非标准内容）空成员不占用空间的 pair，用于存储通常无状态的分配器、删除器、比较器等
+	 * @tparam T1 第一个成员的类型
+	 * @tparam T2 第二个成员的类型
+	 *
+	 * @note
+	 * 空且非 final 的类成员经由空基类优化存储，如 sizeof(compressed_pair<int*, default_delete<int>>) == sizeof(int*)；
+	 * 两个成员为同一空类时，两个基类子对象的地址必须不同，此时仍会占用一个字节
+	 * 默认构造时两个成员均被值初始化，以 first()、second() 访问成员
+	*/
+	template <typename T1, typename T2>
+	class compressed_pair
+		: private __INNER_NAMESPACE::__compressed_pair_elem<T1, 0>,
+		  private __INNER_NAMESPACE::__compressed_pair_elem<T2, 1> {
+	private:
+		using __first_base = __INNER_NAMESPACE::__compressed_pair_elem<T1, 0>;
+		using __second_base = __INNER_NAMESPACE::__compressed_pair_elem<T2, 1>;
+
+	public:
+		using first_type = T1;
+		using second_type = T2;
+
+		constexpr compressed_pair(): __first_base(), __second_base() {}
+
+		template <typename U1, typename U2>
+		constexpr compressed_pair(U1&& first, U2&& second)
+			: __first_base(__MY_NAMESPACE::forward<U1>(first)), __second_base(__MY_NAMESPACE::forward<U2>(second)) {}
+
+		// 逐段构造，使用时需要包含 tuple.hpp
+		template <typename... Args1, typename... Args2>
+		__CONSTEXPR20 compressed_pair(piecewise_construct_t, tuple<Args1...> first_args, tuple<Args2...> second_args)
+			: __first_base(piecewise_construct, first_args, index_sequence_for<Args1...>()),
+			  __second_base(piecewise_construct, second_args, index_sequence_for<Args2...>()) {}
+
+		__CONSTEXPR14 T1& first() noexcept { return static_cast<__first_base&>(*this).__get(); }
+		constexpr const T1& first() const noexcept { return static_cast<const __first_base&>(*this).__get(); }
+
+		__CONSTEXPR14 T2& second() noexcept { return static_cast<__second_base&>(*this).__get(); }
+		constexpr const T2& second() const noexcept { return static_cast<const __second_base&>(*this).__get(); }
+
+		/**
+		 * @brief swaps the contents
+		 * @brief 交换两个 compressed_pair 的内容
+		*/
+		__CONSTEXPR20 void swap(compressed_pair& other) noexcept(
+			noexcept(__INNER_NAMESPACE::__swap_adl(declval<T1&>(), declval<T1&>())) &&
+			noexcept(__INNER_NAMESPACE::__swap_adl(declval<T2&>(), declval<T2&>()))
+		) {
+			__INNER_NAMESPACE::__swap_adl(first(), other.first());
+			__INNER_NAMESPACE::__swap_adl(second(), other.second());
+		}
+	};
+
+	template <typename T1, typename T2>
+	__CONSTEXPR20 void swap(compressed_pair<T1, T2>& lhs, compressed_pair<T1, T2>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+		lhs.swap(rhs);
+	}
+
+	template <typename T1, typename T2>
+	struct is_trivially_relocatable<compressed_pair<T1, T2>>: integral_constant<
+		bool,
+		is_trivially_relocatable<T1>::value && is_trivially_relocatable<T2>::value
+	> {};
+	#pragma endregion compressed_pair
+
 
 } // namespace __MY_NAMESPACE
 
@@ -0,0 +1,1233 @@
+﻿#pragma once
+#include "core.h"
+
+#if __HAS_CPP11
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include "type_traits.hpp"
+#include "utility.hpp"
+#include "memory.hpp"
+
+#if __HAS_CPP20
+#include "compare.hpp"
+#endif // __HAS_CPP20
+
+namespace __MY_NAMESPACE {
+
+	#pragma region vector
+	/**
+	 * @brief (non-standard feature) the factor numerator / denominator by which vector<T> grows its capacity
+	 * @brief （非标准内容）vector<T> 容量增长的倍数 numerator / denominator，可以为具体的 T 特化
+	 *
+	 * @note
+	 * 默认为 2；较小的倍数（如 3 / 2）使释放的旧存储更容易被之后的增长复用，代价是更多次搬移
+	*/
+	template <typename T>
+	struct vector_growth_factor {
+		static constexpr ::size_t numerator = 2;
+		static constexpr ::size_t denominator = 1;
+	};
+
+	__INNER_BEGIN
+	// 分配器是否不定制 T 的 construct 与 destroy，此时可以绕过分配器直接构造、析构或按字节搬移元素
+	template <typename Alloc, typename T>
+	struct __alloc_is_plain: integral_constant<
+		bool,
+		!decltype(__test_alloc_construct<Alloc, T, T&&>(0))::value &&
+		!decltype(__test_alloc_destroy<Alloc, T>(0))::value
+	> {};
+
+	/**
+	 * @brief (non-standard feature) whether vector<T, Alloc> may move its elements with memcpy / memmove
+	 * @brief （非标准内容）vector<T, Alloc> 能否以 memcpy / memmove 搬移元素：T 可平凡重定位，且分配器不定制构造与析构
+	*/
+	template <typename T, typename Alloc>
+	struct __vector_relocates_bitwise: integral_constant<
+		bool,
+		is_trivially_relocatable<T>::value &&
+		__alloc_is_plain<Alloc, T>::value
+	> {};
+
+	template <typename It, typename = void>
+	struct __is_input_iterator: false_type {};
+
+	template <typename It>
+	struct __is_input_iterator<It, __void_t<typename ::std::iterator_traits<It>::iterator_category>>: is_convertible<
+		typename ::std::iterator_traits<It>::iterator_category, ::std::input_iterator_tag
+	> {};
+
+	template <typename It>
+	struct __is_forward_iterator: is_convertible<
+		typename ::std::iterator_traits<It>::iterator_category, ::std::forward_iterator_tag
+	> {};
+
+	/**
+	 * @brief (non-standard feature) an element constructed through the allocator outside of the container
+	 * @brief （非标准内容）通过分配器在容器之外构造的临时元素，实参可能引用容器中的元素时用于先行构造
+	*/
+	template <typename T, typename Alloc>
+	class __vector_temp {
+	private:
+		Alloc& __alloc;
+		alignas(T) unsigned char __buffer[sizeof(T)];
+		bool __owns;
+
+	public:
+		template <typename... Args>
+		explicit __vector_temp(Alloc& alloc, Args&&... args): __alloc(alloc), __owns(true) {
+			allocator_traits<Alloc>::construct(alloc, get(), __MY_NAMESPACE::forward<Args>(args)...);
+		}
+
+		__vector_temp(const __vector_temp&) = delete;
+		__vector_temp& operator=(const __vector_temp&) = delete;
+
+		~__vector_temp() {
+			if (__owns) {
+				allocator_traits<Alloc>::destroy(__alloc, get());
+			}
+		}
+
+		T* get() noexcept { return reinterpret_cast<T*>(__buffer); }
+
+		// 对象已按字节搬移到别处，不再析构
+		void release() noexcept { __owns = false; }
+	};
+
+	/**
+	 * @brief (non-standard feature) the storage and operations shared by vector and small_vector
+	 * @brief （非标准内容）vector 与 small_vector 共用的存储与操作，Storage 为派生的容器类型
+	 *
+	 * @note
+	 * 派生类须提供以下函数（可以为私有，此时将本类声明为友元）：
+	 * __is_allocated(ptr) 判断 ptr 是否为由分配器分配的存储
+	 * __reset() 改用空的初始存储（vector 为空指针，small_vector 为内联存储），不析构元素也不释放存储
+	 * __length_message()、__range_message() 返回 length_error 与 out_of_range 的说明
+	*/
+	template <typename T, typename Alloc, typename Storage>
+	class __vector_base {
+	protected:
+		using __alloc_traits = allocator_traits<Alloc>;
+		using __growth = vector_growth_factor<T>;
+		using __bitwise = typename __vector_relocates_bitwise<T, Alloc>::type;
+		using __plain = typename __alloc_is_plain<Alloc, T>::type;
+		using __temp = __vector_temp<T, Alloc>;
+
+	public:
+		using value_type = T;
+		using allocator_type = Alloc;
+		using size_type = typename __alloc_traits::size_type;
+		using difference_type = typename __alloc_traits::difference_type;
+		using reference = T&;
+		using const_reference = const T&;
+		using pointer = typename __alloc_traits::pointer;
+		using const_pointer = typename __alloc_traits::const_pointer;
+		using iterator = T*;
+		using const_iterator = const T*;
+		using reverse_iterator = ::std::reverse_iterator<iterator>;
+		using const_reverse_iterator = ::std::reverse_iterator<const_iterator>;
+
+	protected:
+		T* __first;
+		T* __last;
+		compressed_pair<T*, Alloc> __end_cap;
+
+		__vector_base(T* first, T* cap, const Alloc& alloc) noexcept: __first(first), __last(first), __end_cap(cap, alloc) {}
+
+		__vector_base(const __vector_base&) = delete;
+		__vector_base& operator=(const __vector_base&) = delete;
+
+		~__vector_base() = default;
+
+		Storage& __storage() noexcept { return static_cast<Storage&>(*this); }
+		const Storage& __storage() const noexcept { return static_cast<const Storage&>(*this); }
+
+		Alloc& __alloc() noexcept { return __end_cap.second(); }
+		const Alloc& __alloc() const noexcept { return __end_cap.second(); }
+		T*& __cap() noexcept { return __end_cap.first(); }
+		T* __cap() const noexcept { return __end_cap.first(); }
+
+		#pragma region construction helpers
+		template <typename... Args>
+		void __construct_one(T* ptr, Args&&... args) {
+			__alloc_traits::construct(__alloc(), ptr, __MY_NAMESPACE::forward<Args>(args)...);
+		}
+
+		void __destroy_range(T* first, T* last) noexcept {
+			__destroy_range(first, last, __plain());
+		}
+
+		void __destroy_range(T* first, T* last, true_type) noexcept {
+			__MY_NAMESPACE::destroy(first, last);
+		}
+
+		void __destroy_range(T* first, T* last, false_type) noexcept {
+			for (; first != last; ++first) {
+				__alloc_traits::destroy(__alloc(), first);
+			}
+		}
+
+		// 以下函数在未初始化的 dest 处构造元素并返回构造结束的位置，抛出异常时析构已构造的元素
+		// 分配器不定制构造时使用未初始化内存算法，以获得 memcpy / memset 的快速路径
+		T* __fill_uninitialized(T* dest, size_type count, const T& value) {
+			return __fill_uninitialized(dest, count, value, __plain());
+		}
+
+		T* __fill_uninitialized(T* dest, size_type count, const T& value, true_type) {
+			return __MY_NAMESPACE::uninitialized_fill_n(dest, count, value);
+		}
+
+		T* __fill_uninitialized(T* dest, size_type count, const T& value, false_type) {
+			T* current = dest;
+			try {
+				for (; count > 0; --count, ++current) {
+					__construct_one(current, value);
+				}
+				return current;
+			}
+			catch (...) {
+				__destroy_range(dest, current);
+				throw;
+			}
+		}
+
+		T* __value_construct_uninitialized(T* dest, size_type count) {
+			return __value_construct_uninitialized(dest, count, __plain());
+		}
+
+		T* __value_construct_uninitialized(T* dest, size_type count, true_type) {
+			return __MY_NAMESPACE::uninitialized_value_construct_n(dest, count);
+		}
+
+		T* __value_construct_uninitialized(T* dest, size_type count, false_type) {
+			T* current = dest;
+			try {
+				for (; count > 0; --count, ++current) {
+					__construct_one(current);
+				}
+				return current;
+			}
+			catch (...) {
+				__destroy_range(dest, current);
+				throw;
+			}
+		}
+
+		template <typename It>
+		T* __copy_uninitialized(It first, It last, T* dest) {
+			return __copy_uninitialized(first, last, dest, __plain());
+		}
+
+		template <typename It>
+		T* __copy_uninitialized(It first, It last, T* dest, true_type) {
+			return __MY_NAMESPACE::uninitialized_copy(first, last, dest);
+		}
+
+		template <typename It>
+		T* __copy_uninitialized(It first, It last, T* dest, false_type) {
+			T* current = dest;
+			try {
+				for (; first != last; ++first, ++current) {
+					__construct_one(current, *first);
+				}
+				return current;
+			}
+			catch (...) {
+				__destroy_range(dest, current);
+				throw;
+			}
+		}
+
+		// 按 move_if_noexcept 的语义将 [first, last) 转移到 dest，原元素保持存活
+		T* __transfer_uninitialized(T* first, T* last, T* dest) {
+			T* current = dest;
+			try {
+				for (; first != last; ++first, ++current) {
+					__construct_one(current, __MY_NAMESPACE::move_if_noexcept(*first));
+				}
+				return current;
+			}
+			catch (...) {
+				__destroy_range(dest, current);
+				throw;
+			}
+		}
+
+		// 将 [first, last) 移动构造到 dest，用于容量足够时后移元素
+		T* __transfer_moved(T* first, T* last, T* dest) {
+			T* current = dest;
+			try {
+				for (; first != last; ++first, ++current) {
+					__construct_one(current, __MY_NAMESPACE::move(*first));
+				}
+				return current;
+			}
+			catch (...) {
+				__destroy_range(dest, current);
+				throw;
+			}
+		}
+
+		// 将 [first, last) 移动到未初始化的 dest 并析构原元素；抛出异常时原元素保持存活
+		T* __move_relocate(T* first, T* last, T* dest) noexcept(__bitwise::value) {
+			return __move_relocate(first, last, dest, __bitwise());
+		}
+
+		T* __move_relocate(T* first, T* last, T* dest, true_type) noexcept {
+			return __MY_NAMESPACE::uninitialized_relocate(first, last, dest);
+		}
+
+		T* __move_relocate(T* first, T* last, T* dest, false_type) {
+			T* result = __transfer_moved(first, last, dest);
+			__destroy_range(first, last);
+			return result;
+		}
+
+		// 将 [first, last) 移动到以 d_last 结尾的已构造区间，从后向前进行
+		static void __move_backward(T* first, T* last, T* d_last) {
+			while (first != last) {
+				*--d_last = __MY_NAMESPACE::move(*--last);
+			}
+		}
+		#pragma endregion construction helpers
+
+		#pragma region storage helpers
+		static void __throw_length_error() {
+			throw ::std::length_error(Storage::__length_message());
+		}
+
+		// 初始存储（空指针或内联存储）不经过分配器
+		void __deallocate(T* ptr, size_type count) noexcept {
+			if (__storage().__is_allocated(ptr)) {
+				__alloc_traits::deallocate(__alloc(), ptr, count);
+			}
+		}
+
+		// 为空且位于初始存储的容器准备至少 count 个元素的存储，初始存储已足够时不分配
+		void __init_allocate(size_type count) {
+			if (count > max_size()) {
+				__throw_length_error();
+			}
+			if (count > capacity()) {
+				__first = __last = __alloc_traits::allocate(__alloc(), count);
+				__cap() = __first + count;
+			}
+		}
+
+		// 析构全部元素并释放存储，回到初始存储
+		void __release() noexcept {
+			__destroy_range(__first, __last);
+			__deallocate(__first, capacity());
+			__storage().__reset();
+		}
+
+		// 释放旧存储，改用已经构造好 count 个元素的新存储
+		void __adopt(T* new_first, size_type count, size_type new_capacity) noexcept {
+			__deallocate(__first, capacity());
+			__first = new_first;
+			__last = new_first + count;
+			__cap() = new_first + new_capacity;
+		}
+
+		// 交换两者由分配器分配的存储，调用方保证二者都不位于内联存储
+		void __swap_storage(__vector_base& other) noexcept {
+			__INNER_NAMESPACE::__swap_adl(__first, other.__first);
+			__INNER_NAMESPACE::__swap_adl(__last, other.__last);
+			__INNER_NAMESPACE::__swap_adl(__cap(), other.__cap());
+		}
+
+		// 容纳 required 个元素时应分配的容量：按增长倍数扩大，不足 required 时取 required
+		size_type __recommend(size_type required) const {
+			const size_type max = max_size();
+			if (required > max) {
+				__throw_length_error();
+			}
+			const size_type capacity = this->capacity();
+			const size_type quotient = capacity / __growth::denominator;
+			if (quotient > max / __growth::numerator) {
+				return max;
+			}
+			size_type grown = quotient * __growth::numerator + capacity % __growth::denominator * __growth::numerator / __growth::denominator;
+			grown = grown > max ? max : grown;
+			return grown > required ? grown : required;
+		}
+
+		// 尝试原地扩展由分配器分配的存储到 new_capacity，成功时元素不必搬移
+		bool __try_expand(size_type new_capacity) noexcept {
+			if (__storage().__is_allocated(__first) && __alloc_traits::expand(__alloc(), __first, capacity(), new_capacity)) {
+				__cap() = __first + new_capacity;
+				return true;
+			}
+			return false;
+		}
+
+		/**
+		 * @brief moves all elements into the new storage, leaving count slots at index for the caller
+		 * @brief 将全部元素搬移到 new_first 开始的新存储，下标 index 处空出 count 个位置（由调用方构造）
+		 *
+		 * @note
+		 * 抛出异常时由本函数构造的元素均已析构，原存储保持不变；成功时原存储中的元素均已析构
+		*/
+		void __relocate_with_gap(T* new_first, size_type index, size_type count) {
+			__relocate_with_gap(new_first, index, count, __bitwise());
+		}
+
+		void __relocate_with_gap(T* new_first, size_type index, size_type count, true_type) noexcept {
+			__MY_NAMESPACE::uninitialized_relocate(__first, __first + index, new_first);
+			__MY_NAMESPACE::uninitialized_relocate(__first + index, __last, new_first + index + count);
+		}
+
+		void __relocate_with_gap(T* new_first, size_type index, size_type count, false_type) {
+			T* prefix_last = __transfer_uninitialized(__first, __first + index, new_first);
+			try {
+				__transfer_uninitialized(__first + index, __last, new_first + index + count);
+			}
+			catch (...) {
+				__destroy_range(new_first, prefix_last);
+				throw;
+			}
+			__destroy_range(__first, __last);
+		}
+
+		// 将容量改为 new_capacity（不小于 size()），可能时原地扩展
+		void __reallocate(size_type new_capacity) {
+			if (new_capacity > capacity() && __try_expand(new_capacity)) {
+				return;
+			}
+			T* new_first = __alloc_traits::allocate(__alloc(), new_capacity);
+			try {
+				__relocate_with_gap(new_first, size(), 0);
+			}
+			catch (...) {
+				__alloc_traits::deallocate(__alloc(), new_first, new_capacity);
+				throw;
+			}
+			__adopt(new_first, size(), new_capacity);
+		}
+
+		/**
+		 * @brief replaces the contents with count elements built by construct(dest) in new storage
+		 * @brief 在新分配的恰好 count 个元素的存储中以 construct(dest) 构造全部元素后，替换原有内容
+		 * @note 新元素先于原有元素的析构构造，因此实参可以引用原有元素
+		*/
+		template <typename Construct>
+		void __assign_reallocate(size_type count, Construct construct) {
+			if (count > max_size()) {
+				__throw_length_error();
+			}
+			T* new_first = __alloc_traits::allocate(__alloc(), count);
+			try {
+				construct(new_first);
+			}
+			catch (...) {
+				__alloc_traits::deallocate(__alloc(), new_first, count);
+				throw;
+			}
+			__release();
+			__first = new_first;
+			__last = __cap() = new_first + count;
+		}
+		#pragma endregion storage helpers
+
+		#pragma region insertion helpers
+		// 在已有空余容量时于 position 处构造新元素
+		template <typename... Args>
+		T* __emplace_in_place(T* position, Args&&... args) {
+			if (position == __last) {
+				__construct_one(__last, __MY_NAMESPACE::forward<Args>(args)...);
+				++__last;
+				return position;
+			}
+			// 实参可能引用本容器中的元素，因此先在容器之外构造新元素
+			__temp temp(__alloc(), __MY_NAMESPACE::forward<Args>(args)...);
+			__emplace_middle(position, temp, __bitwise());
+			return position;
+		}
+
+		void __emplace_middle(T* position, __temp& temp, true_type) noexcept {
+			__MY_NAMESPACE::relocate(position, __last, position + 1);
+			__MY_NAMESPACE::relocate_at(temp.get(), position);
+			temp.release();
+			++__last;
+		}
+
+		void __emplace_middle(T* position, __temp& temp, false_type) {
+			__construct_one(__last, __MY_NAMESPACE::move(*(__last - 1)));
+			++__last;
+			__move_backward(position, __last - 2, __last - 1);
+			*position = __MY_NAMESPACE::move(*temp.get());
+		}
+
+		// 空余容量不足时分配新存储：先构造新元素（实参可能引用原有元素），再搬移原有元素
+		template <typename... Args>
+		T* __emplace_reallocate(size_type index, Args&&... args) {
+			const size_type size = this->size();
+			const size_type new_capacity = __recommend(size + 1);
+			if (__try_expand(new_capacity)) {
+				return __emplace_in_place(__first + index, __MY_NAMESPACE::forward<Args>(args)...);
+			}
+			T* new_first = __alloc_traits::allocate(__alloc(), new_capacity);
+			try {
+				__construct_one(new_first + index, __MY_NAMESPACE::forward<Args>(args)...);
+			}
+			catch (...) {
+				__alloc_traits::deallocate(__alloc(), new_first, new_capacity);
+				throw;
+			}
+			try {
+				__relocate_with_gap(new_first, index, 1);
+			}
+			catch (...) {
+				__alloc_traits::destroy(__alloc(), new_first + index);
+				__alloc_traits::deallocate(__alloc(), new_first, new_capacity);
+				throw;
+			}
+			__adopt(new_first, size + 1, new_capacity);
+			return new_first + index;
+		}
+
+		/**
+		 * @brief inserts count elements at index, returns the first inserted element
+		 * @brief 在下标 index 处插入 count 个元素，返回第一个插入的元素
+		 * @param construct construct(dest, skip) 在未初始化的 dest 处构造第 skip 个及之后的插入元素，返回构造结束的位置
+		 * @param assign assign(dest, dest_last) 将前 dest_last - dest 个插入元素赋值给已构造的 [dest, dest_last)
+		 *
+		 * @note
+		 * 空余容量不足时先在新存储中构造插入的元素，再搬移原有元素，此时提供强异常保证
+		 * 按字节搬移的元素先整体后移再构造，构造失败时移回原处，同样不改变容器
+		*/
+		template <typename Construct, typename Assign>
+		T* __insert_n(size_type index, size_type count, Construct construct, Assign assign) {
+			if (count > static_cast<size_type>(__cap() - __last)) {
+				const size_type size = this->size();
+				const size_type new_capacity = __recommend(size + count);
+				if (!__try_expand(new_capacity)) {
+					T* new_first = __alloc_traits::allocate(__alloc(), new_capacity);
+					try {
+						construct(new_first + index, 0);
+					}
+					catch (...) {
+						__alloc_traits::deallocate(__alloc(), new_first, new_capacity);
+						throw;
+					}
+					try {
+						__relocate_with_gap(new_first, index, count);
+					}
+					catch (...) {
+						__destroy_range(new_first + index, new_first + index + count);
+						__alloc_traits::deallocate(__alloc(), new_first, new_capacity);
+						throw;
+					}
+					__adopt(new_first, size + count, new_capacity);
+					return new_first + index;
+				}
+			}
+			__insert_n_in_place(__first + index, count, construct, assign, __bitwise());
+			return __first + index;
+		}
+
+		template <typename Construct, typename Assign>
+		void __insert_n_in_place(T* position, size_type count, Construct& construct, Assign&, true_type) {
+			__MY_NAMESPACE::relocate(position, __last, position + count);
+			try {
+				construct(position, 0);
+			}
+			catch (...) {
+				__MY_NAMESPACE::relocate(position + count, __last + count, position);
+				throw;
+			}
+			__last += count;
+		}
+
+		// 后移原有元素：尾部超出原末尾的部分移动构造，其余移动赋值；插入的元素落在已构造的位置上时赋值，否则构造
+		template <typename Construct, typename Assign>
+		void __insert_n_in_place(T* position, size_type count, Construct& construct, Assign& assign, false_type) {
+			T* const old_last = __last;
+			const size_type tail = static_cast<size_type>(old_last - position);
+			if (tail > count) {
+				__last = __transfer_moved(old_last - count, old_last, old_last);
+				__move_backward(position, old_last - count, old_last);
+				assign(position, position + count);
+			}
+			else {
+				__last = construct(old_last, tail);
+				__last = __transfer_moved(position, old_last, __last);
+				assign(position, old_last);
+			}
+		}
+		#pragma endregion insertion helpers
+
+		#pragma region range helpers
+		template <typename It>
+		void __init_range(It first, It last, false_type) {
+			try {
+				for (; first != last; ++first) {
+					emplace_back(*first);
+				}
+			}
+			catch (...) {
+				__release();
+				throw;
+			}
+		}
+
+		template <typename It>
+		void __init_range(It first, It last, true_type) {
+			__init_allocate(static_cast<size_type>(::std::distance(first, last)));
+			try {
+				__last = __copy_uninitialized(first, last, __first);
+			}
+			catch (...) {
+				__release();
+				throw;
+			}
+		}
+
+		template <typename It>
+		void __assign_range(It first, It last, false_type) {
+			T* current = __first;
+			for (; first != last && current != __last; ++first, ++current) {
+				*current = *first;
+			}
+			if (current != __last) {
+				__destroy_range(current, __last);
+				__last = current;
+				return;
+			}
+			for (; first != last; ++first) {
+				emplace_back(*first);
+			}
+		}
+
+		template <typename It>
+		void __assign_range(It first, It last, true_type) {
+			const size_type count = static_cast<size_type>(::std::distance(first, last));
+			if (count > capacity()) {
+				__assign_reallocate(count, [this, first, last](T* dest) {
+					this->__copy_uninitialized(first, last, dest);
+				});
+				return;
+			}
+			T* current = __first;
+			for (; first != last && current != __last; ++first, ++current) {
+				*current = *first;
+			}
+			if (current != __last) {
+				__destroy_range(current, __last);
+				__last = current;
+				return;
+			}
+			__last = __copy_uninitialized(first, last, __last);
+		}
+
+		template <typename It>
+		T* __insert_range(T* position, It first, It last, false_type) {
+			// 单趟迭代器无法预先得知元素个数，先收集到临时容器中再移动插入
+			Storage other(first, last, __alloc());
+			return __insert_range(position, ::std::make_move_iterator(other.begin()), ::std::make_move_iterator(other.end()), true_type());
+		}
+
+		template <typename It>
+		T* __insert_range(T* position, It first, It last, true_type) {
+			const size_type count = static_cast<size_type>(::std::distance(first, last));
+			if (count == 0) {
+				return position;
+			}
+			auto construct = [this, first, last](T* dest, size_type skip) -> T* {
+				It from = first;
+				::std::advance(from, skip);
+				return this->__copy_uninitialized(from, last, dest);
+			};
+			auto assign = [first](T* dest, T* dest_last) {
+				It from = first;
+				for (; dest != dest_last; ++dest, ++from) {
+					*dest = *from;
+				}
+			};
+			return __insert_n(static_cast<size_type>(position - __first), count, construct, assign);
+		}
+		#pragma endregion range helpers
+
+		#pragma region assignment helpers
+		void __copy_assign_alloc(const Alloc& other, true_type) {
+			if (!__alloc_traits::is_always_equal::value && !(__alloc() == other)) {
+				__release();
+			}
+			__alloc() = other;
+		}
+
+		void __copy_assign_alloc(const Alloc&, false_type) noexcept {}
+
+		void __move_assign_alloc(Alloc& other, true_type) noexcept {
+			__alloc() = __MY_NAMESPACE::move(other);
+		}
+
+		void __move_assign_alloc(Alloc&, false_type) noexcept {}
+
+		void __swap_alloc(Alloc& other, true_type) noexcept {
+			__INNER_NAMESPACE::__swap_adl(__alloc(), other);
+		}
+
+		void __swap_alloc(Alloc&, false_type) noexcept {}
+		#pragma endregion assignment helpers
+
+		void __erase(T* first, T* last, true_type) noexcept {
+			__destroy_range(first, last);
+			__MY_NAMESPACE::relocate(last, __last, first);
+			__last -= last - first;
+		}
+
+		void __erase(T* first, T* last, false_type) {
+			T* new_last = first;
+			for (; last != __last; ++new_last, ++last) {
+				*new_last = __MY_NAMESPACE::move(*last);
+			}
+			__destroy_range(new_last, __last);
+			__last = new_last;
+		}
+
+	public:
+		/**
+		 * @brief replaces the contents with count copies of value
+		 * @brief 将内容替换为 count 个 value 的副本
+		*/
+		void assign(size_type count, const T& value) {
+			if (count > capacity()) {
+				__assign_reallocate(count, [this, count, &value](T* dest) {
+					this->__fill_uninitialized(dest, count, value);
+				});
+				return;
+			}
+			const size_type size = this->size();
+			T* current = __first;
+			for (T* assign_last = __first + (count < size ? count : size); current != assign_last; ++current) {
+				*current = value;
+			}
+			if (count <= size) {
+				__destroy_range(current, __last);
+				__last = current;
+				return;
+			}
+			__last = __fill_uninitialized(__last, count - size, value);
+		}
+
+		template <typename InputIt, typename = typename enable_if<__is_input_iterator<InputIt>::value>::type>
+		void assign(InputIt first, InputIt last) {
+			__assign_range(first, last, __is_forward_iterator<InputIt>());
+		}
+
+		void assign(::std::initializer_list<T> init) {
+			assign(init.begin(), init.end());
+		}
+
+		allocator_type get_allocator() const noexcept {
+			return __alloc();
+		}
+
+		#pragma region element access
+		reference at(size_type index) {
+			if (index >= size()) {
+				throw ::std::out_of_range(Storage::__range_message());
+			}
+			return __first[index];
+		}
+
+		const_reference at(size_type index) const {
+			if (index >= size()) {
+				throw ::std::out_of_range(Storage::__range_message());
+			}
+			return __first[index];
+		}
+
+		reference operator[](size_type index) noexcept { return __first[index]; }
+		const_reference operator[](size_type index) const noexcept { return __first[index]; }
+
+		reference front() noexcept { return *__first; }
+		const_reference front() const noexcept { return *__first; }
+
+		reference back() noexcept { return *(__last - 1); }
+		const_reference back() const noexcept { return *(__last - 1); }
+
+		T* data() noexcept { return __first; }
+		const T* data() const noexcept { return __first; }
+		#pragma endregion element access
+
+		#pragma region iterators
+		iterator begin() noexcept { return __first; }
+		const_iterator begin() const noexcept { return __first; }
+		const_iterator cbegin() const noexcept { return __first; }
+
+		iterator end() noexcept { return __last; }
+		const_iterator end() const noexcept { return __last; }
+		const_iterator cend() const noexcept { return __last; }
+
+		reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+		const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+		const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(end()); }
+
+		reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+		const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+		const_reverse_iterator crend() const noexcept { return const_reverse_iterator(begin()); }
+		#pragma endregion iterators
+
+		#pragma region capacity
+		__NODISCARD bool empty() const noexcept { return __first == __last; }
+
+		size_type size() const noexcept { return static_cast<size_type>(__last - __first); }
+
+		size_type capacity() const noexcept { return static_cast<size_type>(__cap() - __first); }
+
+		size_type max_size() const noexcept {
+			const size_type alloc_max = __alloc_traits::max_size(__alloc());
+			const size_type diff_max = static_cast<size_type>(static_cast<size_type>(-1) >> 1) / sizeof(T);
+			return alloc_max < diff_max ? alloc_max : diff_max;
+		}
+
+		/**
+		 * @brief increases the capacity to at least count, growing by vector_growth_factor<T>
+		 * @brief 将容量增加到至少 count：按增长倍数扩大，因此以递增的 count 反复调用仍为摊还常数时间
+		*/
+		void reserve(size_type count) {
+			if (count > capacity()) {
+				__reallocate(__recommend(count));
+			}
+		}
+
+		/**
+		 * @brief (non-standard feature) increases the capacity to exactly count
+		 * @brief （非标准内容）将容量增加到恰好 count，不按增长倍数取整
+		*/
+		void reserve_exact(size_type count) {
+			if (count > capacity()) {
+				if (count > max_size()) {
+					__throw_length_error();
+				}
+				__reallocate(count);
+			}
+		}
+		#pragma endregion capacity
+
+		#pragma region modifiers
+		void clear() noexcept {
+			__destroy_range(__first, __last);
+			__last = __first;
+		}
+
+		iterator insert(const_iterator position, const T& value) {
+			return emplace(position, value);
+		}
+
+		iterator insert(const_iterator position, T&& value) {
+			return emplace(position, __MY_NAMESPACE::move(value));
+		}
+
+		/**
+		 * @brief inserts count copies of value before position
+		 * @brief 在 position 之前插入 count 个 value 的副本
+		*/
+		iterator insert(const_iterator position, size_type count, const T& value) {
+			const size_type index = static_cast<size_type>(position - __first);
+			if (count == 0) {
+				return __first + index;
+			}
+			// value 可能引用本容器中会被移动的元素，因此先复制一份
+			__temp copy(__alloc(), value);
+			const T& source = *copy.get();
+			auto construct = [this, &source, count](T* dest, size_type skip) -> T* {
+				return this->__fill_uninitialized(dest, count - skip, source);
+			};
+			auto assign = [&source](T* dest, T* dest_last) {
+				for (; dest != dest_last; ++dest) {
+					*dest = source;
+				}
+			};
+			return __insert_n(index, count, construct, assign);
+		}
+
+		template <typename InputIt, typename = typename enable_if<__is_input_iterator<InputIt>::value>::type>
+		iterator insert(const_iterator position, InputIt first, InputIt last) {
+			return __insert_range(__first + (position - __first), first, last, __is_forward_iterator<InputIt>());
+		}
+
+		iterator insert(const_iterator position, ::std::initializer_list<T> init) {
+			return insert(position, init.begin(), init.end());
+		}
+
+		/**
+		 * @brief constructs an element in-place before position
+		 * @brief 在 position 之前原地构造元素
+		*/
+		template <typename... Args>
+		iterator emplace(const_iterator position, Args&&... args) {
+			const size_type index = static_cast<size_type>(position - __first);
+			if (__last == __cap()) {
+				return __emplace_reallocate(index, __MY_NAMESPACE::forward<Args>(args)...);
+			}
+			return __emplace_in_place(__first + index, __MY_NAMESPACE::forward<Args>(args)...);
+		}
+
+		iterator erase(const_iterator position) {
+			return erase(position, position + 1);
+		}
+
+		iterator erase(const_iterator first, const_iterator last) {
+			T* const erase_first = __first + (first - __first);
+			if (first != last) {
+				__erase(erase_first, __first + (last - __first), __bitwise());
+			}
+			return erase_first;
+		}
+
+		void push_back(const T& value) {
+			emplace_back(value);
+		}
+
+		void push_back(T&& value) {
+			emplace_back(__MY_NAMESPACE::move(value));
+		}
+
+		template <typename... Args>
+		reference emplace_back(Args&&... args) {
+			if (__last == __cap()) {
+				return *__emplace_reallocate(size(), __MY_NAMESPACE::forward<Args>(args)...);
+			}
+			__construct_one(__last, __MY_NAMESPACE::forward<Args>(args)...);
+			return *__last++;
+		}
+
+		void pop_back() noexcept {
+			--__last;
+			__alloc_traits::destroy(__alloc(), __last);
+		}
+
+		/**
+		 * @brief changes the number of elements, appending value-initialized elements
+		 * @brief 改变元素个数，新增的元素值初始化
+		*/
+		void resize(size_type count) {
+			const size_type size = this->size();
+			if (count <= size) {
+				__destroy_range(__first + count, __last);
+				__last = __first + count;
+				return;
+			}
+			if (count > capacity()) {
+				__reallocate(__recommend(count));
+			}
+			__last = __value_construct_uninitialized(__last, count - size);
+		}
+
+		void resize(size_type count, const T& value) {
+			const size_type size = this->size();
+			if (count <= size) {
+				__destroy_range(__first + count, __last);
+				__last = __first + count;
+				return;
+			}
+			insert(cend(), count - size, value);
+		}
+		#pragma endregion modifiers
+	};
+	__INNER_END
+
+	/**
+	 * @brief dynamic contiguous array
+	 * @brief 动态连续数组
+	 * @tparam T 元素类型
+	 * @tparam Alloc 分配器类型，pointer 须为 T*
+	 *
+	 * @note
+	 * 满足 is_trivially_relocatable 的元素在扩容、中间插入与删除时以 memcpy / memmove 整体搬移，
+	 * 其余元素在扩容时按 move_if_noexcept 的语义转移：移动构造不抛出异常或不可复制时移动，否则复制，从而提供强异常保证
+	 * 扩容时先通过 allocator_traits::expand 尝试原地扩展，成功时元素不必搬移
+	 * 容量按 vector_growth_factor<T> 增长；reserve 同样按增长倍数取整，需要精确容量时使用 reserve_exact
+	*/
+	template <typename T, typename Alloc = allocator<T>>
+	class vector: public __INNER_NAMESPACE::__vector_base<T, Alloc, vector<T, Alloc>> {
+	private:
+		friend class __INNER_NAMESPACE::__vector_base<T, Alloc, vector>;
+
+		using __base = __INNER_NAMESPACE::__vector_base<T, Alloc, vector>;
+		using __alloc_traits = allocator_traits<Alloc>;
+		using __growth = vector_growth_factor<T>;
+
+	public:
+		using value_type = T;
+		using allocator_type = Alloc;
+		using size_type = typename __alloc_traits::size_type;
+		using difference_type = typename __alloc_traits::difference_type;
+		using reference = T&;
+		using const_reference = const T&;
+		using pointer = typename __alloc_traits::pointer;
+		using const_pointer = typename __alloc_traits::const_pointer;
+		using iterator = T*;
+		using const_iterator = const T*;
+		using reverse_iterator = ::std::reverse_iterator<iterator>;
+		using const_reverse_iterator = ::std::reverse_iterator<const_iterator>;
+
+		static_assert(is_same<typename Alloc::value_type, T>::value, "vector requires Alloc::value_type to be T");
+		static_assert(is_same<pointer, T*>::value, "vector requires an allocator whose pointer type is T*");
+		static_assert(
+			__growth::denominator != 0 && __growth::numerator > __growth::denominator,
+			"vector_growth_factor must be greater than 1"
+		);
+
+	private:
+		using __base::__first;
+		using __base::__last;
+		using __base::__cap;
+		using __base::__alloc;
+		using __base::__deallocate;
+		using __base::__init_allocate;
+		using __base::__release;
+		using __base::__swap_storage;
+		using __base::__reallocate;
+		using __base::__fill_uninitialized;
+		using __base::__value_construct_uninitialized;
+		using __base::__init_range;
+		using __base::__copy_assign_alloc;
+		using __base::__move_assign_alloc;
+		using __base::__swap_alloc;
+
+		#pragma region storage hooks
+		// 只有空指针不是由分配器分配的存储
+		bool __is_allocated(const T* ptr) const noexcept { return ptr != nullptr; }
+
+		void __reset() noexcept {
+			__first = __last = __cap() = nullptr;
+		}
+
+		static const char* __length_message() noexcept { return "vector too long"; }
+		static const char* __range_message() noexcept { return "vector index out of range"; }
+		#pragma endregion storage hooks
+
+		void __move_assign(vector& other, true_type) noexcept {
+			__release();
+			__move_assign_alloc(other.__alloc(), typename __alloc_traits::propagate_on_container_move_assignment());
+			__swap_storage(other);
+		}
+
+		void __move_assign(vector& other, false_type) {
+			if (__alloc() == other.__alloc()) {
+				__move_assign(other, true_type());
+				return;
+			}
+			this->assign(::std::make_move_iterator(other.begin()), ::std::make_move_iterator(other.end()));
+		}
+
+	public:
+		vector() noexcept(noexcept(Alloc())): __base(nullptr, nullptr, Alloc()) {}
+
+		explicit vector(const Alloc& alloc) noexcept: __base(nullptr, nullptr, alloc) {}
+
+		explicit vector(size_type count, const Alloc& alloc = Alloc()): vector(alloc) {
+			__init_allocate(count);
+			try {
+				__last = __value_construct_uninitialized(__first, count);
+			}
+			catch (...) {
+				__release();
+				throw;
+			}
+		}
+
+		vector(size_type count, const T& value, const Alloc& alloc = Alloc()): vector(alloc) {
+			__init_allocate(count);
+			try {
+				__last = __fill_uninitialized(__first, count, value);
+			}
+			catch (...) {
+				__release();
+				throw;
+			}
+		}
+
+		template <typename InputIt, typename = typename enable_if<__INNER_NAMESPACE::__is_input_iterator<InputIt>::value>::type>
+		vector(InputIt first, InputIt last, const Alloc& alloc = Alloc()): vector(alloc) {
+			__init_range(first, last, __INNER_NAMESPACE::__is_forward_iterator<InputIt>());
+		}
+
+		vector(::std::initializer_list<T> init, const Alloc& alloc = Alloc()): vector(init.begin(), init.end(), alloc) {}
+
+		vector(const vector& other):
+			vector(other.__first, other.__last, __alloc_traits::select_on_container_copy_construction(other.__alloc())) {}
+
+		vector(const vector& other, const Alloc& alloc): vector(other.__first, other.__last, alloc) {}
+
+		vector(vector&& other) noexcept: vector(__MY_NAMESPACE::move(other.__alloc())) {
+			__swap_storage(other);
+		}
+
+		vector(vector&& other, const Alloc& alloc): vector(alloc) {
+			if (__alloc_traits::is_always_equal::value || __alloc() == other.__alloc()) {
+				__swap_storage(other);
+				return;
+			}
+			__init_range(::std::make_move_iterator(other.begin()), ::std::make_move_iterator(other.end()), true_type());
+		}
+
+		~vector() {
+			__release();
+		}
+
+		vector& operator=(const vector& other) {
+			if (this != __MY_NAMESPACE::addressof(other)) {
+				__copy_assign_alloc(other.__alloc(), typename __alloc_traits::propagate_on_container_copy_assignment());
+				this->assign(other.__first, other.__last);
+			}
+			return *this;
+		}
+
+		vector& operator=(vector&& other) noexcept(
+			__alloc_traits::propagate_on_container_move_assignment::value || __alloc_traits::is_always_equal::value
+		) {
+			if (this != __MY_NAMESPACE::addressof(other)) {
+				__move_assign(other, integral_constant<bool,
+					__alloc_traits::propagate_on_container_move_assignment::value || __alloc_traits::is_always_equal::value
+				>());
+			}
+			return *this;
+		}
+
+		vector& operator=(::std::initializer_list<T> init) {
+			this->assign(init.begin(), init.end());
+			return *this;
+		}
+
+		void shrink_to_fit() {
+			if (__last == __cap()) {
+				return;
+			}
+			if (this->empty()) {
+				__deallocate(__first, this->capacity());
+				__reset();
+				return;
+			}
+			__reallocate(this->size());
+		}
+
+		void swap(vector& other) noexcept {
+			__swap_alloc(other.__alloc(), typename __alloc_traits::propagate_on_container_swap());
+			__swap_storage(other);
+		}
+	};
+
+	#if __HAS_CPP17
+	template <typename InputIt, typename Alloc = allocator<typename ::std::iterator_traits<InputIt>::value_type>,
+		typename = typename enable_if<__INNER_NAMESPACE::__is_input_iterator<InputIt>::value>::type>
+	vector(InputIt, InputIt, Alloc = Alloc()) -> vector<typename ::std::iterator_traits<InputIt>::value_type, Alloc>;
+	#endif // __HAS_CPP17
+
+	template <typename T, typename Alloc>
+	void swap(vector<T, Alloc>& lhs, vector<T, Alloc>& rhs) noexcept {
+		lhs.swap(rhs);
+	}
+
+	// vector 只持有指向堆存储的指针，分配器可平凡重定位时整体可按字节搬移
+	template <typename T, typename Alloc>
+	struct is_trivially_relocatable<vector<T, Alloc>>: is_trivially_relocatable<Alloc> {};
+
+	__INNER_BEGIN
+	// 以下比较函数供各种连续存储的容器共用，可按位比较的元素在运行时使用 memcmp
+	template <typename T>
+	__CONSTEXPR20 bool __contiguous_equal(const T* lhs, ::size_t lhs_size, const T* rhs, ::size_t rhs_size) {
+		if (lhs_size != rhs_size) {
+			return false;
+		}
+		#if __HAS_CPP20
+		if constexpr (__is_bitwise_equality_comparable<T, T>::value) {
+			if (!__builtin_is_constant_evaluated()) {
+				return lhs_size == 0 || __bytes_equal(lhs, rhs, lhs_size * sizeof(T));
+			}
+		}
+		#endif // __HAS_CPP20
+		for (::size_t i = 0; i != lhs_size; ++i) {
+			if (!static_cast<bool>(lhs[i] == rhs[i])) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	#if __HAS_CPP20
+	template <typename T>
+	constexpr __synth_three_way_result<const T, const T> __contiguous_three_way(const T* lhs, ::size_t lhs_size, const T* rhs, ::size_t rhs_size) {
+		const ::size_t count = lhs_size < rhs_size ? lhs_size : rhs_size;
+		if constexpr (__is_byte_comparable<T, T>::value) {
+			if (!__builtin_is_constant_evaluated()) {
+				if (count != 0) {
+					if (auto order = __bytes_compare(lhs, rhs, count); order != 0) {
+						return order;
+					}
+				}
+				return __ordering_cast(lhs_size <=> rhs_size);
+			}
+		}
+		for (::size_t i = 0; i != count; ++i) {
+			if (auto order = __synth_three_way(lhs[i], rhs[i]); order != 0) {
+				return order;
+			}
+		}
+		return __ordering_cast(lhs_size <=> rhs_size);
+	}
+	#else // ^^^ __HAS_CPP20 / vvv !__HAS_CPP20
+	template <typename T>
+	__CONSTEXPR14 bool __contiguous_less(const T* lhs, ::size_t lhs_size, const T* rhs, ::size_t rhs_size) {
+		const ::size_t count = lhs_size < rhs_size ? lhs_size : rhs_size;
+		for (::size_t i = 0; i != count; ++i) {
+			if (lhs[i] < rhs[i]) {
+				return true;
+			}
+			if (rhs[i] < lhs[i]) {
+				return false;
+			}
+		}
+		return lhs_size < rhs_size;
+	}
+	#endif // __HAS_CPP20
+	__INNER_END
+
+	/**
+	 * @brief lexicographically compares the values in the vector
+	 * @brief 按字典序比较两个 vector，可按位比较的元素使用 memcmp
+	*/
+	template <typename T, typename Alloc>
+	__NODISCARD bool operator==(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+		return __INNER_NAMESPACE::__contiguous_equal(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+	}
+
+	#if __HAS_CPP20
+	template <typename T, typename Alloc>
+	__NODISCARD __INNER_NAMESPACE::__synth_three_way_result<const T, const T> operator<=>(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+		return __INNER_NAMESPACE::__contiguous_three_way(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+	}
+	#else // ^^^ __HAS_CPP20 / vvv !__HAS_CPP20
+	template <typename T, typename Alloc>
+	__NODISCARD bool operator!=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+		return !(lhs == rhs);
+	}
+
+	template <typename T, typename Alloc>
+	__NODISCARD bool operator<(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+		return __INNER_NAMESPACE::__contiguous_less(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+	}
+
+	template <typename T, typename Alloc>
+	__NODISCARD bool operator>(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+		return rhs < lhs;
+	}
+
+	template <typename T, typename Alloc>
+	__NODISCARD bool operator<=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+		return !(rhs < lhs);
+	}
+
+	template <typename T, typename Alloc>
+	__NODISCARD bool operator>=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+		return !(lhs < rhs);
+	}
+	#endif // __HAS_CPP20
+	#pragma endregion vector
+
+} // namespace __MY_NAMESPACE
+#endif // __HAS_CPP11